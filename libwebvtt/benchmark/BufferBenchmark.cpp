@@ -0,0 +1,58 @@
+#include "buffer/StringSyncBuffer.hpp"
+#include "buffer/StringRingBuffer.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Move fixed number of elements from producer thread to consumer thread
+ * through buffer, using chunks of given size on both sides.
+ * @return elapsed time in seconds
+ */
+static double transfer(webvtt::StringBuffer<char32_t> &buffer, size_t chunkSize, size_t totalSize) {
+  std::u32string chunk(chunkSize, U'a');
+  std::vector<char32_t> output(chunkSize);
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread producer([&]() {
+    for (size_t written = 0; written < totalSize; written += chunkSize)
+      buffer.writeChunk(chunk);
+    buffer.setInputEnded();
+  });
+
+  size_t readNumber = 0;
+  size_t oneRead;
+  while ((oneRead = buffer.readChunk(output)) != 0)
+    readNumber += oneRead;
+
+  producer.join();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if (readNumber < totalSize)
+    std::cerr << "lost data: " << totalSize - readNumber << std::endl;
+  return elapsed.count();
+}
+
+int main() {
+  constexpr size_t TOTAL_SIZE = 1 << 24;
+
+  std::cout << "chunk\tsync Melem/s\tring Melem/s" << std::endl;
+  for (size_t chunkSize : {1, 15, 64, 4096}) {
+    //Small chunks are slow on sync buffer, so less data is moved
+    size_t totalSize = chunkSize < 64 ? TOTAL_SIZE / 16 : TOTAL_SIZE;
+
+    webvtt::StringSyncBuffer<char32_t> syncBuffer;
+    double syncTime = transfer(syncBuffer, chunkSize, totalSize);
+
+    webvtt::StringRingBuffer<char32_t> ringBuffer;
+    double ringTime = transfer(ringBuffer, chunkSize, totalSize);
+
+    std::cout << chunkSize << "\t"
+              << totalSize / syncTime / 1e6 << "\t"
+              << totalSize / ringTime / 1e6 << std::endl;
+  }
+}
@@ -0,0 +1,46 @@
+#include "parser/cue_text_tokenizer/CueTextTokenizer.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Split given cue text to tokens many times
+ * @return nanoseconds per cue
+ */
+static double measure(webvtt::CueTextTokenizer &tokenizer, std::u32string_view text, size_t &tokenNumber) {
+  constexpr size_t CUE_NUMBER = 100000;
+
+  tokenNumber = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t cue = 0; cue < CUE_NUMBER; cue++) {
+    tokenizer.setText(text);
+    while (tokenizer.getCurrentPosition() != tokenizer.getInput().end()) {
+      webvtt::CueTextToken token = tokenizer.getNextToken();
+      tokenNumber += !token.value.empty();
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  tokenNumber /= CUE_NUMBER;
+  return elapsed.count() / static_cast<double>(CUE_NUMBER);
+}
+
+int main() {
+  const std::vector<std::pair<std::string, std::u32string>> cues = {
+      {"plain", U"Never drink liquid nitrogen, it will perforate your stomach."},
+      {"styled", U"<v Roger Bingham>We are in <i>New York City</i>, <b.loud>right</b> now</v>"},
+      {"classes", U"<c.yellow.bg_blue.big>Yellow</c> and <c.red.small>red</c> <lang en-GB>colour</lang>"},
+      {"references", U"Fish &amp; chips &lt;3 &nbsp;&copy; &#x263A;"},
+      {"ruby", U"<ruby>漢<rt>kan</rt>字<rt>ji</rt></ruby> <00:00:01.500>karaoke"},
+  };
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+  webvtt::CueTextTokenizer tokenizer;
+
+  std::cout << "cue\ttokens\tns/cue" << std::endl;
+  for (const auto &[name, text] : cues) {
+    size_t tokenNumber;
+    double time = measure(tokenizer, text, tokenNumber);
+    std::cout << name << "\t" << tokenNumber << "\t" << time << std::endl;
+  }
+}
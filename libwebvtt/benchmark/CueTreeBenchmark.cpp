@@ -0,0 +1,130 @@
+#include "parser/CueParsingPool.hpp"
+#include "parser/object_parser/CueParser.hpp"
+#include "elements/cue_nodes/FlatCueTree.hpp"
+#include "elements/visitors/ICueTreeVisitor.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::atomic<size_t> allocationNumber = 0;
+
+void *operator new(size_t size) {
+  allocationNumber.fetch_add(1, std::memory_order_relaxed);
+  if (void *memory = std::malloc(size == 0 ? 1 : size))
+    return memory;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+  std::free(memory);
+}
+
+/**
+ * Build and destroy tree of given cue text many times
+ * @return pair of allocations per cue and nanoseconds per cue
+ */
+static std::pair<double, double> measure(webvtt::CueParser &cueParser, std::u32string_view text) {
+  constexpr size_t CUE_NUMBER = 100000;
+
+  size_t startAllocations = allocationNumber.load();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t cue = 0; cue < CUE_NUMBER; cue++) {
+    webvtt::CueParsingPool::CueBlock block{U"", U"00:00:01.000 --> 00:00:02.000", std::u32string(text)};
+    auto parsedCue = webvtt::CueParsingPool::parseCueBlock(cueParser, block, U"en");
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return {double(allocationNumber.load() - startAllocations) / CUE_NUMBER, elapsed.count() / CUE_NUMBER};
+}
+
+/**
+ * Visitor that walks whole tree and sums length of its texts
+ */
+class TextLengthVisitor : public webvtt::ICueTreeVisitor {
+ public:
+  size_t length = 0;
+
+  void visit(const webvtt::TimeStampObject &) override {}
+  void visit(const webvtt::TextObject &object) override { length += object.getText().size(); }
+  void visit(const webvtt::BoldObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::ItalicObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::ClassObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::RubyObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::RubyTextObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::UnderlineObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::VoiceObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::LanguageObject &object) override { object.visitChildren(*this); }
+  void visit(const webvtt::RootObject &object) override { object.visitChildren(*this); }
+};
+
+/**
+ * Walk tree many times with visitor, and same tree converted to flat tree
+ * @return pair of nanoseconds per node for visitor and for flat tree
+ */
+static std::pair<double, double> measureTraversal(const webvtt::NodeObject &root) {
+  constexpr size_t REPEAT_NUMBER = 20000;
+  webvtt::FlatCueTree flatTree(root);
+  size_t visitorLength = 0;
+  size_t flatLength = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t repeat = 0; repeat < REPEAT_NUMBER; repeat++) {
+    TextLengthVisitor visitor;
+    root.accept(visitor);
+    visitorLength += visitor.length;
+  }
+  auto middle = std::chrono::steady_clock::now();
+  for (size_t repeat = 0; repeat < REPEAT_NUMBER; repeat++)
+    for (const auto &event : flatTree)
+      if (event.type == webvtt::FlatCueTree::EventType::ENTER && event.node->type == webvtt::NodeObject::NodeType::TEXT)
+        flatLength += event.node->text.length;
+  auto end = std::chrono::steady_clock::now();
+
+  if (visitorLength != flatLength)
+    std::cerr << "different traversals: " << visitorLength << " " << flatLength << std::endl;
+
+  double visits = static_cast<double>(REPEAT_NUMBER * flatTree.getNodes().size());
+  std::chrono::duration<double, std::nano> visitorTime = middle - start, flatTime = end - middle;
+  return {visitorTime.count() / visits, flatTime.count() / visits};
+}
+
+int main() {
+  const std::vector<std::pair<std::string, std::u32string>> texts = {
+      {"plain", U"Just some plain text of cue"},
+      {"styled", U"<v Roger>Hello <b>bold <i>and italic</i></b> text</v>"},
+      {"nested", U"<c.a.b><lang en-US><u>one</u> <i>two</i> <ruby>base<rt>text</rt></ruby></lang></c>"},
+      {"karaoke", U"<00:00:01.000>one <00:00:01.250>two <00:00:01.500>three <00:00:01.750>four"},
+  };
+  //Tags with classes are logged, which would be measured with cue
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+  webvtt::CueParser cueParser;
+
+  std::cout << "text\tallocations/cue\tns/cue" << std::endl;
+  for (const auto &[name, text] : texts) {
+    auto [allocations, nanoseconds] = measure(cueParser, text);
+    std::cout << name << "\t" << allocations << "\t" << nanoseconds << std::endl;
+  }
+
+  //Renderer walks trees of all shown cues on every frame
+  constexpr size_t TRAVERSED_TEXT_REPEAT = 50;
+  std::cout << std::endl << "text\tnodes\tvisitor ns/node\tflat ns/node" << std::endl;
+  for (const auto &[name, text] : texts) {
+    webvtt::CueParsingPool::CueBlock block{U"", U"00:00:01.000 --> 00:00:02.000", U""};
+    for (size_t repeat = 0; repeat < TRAVERSED_TEXT_REPEAT; repeat++)
+      block.text += text;
+    auto cue = webvtt::CueParsingPool::parseCueBlock(cueParser, block, U"en");
+
+    const webvtt::NodeObject &root = cue->getTextTreeRoot();
+    auto [visitorNanoseconds, flatNanoseconds] = measureTraversal(root);
+    std::cout << name << "\t" << webvtt::FlatCueTree(root).getNodes().size() << "\t"
+              << visitorNanoseconds << "\t" << flatNanoseconds << std::endl;
+  }
+}
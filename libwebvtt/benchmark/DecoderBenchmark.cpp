@@ -0,0 +1,106 @@
+#include "decoder/UTF8Transcoder.hpp"
+#include "decoder/UTF8ToUTF32StreamDecoder.hpp"
+#include "buffer/StringSyncBuffer.hpp"
+#include "utf8.h"
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Make captions of approximately given size from repeated cues with given text
+ */
+static std::u8string makeCaptions(std::u8string_view text, size_t size) {
+  std::u8string captions = u8"WEBVTT\n\n";
+  while (captions.size() < size) {
+    captions += u8"00:00:01.000 --> 00:00:02.000 line:0 position:50%\n";
+    captions += text;
+    captions += u8"\n\n";
+  }
+  return captions;
+}
+
+/**
+ * Decode input in chunks with given function
+ * @return throughput in GB/s
+ */
+template<typename DecodeFunction>
+static double measure(std::u8string_view input, size_t chunkSize, DecodeFunction decode) {
+  constexpr int REPEAT_NUMBER = 10;
+  size_t decodedNumber = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int repeat = 0; repeat < REPEAT_NUMBER; repeat++)
+    for (size_t position = 0; position < input.size(); position += chunkSize)
+      decodedNumber += decode(input.substr(position, chunkSize));
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if (decodedNumber == 0)
+    std::cerr << "nothing decoded" << std::endl;
+  return static_cast<double>(input.size()) * REPEAT_NUMBER / elapsed.count() / 1e9;
+}
+
+/**
+ * Decode input through UTF8ToUTF32StreamDecoder
+ * @return throughput in GB/s
+ */
+static double measureStreamDecoder(std::u8string_view input) {
+  auto inputStream = std::make_shared<webvtt::StringSyncBuffer<char8_t>>(0);
+  inputStream->writeChunk(input);
+  inputStream->setInputEnded();
+
+  std::vector<char32_t> output(1 << 14);
+  size_t decodedNumber = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  webvtt::UTF8ToUTF32StreamDecoder decoder(inputStream, webvtt::StringBufferType::RING_BUFFER);
+  decoder.startDecoding();
+  auto decodedStream = decoder.getDecodedStream();
+  size_t oneRead;
+  while ((oneRead = decodedStream->readChunk(output)) != 0)
+    decodedNumber += oneRead;
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  if (decodedNumber == 0)
+    std::cerr << "nothing decoded" << std::endl;
+  return static_cast<double>(input.size()) / elapsed.count() / 1e9;
+}
+
+int main() {
+  constexpr size_t CAPTIONS_SIZE = 1 << 24;
+  constexpr size_t CHUNK_SIZE = 1 << 14;
+
+  std::vector<std::pair<std::string, std::u8string>> inputs = {
+      {"ascii", makeCaptions(u8"<v Roger>Hello and welcome to the show, we have a lot to talk about today.</v>",
+                             CAPTIONS_SIZE)},
+      {"cjk", makeCaptions(u8"<v 太郎>こんにちは、今日はたくさん話すことがあります。日本語の字幕です。</v>", CAPTIONS_SIZE)}
+  };
+  std::vector<char32_t> output(CHUNK_SIZE);
+
+  std::cout << "input\timplementation\tGB/s" << std::endl;
+  for (auto &[name, captions] : inputs) {
+    //Validation and conversion as decoder did it before vector implementations
+    double utfcppSpeed = measure(captions, CHUNK_SIZE, [&](std::u8string_view chunk) {
+      auto invalid = utf8::find_invalid(chunk.begin(), chunk.end());
+      return static_cast<size_t>(utf8::utf8to32(chunk.begin(), invalid, output.begin()) - output.begin());
+    });
+    std::cout << name << "\tutfcpp\t" << utfcppSpeed << std::endl;
+
+    for (auto implementation : {webvtt::UTF8Transcoder::Implementation::SCALAR,
+                                webvtt::UTF8Transcoder::Implementation::SSE41,
+                                webvtt::UTF8Transcoder::Implementation::AVX2}) {
+      if (implementation > webvtt::UTF8Transcoder::bestSupported())
+        continue;
+      double speed = measure(captions, CHUNK_SIZE, [&](std::u8string_view chunk) {
+        size_t validLength = webvtt::UTF8Transcoder::validPrefixLength(chunk, implementation);
+        return webvtt::UTF8Transcoder::transcodeValid(chunk.substr(0, validLength), output.data(), implementation);
+      });
+      std::cout << name << "\t" << webvtt::UTF8Transcoder::implementationName(implementation) << "\t" << speed
+                << std::endl;
+    }
+
+    std::cout << name << "\tstream decoder\t" << measureStreamDecoder(captions) << std::endl;
+  }
+}
@@ -0,0 +1,46 @@
+#include "parser/CueParsingPool.hpp"
+#include "parser/object_parser/CueParser.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Build tree of given cue text many times
+ * @return nanoseconds per character reference in text
+ */
+static double measure(webvtt::CueParser &cueParser, std::u32string_view text, size_t referenceNumber) {
+  constexpr size_t CUE_NUMBER = 20000;
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t cue = 0; cue < CUE_NUMBER; cue++) {
+    webvtt::CueParsingPool::CueBlock block{U"", U"00:00:01.000 --> 00:00:02.000", std::u32string(text)};
+    auto parsedCue = webvtt::CueParsingPool::parseCueBlock(cueParser, block, U"");
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(CUE_NUMBER * referenceNumber);
+}
+
+int main() {
+  constexpr size_t REFERENCE_REPEAT = 20;
+  const std::vector<std::pair<std::string, std::u32string>> references = {
+      {"short", U"&amp;&lt;&gt;&nbsp;"},
+      {"long", U"&CounterClockwiseContourIntegral;&DoubleLongLeftRightArrow;"},
+      {"entity heavy", U"&quot;&hellip;&mdash;&eacute;&auml;&rarr;&frac12;&copy;"},
+      {"not found", U"&xyz &unknown "},
+  };
+  //References that are parsing errors are logged, so only valid or plainly unmatched ones are measured
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+  webvtt::CueParser cueParser;
+
+  std::cout << "references\tns/reference" << std::endl;
+  for (const auto &[name, reference] : references) {
+    std::u32string text;
+    for (size_t repeat = 0; repeat < REFERENCE_REPEAT; repeat++)
+      text += reference + U"text ";
+    //Every & starts one reference
+    size_t referenceNumber = std::count(text.begin(), text.end(), U'&');
+    std::cout << name << "\t" << measure(cueParser, text, referenceNumber) << std::endl;
+  }
+}
@@ -0,0 +1,95 @@
+#include "parser/Parser.hpp"
+#include "parser/InputPreprocessor.hpp"
+#include "buffer/StringSyncBuffer.hpp"
+#include "logger/LoggingUtility.hpp"
+#include "utf8.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Read whole file and decode it
+ */
+static std::u32string readFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::u32string decoded;
+  utf8::utf8to32(content.begin(), content.end(), std::back_inserter(decoded));
+  return decoded;
+}
+
+/**
+ * Preprocess input split in two chunks at given offset, so CR LF pair can be split between chunks
+ */
+static std::u32string preprocess(std::u32string_view input, size_t splitOffset) {
+  webvtt::InputPreprocessor preprocessor;
+  std::u32string output(input.size(), U'\0');
+  size_t length = preprocessor.process(input.substr(0, splitOffset), output.data());
+  length += preprocessor.process(input.substr(splitOffset), output.data() + length);
+  output.resize(length);
+  return output;
+}
+
+/**
+ * Parse preprocessed input with stream parser
+ * @return one line for every parsed cue, region and style sheet
+ */
+static std::vector<std::u32string> parseStream(const std::u32string &input) {
+  auto inputStream = std::make_shared<webvtt::StringSyncBuffer<char32_t>>(0);
+  inputStream->writeChunk(input);
+  inputStream->setInputEnded();
+
+  webvtt::Parser parser(inputStream);
+  parser.startParsing();
+  auto cues = parser.getCueBuffer();
+  while (!cues->isInputEnded())
+    std::this_thread::yield();
+
+  std::vector<std::u32string> parsed;
+  cues->setReadPositionToBeginning();
+  while (auto cue = cues->readOne()) {
+    std::string times = std::to_string(cue->getStartTime()) + " " + std::to_string(cue->getEndTime()) + " ";
+    parsed.push_back(std::u32string(cue->getIdentifier()) + U" " + std::u32string(times.begin(), times.end())
+                         + std::u32string(cue->getText()));
+  }
+  auto regions = parser.getRegionBuffer();
+  regions->setReadPositionToBeginning();
+  while (auto region = const_cast<webvtt::Region *>(regions->readOne()))
+    parsed.push_back(U"REGION " + std::u32string(region->getIdentifier()));
+  auto styleSheets = parser.getStyleSheetBuffer();
+  styleSheets->setReadPositionToBeginning();
+  while (styleSheets->readOne())
+    parsed.emplace_back(U"STYLE");
+  return parsed;
+}
+
+int main(int argc, char **argv) {
+  std::string directory = argc > 1 ? argv[1] : "example";
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+
+  auto expected = parseStream(preprocess(readFile(directory + "/sample.vtt"), 0));
+  bool isEqual = !expected.empty();
+
+  std::cout << "file\tsplits\tmismatches\tms per split" << std::endl;
+  for (const std::string name : {"sample.vtt", "sample_cr.vtt", "sample_crlf.vtt"}) {
+    std::u32string input = readFile(directory + "/" + name);
+    size_t mismatchNumber = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t splitOffset = 0; splitOffset <= input.size(); splitOffset++) {
+      if (parseStream(preprocess(input, splitOffset)) != expected)
+        mismatchNumber++;
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << name << "\t" << input.size() + 1 << "\t" << mismatchNumber << "\t"
+              << elapsed.count() / static_cast<double>(input.size() + 1) << std::endl;
+    isEqual = isEqual && mismatchNumber == 0 && !input.empty();
+  }
+  return isEqual ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+#include "parser/Parser.hpp"
+#include "elements/style_matching/ComputedStyleCache.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Make file with given number of style blocks and one cue with given text
+ */
+static std::u8string makeFile(size_t styleNumber, std::u8string_view cueText) {
+  const std::vector<std::u8string> selectors = {
+      u8"::cue(.yellow)", u8"::cue(c.big > b)", u8"::cue(v[voice=\"Roger\"] i)", u8"::cue(.a.b)",
+      u8"::cue(lang u)", u8"::cue(i + b)", u8"::cue(ruby rt)", u8"::cue(.red ~ .small)",
+  };
+  std::u8string file = u8"WEBVTT\n\nNOTE styles\n\n";
+  for (size_t style = 0; style < styleNumber; style++) {
+    std::u8string className = u8".s" + std::u8string(1, char8_t(u8'a' + style % 26));
+    std::u8string selector = selectors[style % selectors.size()];
+    if (style >= selectors.size())
+      selector.insert(selector.size() - 1, className);
+    file += u8"STYLE\n" + selector + u8" {\n  color: yellow;\n}\n\n";
+  }
+  file += u8"00:00:01.000 --> 00:00:02.000\n";
+  file += cueText;
+  file += u8"\n";
+  return file;
+}
+
+struct Measurement {
+  size_t matchedNumber = 0;
+  double matchingNanoseconds = 0;
+  double resolvingNanoseconds = 0;
+};
+
+/**
+ * Match all nodes of cue many times, then resolve their styles with cache many times
+ * @return nanoseconds per node and number of matched sheets in one traversal
+ */
+static Measurement measure(size_t styleNumber, std::u8string_view cueText) {
+  constexpr size_t REPEAT_NUMBER = 20000;
+
+  webvtt::Parser parser;
+  parser.parseAll(makeFile(styleNumber, cueText));
+  webvtt::CueStyleMatcher matcher;
+  auto styleSheets = parser.getStyleSheetBuffer();
+  styleSheets->setReadPositionToBeginning();
+  while (auto styleSheet = styleSheets->readOne())
+    matcher.addStyleSheet(*styleSheet);
+  auto cues = parser.getCueBuffer();
+  cues->setReadPositionToBeginning();
+  auto cue = cues->readOne();
+
+  webvtt::CueStyleMatcher::MatchedRules matchedRules;
+  size_t matchedNumber = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t repeat = 0; repeat < REPEAT_NUMBER; repeat++) {
+    matcher.match(*cue, matchedRules);
+    matchedNumber = 0;
+    for (const auto &nodeRules : matchedRules.getNodes())
+      matchedNumber += nodeRules.length;
+  }
+  auto middle = std::chrono::steady_clock::now();
+
+  webvtt::ComputedStyleCache styleCache(matcher);
+  std::vector<webvtt::ComputedStyleCache::NodeStyle> nodeStyles;
+  for (size_t repeat = 0; repeat < REPEAT_NUMBER; repeat++)
+    styleCache.resolve(*cue, nodeStyles);
+  auto end = std::chrono::steady_clock::now();
+
+  double visits = static_cast<double>(REPEAT_NUMBER * matchedRules.getNodes().size());
+  std::chrono::duration<double, std::nano> matchingTime = middle - start, resolvingTime = end - middle;
+  return {matchedNumber, matchingTime.count() / visits, resolvingTime.count() / visits};
+}
+
+/**
+ * Cue with timing line and no text has no tree, so it has to be matched and resolved to no nodes
+ * @return true if no node is reported
+ */
+static bool checkEmptyCue() {
+  webvtt::Parser parser;
+  parser.parseAll(makeFile(8, u8""));
+  webvtt::CueStyleMatcher matcher;
+  auto styleSheets = parser.getStyleSheetBuffer();
+  styleSheets->setReadPositionToBeginning();
+  while (auto styleSheet = styleSheets->readOne())
+    matcher.addStyleSheet(*styleSheet);
+  auto cues = parser.getCueBuffer();
+  cues->setReadPositionToBeginning();
+  auto cue = cues->readOne();
+  if (cue == nullptr)
+    return false;
+
+  webvtt::CueStyleMatcher::MatchedRules matchedRules;
+  matcher.match(*cue, matchedRules);
+  webvtt::ComputedStyleCache styleCache(matcher);
+  std::vector<webvtt::ComputedStyleCache::NodeStyle> nodeStyles;
+  styleCache.resolve(*cue, nodeStyles);
+  return matchedRules.getNodes().empty() && nodeStyles.empty();
+}
+
+int main() {
+  const std::u8string cueText =
+      u8"<v Roger><c.big.yellow><b>Hello</b> <i>and</i> <b.sa>you</b></c></v> "
+      u8"<lang en><u>one</u> <c.red>two</c> <c.small.a.b>three</c></lang> <ruby>base<rt>text</rt></ruby>";
+  //Sheets with unsupported selectors are logged, which would be measured with matching
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+
+  if (!checkEmptyCue()) {
+    std::cout << "Cue with empty text is matched to nodes" << std::endl;
+    return 1;
+  }
+
+  std::cout << "sheets\tmatched\tmatching ns/node\tcached style ns/node" << std::endl;
+  for (size_t styleNumber : {8, 64, 512}) {
+    auto measurement = measure(styleNumber, cueText);
+    std::cout << styleNumber << "\t" << measurement.matchedNumber << "\t" << measurement.matchingNanoseconds
+              << "\t" << measurement.resolvingNanoseconds << std::endl;
+  }
+}
@@ -0,0 +1,51 @@
+#ifndef LIBWEBVTT_INCLUDE_BUFFER_CUE_SYNC_BUFFER_HPP_
+#define LIBWEBVTT_INCLUDE_BUFFER_CUE_SYNC_BUFFER_HPP_
+
+#include "buffer/UniquePtrSyncBuffer.hpp"
+#include "buffer/CueTimeIndex.hpp"
+#include "elements/webvtt_objects/Cue.hpp"
+#include <optional>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Buffer of parsed cues that also indexes cues by time as they are written.
+ * Time queries can be used while parsing is still in progress,
+ * and then answer only for cues written so far.
+ */
+class CueSyncBuffer : public UniquePtrSyncBuffer<Cue> {
+
+ public:
+  CueSyncBuffer() = default;
+  CueSyncBuffer(const CueSyncBuffer &) = delete;
+  CueSyncBuffer(CueSyncBuffer &&) = delete;
+  CueSyncBuffer &operator=(const CueSyncBuffer &) = delete;
+  CueSyncBuffer &operator=(CueSyncBuffer &&) = delete;
+  ~CueSyncBuffer() override = default;
+
+  bool writeOne(std::unique_ptr<Cue> oneElem) override;
+  void clearBuffer() override;
+
+  /**
+   * @see CueTimeIndex::activeAt
+   */
+  [[nodiscard]] std::vector<const Cue *> activeAt(TimeStamp time) const;
+
+  /**
+   * @see CueTimeIndex::overlapping
+   */
+  [[nodiscard]] std::vector<const Cue *> overlapping(TimeStamp startTime, TimeStamp endTime) const;
+
+  /**
+   * @see CueTimeIndex::nextChangeAfter
+   */
+  [[nodiscard]] std::optional<TimeStamp> nextChangeAfter(TimeStamp time) const;
+
+ private:
+  CueTimeIndex index;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_BUFFER_CUE_SYNC_BUFFER_HPP_
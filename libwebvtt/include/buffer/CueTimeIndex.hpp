@@ -0,0 +1,79 @@
+#ifndef LIBWEBVTT_INCLUDE_BUFFER_CUE_TIME_INDEX_HPP_
+#define LIBWEBVTT_INCLUDE_BUFFER_CUE_TIME_INDEX_HPP_
+
+#include "elements/webvtt_objects/Cue.hpp"
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Index of cues by their timing, to find cues shown at some time without scanning all cues.
+ * Cues are kept sorted by start time, with tree of maximal end times over them.
+ * Adding cue in start time order is amortized O(log n), other cues need O(n).
+ * Cue is active in interval [start time, end time).
+ */
+class CueTimeIndex {
+
+ public:
+  CueTimeIndex() = default;
+  CueTimeIndex(const CueTimeIndex &) = delete;
+  CueTimeIndex(CueTimeIndex &&) = delete;
+  CueTimeIndex &operator=(const CueTimeIndex &) = delete;
+  CueTimeIndex &operator=(CueTimeIndex &&) = delete;
+  ~CueTimeIndex() = default;
+
+  /**
+   * Add cue to index, cue need to outlive index
+   */
+  void add(const Cue &cue);
+
+  /**
+   * @return cues active at given time, ordered by start time
+   */
+  [[nodiscard]] std::vector<const Cue *> activeAt(TimeStamp time) const;
+
+  /**
+   * @return cues active at any time in interval [startTime, endTime), ordered by start time
+   */
+  [[nodiscard]] std::vector<const Cue *> overlapping(TimeStamp startTime, TimeStamp endTime) const;
+
+  /**
+   * @return first time after given time at which some cue starts or ends, empty if there is none
+   */
+  [[nodiscard]] std::optional<TimeStamp> nextChangeAfter(TimeStamp time) const;
+
+  [[nodiscard]] size_t size() const;
+  void clear();
+
+ private:
+  struct Entry {
+    TimeStamp startTime;
+    TimeStamp endTime;
+    const Cue *cue;
+  };
+
+  constexpr static size_t MIN_CAPACITY = 64;
+
+  //Sorted by start time, cues with same start time are in order of adding
+  std::vector<Entry> entries;
+  //Sorted end times of all cues
+  std::vector<TimeStamp> endTimes;
+
+  //Complete binary tree over entries, node has maximal end time of its leaves, root is at index 1
+  std::vector<TimeStamp> maxEndTree;
+  size_t capacity = 0;
+
+  void rebuildTree();
+  void updateTree(size_t entryIndex);
+
+  /**
+   * Collect cues among first entries that end after given time
+   */
+  void collect(size_t entryNumber, TimeStamp time, std::vector<const Cue *> &result) const;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_BUFFER_CUE_TIME_INDEX_HPP_
@@ -0,0 +1,60 @@
+#ifndef LIBWEBVTT_INCLUDE_BUFFER_MAPPED_FILE_BUFFER_HPP_
+#define LIBWEBVTT_INCLUDE_BUFFER_MAPPED_FILE_BUFFER_HPP_
+
+#include <string>
+#include <string_view>
+#include "buffer/StringBuffer.hpp"
+
+namespace webvtt {
+
+/**
+ * Read only buffer over memory mapped file. Whole file is available from the start,
+ * so input is always ended and reading never blocks.
+ * Content can be given directly to Parser::parseAll, without copying it.
+ */
+class MappedFileBuffer : public StringBuffer<char8_t> {
+ public:
+  /**
+   * Map file into memory
+   * @param path path to file
+   * @throw FileMappingError if file can't be opened or mapped
+   */
+  explicit MappedFileBuffer(const std::string &path);
+
+  MappedFileBuffer(const MappedFileBuffer &) = delete;
+  MappedFileBuffer(MappedFileBuffer &&) = delete;
+  MappedFileBuffer &operator=(const MappedFileBuffer &) = delete;
+  MappedFileBuffer &operator=(MappedFileBuffer &&) = delete;
+  virtual ~MappedFileBuffer();
+
+  /**
+   * @return view of whole file content, valid while buffer exists
+   */
+  [[nodiscard]] std::u8string_view getContent() const;
+
+  bool isInputEnded() override;
+  void setInputEnded() override;
+  bool isReadDone() override;
+
+  std::optional<char8_t> peekOne() override;
+
+  size_t readChunk(std::span<char8_t> output) override;
+  void readUntilSpecificData(std::u8string &output, const char8_t &specificData) override;
+  using StringBuffer<char8_t>::readUntilSpecificData;
+
+  bool setReadPosition(size_t position) override;
+  void clearBufferUntilReadPosition() override;
+  void resetBuffer() override;
+
+ protected:
+  std::optional<char8_t> readOne() override;
+  bool writeOne(const char8_t &elem) override;
+
+ private:
+  void *mapping = nullptr;
+  std::u8string_view content;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_BUFFER_MAPPED_FILE_BUFFER_HPP_
@@ -13,6 +13,17 @@ class NonSyncStringBuffer : public StringBuffer<OneElemType> {
 
   std::optional <OneElemType> peekOne() override;
 
+  bool writeChunk(std::span<const OneElemType> input) override;
+  size_t readChunk(std::span<OneElemType> output) override;
+
+  void readUntilSpecificData(std::basic_string<OneElemType> &output, const OneElemType &specificData) override;
+  using StringBuffer<OneElemType>::readUntilSpecificData;
+
+  /**
+   * Erase read data when it is at least half of the buffer, so repeated calls stay linear.
+   */
+  void clearBufferUntilReadPosition() override;
+
  protected:
 
   std::optional <OneElemType> readOne() override;
@@ -25,5 +36,5 @@ class NonSyncStringBuffer : public StringBuffer<OneElemType> {
 /**
  * Include sync buffer implementation
  */
-#include "templates/buffer/NonSyncBuffer.tpp"
+#include "templates/buffer/NonSyncStringBuffer.tpp"
 #endif // LIBWEBVTT_INCLUDE_BUFFER_NON_SYNC_BUFFER_HPP_
@@ -2,12 +2,16 @@
 #define LIBWEBVTT_INCLUDE_BUFFER_I_STRING_BUFFER_HPP_
 #include <optional>
 #include <string>
+#include <span>
+#include <cstdint>
 
 namespace webvtt {
 
 template<typename OneElemType>
 class StringBuffer {
  public:
+  virtual ~StringBuffer() = default;
+
   virtual bool isInputEnded() = 0;
   virtual void setInputEnded() = 0;
   virtual bool isReadDone() = 0;
@@ -20,7 +24,30 @@ class StringBuffer {
   virtual bool writeMultiple(const std::basic_string<OneElemType> &input);
   virtual std::basic_string<OneElemType> readMultiple(uint32_t number);
 
+  /**
+   * Append contiguous range of elements to the buffer as one batch.
+   * @param input elements to be written
+   * @return false if input already ended
+   */
+  virtual bool writeChunk(std::span<const OneElemType> input);
+
+  /**
+   * Read up to output.size() elements into caller buffer.
+   * Blocks until at least one element is available or input is ended.
+   * @param output buffer in which read elements are stored
+   * @return number of read elements, 0 if all data is read
+   */
+  virtual size_t readChunk(std::span<OneElemType> output);
+
   virtual std::basic_string<OneElemType> readUntilSpecificData(const OneElemType &specificData);
+
+  /**
+   * Append elements to output until specific data is reached or all data is read.
+   * Specific data is not read.
+   * @param output string to which read elements are appended
+   * @param specificData element on which reading stops
+   */
+  virtual void readUntilSpecificData(std::basic_string<OneElemType> &output, const OneElemType &specificData);
   virtual std::basic_string<OneElemType> readWhileSpecificData(const OneElemType &specificData);
 
   virtual std::optional<OneElemType> isReadDoneAndAdvancedIfNot();
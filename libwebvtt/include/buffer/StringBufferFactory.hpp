@@ -0,0 +1,32 @@
+#ifndef LIBWEBVTT_INCLUDE_BUFFER_STRING_BUFFER_FACTORY_HPP_
+#define LIBWEBVTT_INCLUDE_BUFFER_STRING_BUFFER_FACTORY_HPP_
+
+#include <memory>
+#include "buffer/StringBuffer.hpp"
+
+namespace webvtt {
+
+/**
+ * Implementation used for buffers between pipeline stages
+ */
+enum class StringBufferType {
+  SYNC_BUFFER,
+  RING_BUFFER
+};
+
+/**
+ * Make empty buffer of given type
+ * @param type implementation of buffer
+ * @return pointer to new buffer
+ */
+template<typename OneElemType>
+std::unique_ptr<StringBuffer<OneElemType>> makeStringBuffer(StringBufferType type);
+
+} // namespace webvtt
+
+/**
+ * Include factory implementation
+ */
+#include "templates/buffer/StringBufferFactory.tpp"
+
+#endif // LIBWEBVTT_INCLUDE_BUFFER_STRING_BUFFER_FACTORY_HPP_
@@ -0,0 +1,134 @@
+#ifndef LIBWEBVTT_INCLUDE_BUFFER_STRING_RING_BUFFER_HPP_
+#define LIBWEBVTT_INCLUDE_BUFFER_STRING_RING_BUFFER_HPP_
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include "buffer/StringBuffer.hpp"
+
+namespace webvtt {
+
+/**
+ * Bounded lock-free buffer for exactly one producer thread and one consumer thread.
+ * Writer blocks while the ring is full, reader blocks while it is empty.
+ * Read data is handed back to the writer in batches. Position returned by getReadPosition
+ * is retained until next getReadPosition or clearBufferUntilReadPosition call,
+ * so setReadPosition can go back to it. If retained data fills the whole ring, writer doubles the ring.
+ */
+template<typename OneElemType>
+class StringRingBuffer : public StringBuffer<OneElemType> {
+ public:
+  /**
+   * @param minimalCapacity minimal number of elements ring can hold, rounded up to power of two
+   */
+  explicit StringRingBuffer(size_t minimalCapacity = DEFAULT_CAPACITY);
+
+  StringRingBuffer(const StringRingBuffer &) = delete;
+  StringRingBuffer(StringRingBuffer &&) = delete;
+  StringRingBuffer &operator=(const StringRingBuffer &) = delete;
+  StringRingBuffer &operator=(StringRingBuffer &&) = delete;
+  virtual ~StringRingBuffer() = default;
+
+  bool isInputEnded() override;
+  void setInputEnded() override;
+  bool isReadDone() override;
+
+  std::optional<OneElemType> peekOne() override;
+
+  bool writeMultiple(const std::basic_string<OneElemType> &input) override;
+  std::basic_string<OneElemType> readMultiple(uint32_t number) override;
+
+  bool writeChunk(std::span<const OneElemType> input) override;
+  size_t readChunk(std::span<OneElemType> output) override;
+
+  void readUntilSpecificData(std::basic_string<OneElemType> &output, const OneElemType &specificData) override;
+  std::basic_string<OneElemType> readWhileSpecificData(const OneElemType &specificData) override;
+
+  size_t getReadPosition() override;
+  bool setReadPosition(size_t position) override;
+
+  void clearBufferUntilReadPosition() override;
+  void resetBuffer() override;
+
+  using StringBuffer<OneElemType>::readUntilSpecificData;
+
+ protected:
+
+  bool writeOne(const OneElemType &elem) override;
+  std::optional<OneElemType> readOne() override;
+
+ private:
+  constexpr static size_t DEFAULT_CAPACITY = 1 << 16;
+  constexpr static size_t CACHE_LINE_SIZE = 64;
+
+  //Changed only by producer while consumer waits for the ring to grow
+  size_t capacity;
+  size_t mask;
+  std::unique_ptr<OneElemType[]> ring;
+
+  std::atomic<bool> ended = false;
+
+  //Written only by producer
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> writePosition = 0;
+  size_t cachedReleasedPosition = 0;
+
+  //Written only by consumer
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> releasedPosition = 0;
+  size_t cachedWritePosition = 0;
+  size_t retainedPosition = 0;
+  bool positionRetained = false;
+
+  //Used only when one side need to sleep
+  alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> dataEvents = 0;
+  std::atomic<uint32_t> spaceEvents = 0;
+  std::atomic<bool> readerWaiting = false;
+  std::atomic<bool> writerWaiting = false;
+
+  enum class GrowState : uint8_t {
+    NONE,
+    REQUESTED,
+    GROWING
+  };
+  std::atomic<GrowState> growState = GrowState::NONE;
+
+  static size_t roundCapacity(size_t minimalCapacity);
+
+  /**
+   * Block until there is unread data or input is ended.
+   * @return number of elements available for reading, 0 if all data is read
+   */
+  size_t waitForData();
+
+  /**
+   * Block until there is free space in ring or input is ended.
+   * @return number of elements that can be written, 0 if input is ended
+   */
+  size_t waitForSpace();
+
+  /**
+   * Double the ring, keeping unreleased data. Called by producer when consumer requested it.
+   */
+  void grow();
+
+  /**
+   * Wait until producer finishes growing or cancel not started request. Called by consumer.
+   */
+  void cancelGrowing();
+
+  /**
+   * Give read elements back to producer.
+   * @param force if false, elements are given back only in batches of quarter of capacity
+   */
+  void releaseReadData(bool force);
+
+  static void signal(std::atomic<uint32_t> &events, std::atomic<bool> &waiting);
+};
+
+} // namespace webvtt
+
+/**
+ * Include ring buffer implementation
+ */
+#include "templates/buffer/StringRingBuffer.tpp"
+
+#endif // LIBWEBVTT_INCLUDE_BUFFER_STRING_RING_BUFFER_HPP_
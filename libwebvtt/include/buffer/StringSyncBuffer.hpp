@@ -11,6 +11,14 @@ namespace webvtt {
 template<typename OneElemType>
 class StringSyncBuffer : public StringBuffer<OneElemType> {
  public:
+  constexpr static size_t DEFAULT_HIGH_WATER_MARK = 1 << 16;
+
+  /**
+   * @param highWaterMark number of unread elements after which writers block until reader consume data.
+   * Retained data is not counted, so buffer can grow past it while position is retained. If 0, buffer is unbounded
+   */
+  explicit StringSyncBuffer(size_t highWaterMark = DEFAULT_HIGH_WATER_MARK);
+
   bool isInputEnded() override;
   void setInputEnded() override;
   bool isReadDone() override;
@@ -23,7 +31,11 @@ class StringSyncBuffer : public StringBuffer<OneElemType> {
   bool writeMultiple(const std::basic_string<OneElemType> &input) override;
   std::basic_string<OneElemType> readMultiple(uint32_t number) override;
 
+  bool writeChunk(std::span<const OneElemType> input) override;
+  size_t readChunk(std::span<OneElemType> output) override;
+
   std::basic_string<OneElemType> readUntilSpecificData(const OneElemType &specificData) override;
+  void readUntilSpecificData(std::basic_string<OneElemType> &output, const OneElemType &specificData) override;
   std::basic_string<OneElemType> readWhileSpecificData(const OneElemType &specificData) override;
 
   std::optional<OneElemType> isReadDoneAndAdvancedIfNot() override;
@@ -41,10 +53,47 @@ class StringSyncBuffer : public StringBuffer<OneElemType> {
 
   std::mutex mutex;
   std::condition_variable emptyCV;
+  std::condition_variable fullCV;
 
   std::mutex mutexWrite;
   std::mutex mutexRead;
 
+  size_t highWaterMark;
+
+  //Number of elements erased from beginning of buffer, read positions are given relative to whole stream
+  size_t discardedLength = 0;
+
+  //Position returned by getReadPosition is kept in buffer, so it can be set again
+  size_t retainedPosition = 0;
+  bool positionRetained = false;
+
+  /**
+   * @return position in buffer before which data can be erased
+   */
+  size_t releasablePosition() const;
+  bool isFull() const;
+
+  /**
+   * Block until there is unread data or input is ended. Mutex need to be locked.
+   * @param lock lock on mutex
+   */
+  void waitForData(std::unique_lock<std::mutex> &lock);
+
+  /**
+   * Block until data can be written or input is ended. Mutex need to be locked.
+   * @param lock lock on mutex
+   */
+  void waitForSpace(std::unique_lock<std::mutex> &lock);
+
+  /**
+   * Notify writer that data is consumed
+   */
+  void notifyConsumed();
+
+  /**
+   * Erase consumed prefix of buffer when it is at least half of the buffer.
+   */
+  void compact();
 };
 
 } // end of namespace
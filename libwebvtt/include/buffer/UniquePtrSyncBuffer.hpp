@@ -1,15 +1,32 @@
 #ifndef LIBWEBVTT_INCLUDE_BUFFER_UNIQUE_PTR_SYNC_BUFFER_HPP_
 #define LIBWEBVTT_INCLUDE_BUFFER_UNIQUE_PTR_SYNC_BUFFER_HPP_
+#include <atomic>
 #include <memory>
 #include <list>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
+#include <string>
+#include <unordered_map>
 
 namespace webvtt {
 
 template<typename Elem>
 class UniquePtrSyncBuffer {
  public:
+  UniquePtrSyncBuffer() = default;
+  UniquePtrSyncBuffer(const UniquePtrSyncBuffer &) = delete;
+  UniquePtrSyncBuffer(UniquePtrSyncBuffer &&) = delete;
+  UniquePtrSyncBuffer &operator=(const UniquePtrSyncBuffer &) = delete;
+  UniquePtrSyncBuffer &operator=(UniquePtrSyncBuffer &&) = delete;
+  virtual ~UniquePtrSyncBuffer() = default;
+
+  /**
+   * Find element by identifier, if more elements have same identifier last written one is found.
+   * Index is built by first lookups, so buffers that are never searched, like cue buffer, don't have it.
+   * Lookup does not lock buffer once input is ended and indexed, so it must not run concurrently with clearBuffer.
+   * @return found element or null
+   */
   const Elem *getElemByID(std::u32string_view id) const;
 
   virtual const Elem *readOne();
@@ -23,10 +40,22 @@ class UniquePtrSyncBuffer {
   void setInputEnded();
   bool isReadDone();
 
-  void clearBuffer();
+  /**
+   * @return number of written elements, including already read ones
+   */
+  size_t size() const;
+
+  virtual void clearBuffer();
   void setReadPositionToBeginning();
 
  protected:
+  /**
+   * Hash of identifiers, which allows lookup by view
+   */
+  struct IDHash {
+    using is_transparent = void;
+    size_t operator()(std::u32string_view id) const { return std::hash<std::u32string_view>{}(id); }
+  };
 
   mutable std::mutex mutex;
   std::condition_variable emptyCV;
@@ -34,9 +63,35 @@ class UniquePtrSyncBuffer {
   std::mutex mutexWrite;
 
   std::list<std::unique_ptr<Elem>> buffer;
-  typename std::list<std::unique_ptr<Elem>>::const_iterator readPosition;
+  typename std::list<std::unique_ptr<Elem>>::const_iterator readPosition = buffer.begin();
+
+  //Elements by identifier, covering elements before first not indexed one.
+  //Index is updated only on lookup, so writing stays cheap and buffers that are never searched have no index.
+  mutable std::unordered_map<std::u32string, const Elem *, IDHash, std::equal_to<>> elemsByID;
+  mutable typename std::list<std::unique_ptr<Elem>>::const_iterator firstNotIndexed = buffer.begin();
+
+  //Set by first lookup after end of input, when index covers all elements
+  mutable std::atomic<bool> indexComplete = false;
+
+  std::atomic<bool> inputEnded = false;
+
+  /**
+   * Append element and move read and index positions to it if they are at end.
+   * Mutex need to be locked.
+   */
+  void pushBack(std::unique_ptr<Elem> oneElem);
+
+  /**
+   * Delete all elements and index, and reset positions and end of input.
+   * Mutex need to be locked.
+   */
+  void clearElements();
 
-  bool inputEnded = false;
+  /**
+   * Add all not indexed elements to identifier index.
+   * Mutex need to be locked.
+   */
+  void indexRemaining() const;
 
 };
 
@@ -2,7 +2,7 @@
 #define LIBWEBVTT_INCLUDE_DECODER_UTF8_TO_UTF32_STREAM_DECODER_HPP_
 
 #include "buffer/StringBuffer.hpp"
-#include "buffer/StringSyncBuffer.hpp"
+#include "buffer/StringBufferFactory.hpp"
 #include <memory>
 #include <string>
 #include <thread>
@@ -14,8 +14,12 @@ namespace webvtt {
 class UTF8ToUTF32StreamDecoder {
 
  public:
+  /**
+   * @param inputStream buffer with utf8 bytes
+   * @param outputBufferType implementation of buffer in which decoded data is written
+   */
   explicit UTF8ToUTF32StreamDecoder(std::shared_ptr<StringBuffer < char8_t>>
-  inputStream);
+  inputStream, StringBufferType outputBufferType = StringBufferType::SYNC_BUFFER);
 
   UTF8ToUTF32StreamDecoder() = default;
   UTF8ToUTF32StreamDecoder(const UTF8ToUTF32StreamDecoder &) = delete;
@@ -35,24 +39,24 @@ class UTF8ToUTF32StreamDecoder {
    *
    * @return Pointer to buffer that contain decoded data
    */
-  std::shared_ptr<StringSyncBuffer < char32_t>> getDecodedStream();
+  std::shared_ptr<StringBuffer < char32_t>> getDecodedStream();
 
  private:
-  constexpr static int DEFAULT_READ_NUMBER = 10;
+  constexpr static size_t DEFAULT_READ_NUMBER = 1 << 14;
   bool decodingStarted = false;
 
   std::shared_ptr<StringBuffer < char8_t>> inputStream;
-  std::shared_ptr<StringSyncBuffer < char32_t>> outputStream;
+  std::shared_ptr<StringBuffer < char32_t>> outputStream;
 
   std::unique_ptr<std::thread> decoderThread;
 
   /**
-   * Try to convert given string to utf32 string.
-   * Part of string that is successfully converted are erased.
-   * @param readBytes string to be converted
-   * @return
+   * Convert longest valid prefix of read bytes to utf32.
+   * @param readBytes bytes to be converted
+   * @param output must have space for readBytes.size() characters
+   * @return number of converted bytes and number of written characters
    */
-  static std::u32string decodeReadBytes(std::u8string &readBytes);
+  static std::pair<size_t, size_t> decodeReadBytes(std::u8string_view readBytes, char32_t *output);
 
   /**
    * Use as run method for thread that is decoding input stream.
@@ -0,0 +1,64 @@
+#ifndef LIBWEBVTT_INCLUDE_DECODER_UTF8_TRANSCODER_HPP_
+#define LIBWEBVTT_INCLUDE_DECODER_UTF8_TRANSCODER_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+namespace webvtt {
+
+/**
+ * Validation of utf8 text and conversion of valid utf8 to utf32.
+ * Implementation is selected at runtime: AVX2 or SSE4.1 if CPU supports it,
+ * otherwise scalar one.
+ */
+class UTF8Transcoder {
+
+ public:
+  /**
+   * Implementations ordered from least to most capable
+   */
+  enum class Implementation {
+    SCALAR,
+    SSE41,
+    AVX2
+  };
+
+  /**
+   * Maximal number of bytes in one utf8 sequence
+   */
+  constexpr static size_t MAX_SEQUENCE_LENGTH = 4;
+
+  UTF8Transcoder() = delete;
+
+  /**
+   * @return most capable implementation supported by CPU
+   */
+  static Implementation bestSupported();
+
+  /**
+   * @return name of implementation, for logging and benchmarks
+   */
+  static std::string_view implementationName(Implementation implementation);
+
+  /**
+   * Find longest prefix of input made only of complete and valid utf8 sequences.
+   * Sequence split at the end of input is not part of prefix, so unconsumed bytes
+   * can be prepended to next chunk of stream.
+   * @param input utf8 bytes
+   * @return length of prefix in bytes
+   */
+  static size_t validPrefixLength(std::u8string_view input);
+  static size_t validPrefixLength(std::u8string_view input, Implementation implementation);
+
+  /**
+   * Convert utf8 that is already validated to utf32
+   * @param input valid utf8, for example prefix found with validPrefixLength
+   * @param output must have space for at least input.size() characters
+   * @return number of written characters
+   */
+  static size_t transcodeValid(std::u8string_view input, char32_t *output);
+  static size_t transcodeValid(std::u8string_view input, char32_t *output, Implementation implementation);
+};
+}
+
+#endif // LIBWEBVTT_INCLUDE_DECODER_UTF8_TRANSCODER_HPP_
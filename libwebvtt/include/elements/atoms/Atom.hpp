@@ -0,0 +1,81 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_ATOMS_ATOM_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_ATOMS_ATOM_HPP_
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace webvtt {
+
+/**
+ * String interned in global table, so equal strings are one atom and are compared as integers.
+ * Table is shared by all parsers and is thread safe. Interned strings are released only by clear,
+ * so table grows with every distinct class, voice and language name parsed in the process.
+ * Empty string is empty atom, with id 0.
+ */
+template<typename Character>
+class BasicAtom {
+ public:
+  using StringView = std::basic_string_view<Character>;
+
+  constexpr BasicAtom() = default;
+
+  /**
+   * @return atom of string, string is added to table if it is not there
+   */
+  static BasicAtom intern(StringView string);
+
+  /**
+   * @return atom of string if it is in table, otherwise empty atom
+   */
+  static BasicAtom find(StringView string);
+
+  /**
+   * Release all interned strings, atoms made before are invalid after it.
+   * Parsed cues, style sheets, matchers and style caches made before have to be destroyed,
+   * and no other thread can use atoms meanwhile.
+   */
+  static void clear();
+
+  /**
+   * @return number of interned strings
+   */
+  static size_t getInternedNumber();
+
+  [[nodiscard]] StringView getString() const { return entry != nullptr ? StringView(entry->string) : StringView(); }
+  [[nodiscard]] uint32_t getId() const { return entry != nullptr ? entry->id : 0; }
+  [[nodiscard]] bool empty() const { return entry == nullptr; }
+
+  friend bool operator==(BasicAtom first, BasicAtom second) { return first.entry == second.entry; }
+  friend std::strong_ordering operator<=>(BasicAtom first, BasicAtom second) {
+    return first.getId() <=> second.getId();
+  }
+
+  struct Hash {
+    size_t operator()(BasicAtom atom) const { return atom.getId(); }
+  };
+
+ private:
+  struct Entry {
+    std::basic_string<Character> string;
+    uint32_t id;
+  };
+  class Table;
+
+  const Entry *entry = nullptr;
+
+  explicit BasicAtom(const Entry *entry) : entry(entry) {}
+  static Table &getTable();
+};
+
+/**
+ * Atom of cue text, like class, voice or language
+ */
+using Atom = BasicAtom<char32_t>;
+
+} // namespace webvtt
+#include "templates/elements/atoms/Atom.tpp"
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_ATOMS_ATOM_HPP_
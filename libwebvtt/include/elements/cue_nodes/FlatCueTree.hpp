@@ -0,0 +1,152 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_FLAT_CUE_TREE_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_FLAT_CUE_TREE_HPP_
+
+#include "elements/cue_nodes/NodeObject.hpp"
+#include "elements/webvtt_objects/TimeStamp.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Compact copy of cue text tree, for repeated traversal.
+ * Nodes are kept in one vector in pre-order, and all their strings in one string,
+ * so tree is walked front to back without pointer chasing or virtual calls.
+ */
+class FlatCueTree {
+
+ public:
+  constexpr static uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+  /**
+   * Part of strings or classes of tree
+   */
+  struct Span {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+
+  /**
+   * Node record, children of node directly follow it
+   */
+  struct Node {
+    NodeObject::NodeType type = NodeObject::NodeType::UNDEFINED;
+    //Index of parent node, NO_PARENT for root
+    uint32_t parent = NO_PARENT;
+    //Number of nodes in subtree, including node itself
+    uint32_t subtreeSize = 1;
+    //Text of text node, or voice name of voice node
+    Span text;
+    Span language;
+    Span classes;
+    //Time of time stamp node
+    TimeStamp time{0};
+  };
+
+  enum class EventType {
+    ENTER,
+    LEAVE
+  };
+
+  struct Event {
+    EventType type = EventType::LEAVE;
+    const Node *node = nullptr;
+
+    bool operator==(const Event &other) const = default;
+  };
+
+  /**
+   * Iterator over enter and leave events of all nodes, in document order.
+   * Every node is entered before its children and left after them.
+   */
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Event;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Event *;
+    using reference = const Event &;
+
+    Iterator() = default;
+
+    reference operator*() const { return event; }
+    pointer operator->() const { return &event; }
+    Iterator &operator++();
+    Iterator operator++(int);
+    bool operator==(const Iterator &other) const { return event == other.event; }
+
+   private:
+    friend class FlatCueTree;
+    Iterator(const Node *nodes, Event event) : nodes(nodes), event(event) {}
+
+    const Node *nodes = nullptr;
+    Event event;
+  };
+
+  FlatCueTree() = default;
+
+  /**
+   * Copy tree with given root
+   */
+  explicit FlatCueTree(const NodeObject &root);
+
+  [[nodiscard]] Iterator begin() const;
+  [[nodiscard]] Iterator end() const;
+
+  [[nodiscard]] const std::vector<Node> &getNodes() const;
+  [[nodiscard]] std::u32string_view getString(Span span) const;
+  [[nodiscard]] std::span<const Span> getClasses(const Node &node) const;
+
+ private:
+  std::vector<Node> nodes;
+  std::u32string strings;
+  std::vector<Span> classNames;
+
+  /**
+   * Append record of node without its children
+   * @return index of record
+   */
+  uint32_t appendNode(const NodeObject &nodeObject, uint32_t parent);
+  Span appendString(std::u32string_view string);
+};
+
+//Iterator is stepped for every event of traversal, so it is inlined
+inline FlatCueTree::Iterator &FlatCueTree::Iterator::operator++() {
+  const Node *node = event.node;
+
+  if (event.type == EventType::ENTER) {
+    if (node->subtreeSize > 1)
+      event.node = node + 1;
+    else
+      event.type = EventType::LEAVE;
+    return *this;
+  }
+
+  if (node->parent == NO_PARENT) {
+    event = {};
+    return *this;
+  }
+  //Next sibling directly follows subtree, if it is still inside parent subtree
+  const Node *parent = nodes + node->parent;
+  const Node *next = node + node->subtreeSize;
+  if (next < parent + parent->subtreeSize)
+    event = {EventType::ENTER, next};
+  else
+    event.node = parent;
+  return *this;
+}
+
+inline FlatCueTree::Iterator FlatCueTree::Iterator::operator++(int) {
+  Iterator previous = *this;
+  ++*this;
+  return previous;
+}
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_FLAT_CUE_TREE_HPP_
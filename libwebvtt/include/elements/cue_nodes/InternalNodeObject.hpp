@@ -2,6 +2,8 @@
 #define LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_INTERNAL_NODE_OBJECT_HPP_
 
 #include "NodeObject.hpp"
+#include "NodeArena.hpp"
+#include <span>
 #include <string>
 #include <stack>
 
@@ -11,30 +13,36 @@ class InternalNodeObject : public NodeObject {
  public:
   InternalNodeObject() = default;
 
-  void setClasses(std::list<std::u32string> &newClasses);
-  const std::list<std::u32string> &getClasses();
+  /**
+   * Intern classes and keep their atoms in arena of tree
+   */
+  void setClasses(NodeArena &arena, std::span<const std::u32string_view> newClasses);
+  [[nodiscard]] std::span<const Atom> getClasses() const;
 
-  virtual void setLanguage(std::u32string &languages);
-  std::u32string_view getLanguage();
+  virtual void setLanguage(Atom newLanguage);
+  [[nodiscard]] Atom getLanguage() const;
 
-  virtual void processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation);
+  virtual void processAnnotationString(NodeArena &arena,
+                                       std::stack<Atom> &languages,
+                                       std::u32string_view annotation);
 
   static NodeType
   convertToInternalNodeType(std::u32string_view nodeTypeName);
-  static std::shared_ptr<InternalNodeObject> makeInternalNode(NodeType nodeType);
+  static InternalNodeObject *makeInternalNode(NodeArena &arena, NodeType nodeType);
 
-  void appendChild(std::shared_ptr<NodeObject> nodeObject) override;
-  void visitChildren(ICueTreeVisitor &visitor) override;
+  [[nodiscard]] NodeObject *getFirstChild() const override;
 
-  void visit(const ClassSelector &selector) override;
+  void appendChild(NodeObject *nodeObject) override;
+  void visitChildren(ICueTreeVisitor &visitor) const override;
 
 
 
 
  protected:
-  std::list<std::shared_ptr<NodeObject>> children;
-  std::list<std::u32string> classes;
-  std::u32string language;
+  NodeObject *firstChild = nullptr;
+  NodeObject *lastChild = nullptr;
+  std::span<const Atom> classes;
+  Atom language;
 
 };
 } // namespace webvtt
@@ -9,8 +9,9 @@ namespace webvtt {
 class LeafNodeObject : public NodeObject {
 
  public:
-  void appendChild(std::shared_ptr<NodeObject> nodeObject) final;
-  void visitChildren(ICueTreeVisitor &visitor) final;
+  void appendChild(NodeObject *nodeObject) final;
+  [[nodiscard]] NodeObject *getFirstChild() const final;
+  void visitChildren(ICueTreeVisitor &visitor) const final;
 };
 
 } // namespace webvtt
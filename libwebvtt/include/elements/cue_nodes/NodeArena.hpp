@@ -0,0 +1,88 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_NODE_ARENA_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_NODE_ARENA_HPP_
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace webvtt {
+
+/**
+ * Monotonic memory for nodes and strings of one cue text tree.
+ * Everything made in arena is released at once, when arena is reset or destroyed.
+ * First block is part of arena itself, so tree of short cue text needs no allocation.
+ */
+class NodeArena {
+
+ public:
+  NodeArena() = default;
+  NodeArena(const NodeArena &) = delete;
+  NodeArena(NodeArena &&) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+  NodeArena &operator=(NodeArena &&) = delete;
+  ~NodeArena();
+
+  /**
+   * Construct object in arena, it is destroyed when arena is reset
+   * @return pointer valid until arena is reset
+   */
+  template<typename Object, typename... Arguments>
+  Object *make(Arguments &&...arguments);
+
+  /**
+   * Make array of default constructed objects that need no destruction
+   * @return span of array, valid until arena is reset
+   */
+  template<typename Object>
+  std::span<Object> makeArray(size_t size);
+
+  /**
+   * Copy string to arena
+   * @return view of copy, valid until arena is reset
+   */
+  std::u32string_view copyString(std::u32string_view string);
+
+  /**
+   * Destroy all objects and release all memory except first block
+   */
+  void reset();
+
+ private:
+  constexpr static size_t INLINE_BLOCK_SIZE = 512;
+  constexpr static size_t MAX_BLOCK_SIZE = 1 << 14;
+
+  /**
+   * Header of allocated block, blocks are chained from last to first
+   */
+  struct Block {
+    Block *previous;
+  };
+
+  /**
+   * Record placed before every object that is not trivially destructible,
+   * records are chained from last to first so objects are destroyed in reverse order
+   */
+  struct Destructor {
+    void (*destroy)(void *object);
+    void *object;
+    Destructor *previous;
+  };
+
+  alignas(std::max_align_t) std::byte inlineBlock[INLINE_BLOCK_SIZE];
+  std::byte *position = inlineBlock;
+  std::byte *end = inlineBlock + INLINE_BLOCK_SIZE;
+  Block *lastBlock = nullptr;
+  size_t nextBlockSize = INLINE_BLOCK_SIZE * 2;
+  Destructor *lastDestructor = nullptr;
+
+  void *allocate(size_t size, size_t alignment);
+  void addBlock(size_t minimalSize);
+
+  template<typename Object>
+  static void destroy(void *object);
+};
+
+} // namespace webvtt
+#include "templates/elements/cue_nodes/NodeArena.tpp"
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_NODE_ARENA_HPP_
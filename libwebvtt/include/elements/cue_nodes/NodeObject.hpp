@@ -1,17 +1,20 @@
 #ifndef LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_NODE_OBJECT_HPP_
 #define LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_NODE_OBJECT_HPP_
-#include "elements/visitors/IStyleSelectorVisitor.hpp"
-
+#include "elements/atoms/Atom.hpp"
 #include <list>
 #include <stack>
-#include <memory>
+#include <string>
 
 namespace webvtt {
 
 class Cue;
 class ICueTreeVisitor;
 
-class NodeObject : public IStyleSelectorVisitor {
+/**
+ * Node of cue text tree.
+ * Nodes are made in arena of their cue, and are linked with raw pointers that are valid as long as that arena.
+ */
+class NodeObject {
  public:
 
   NodeObject() = default;
@@ -37,45 +40,33 @@ class NodeObject : public IStyleSelectorVisitor {
     TEXT,
     TIME_STAMP
   };
-  virtual void appendChild(std::shared_ptr<NodeObject> nodeObject) = 0;
-
-  virtual void setParent(const std::weak_ptr<NodeObject> &newParent);
-  virtual std::weak_ptr<NodeObject> getParent();
+  /**
+   * Append node as last child and set this node as its parent
+   */
+  virtual void appendChild(NodeObject *nodeObject) = 0;
+
+  virtual void setParent(NodeObject *newParent);
+  [[nodiscard]] virtual NodeObject *getParent() const;
+  [[nodiscard]] NodeObject *getNextSibling() const;
+  /**
+   * @return first child, or null if node has no children
+   */
+  [[nodiscard]] virtual NodeObject *getFirstChild() const = 0;
 
   [[nodiscard]] virtual NodeType getNodeType() const = 0;
 
-  virtual void processEndToken(std::shared_ptr<NodeObject> &nodeObject,
-                               std::stack<std::u32string> &languages,
+  virtual void processEndToken(NodeObject *&nodeObject,
+                               std::stack<Atom> &languages,
                                NodeType value);
 
   virtual void accept(ICueTreeVisitor &visitor) const = 0;
-  virtual void visitChildren(ICueTreeVisitor &visitor) = 0;
-
-  void visit(const MatchAllSelector &selector) override;
-  void visit(const IdSelector &selector) override;
-  void visit(const ClassSelector &selector) override;
-  void visit(const CompoundSelector &selector) override;
-  void visit(const CombinatorSelector &selector) override;
-  void visit(const BoldTypeSelector &selector) override;
-  void visit(const ClassTypeSelector &selector) override;
-  void visit(const ItalicTypeSelector &selector) override;
-  void visit(const LanguageTypeSelector &selector) override;
-  void visit(const RubyTypeSelector &selector) override;
-  void visit(const RubyTextTypeSelector &selector) override;
-  void visit(const UnderlineTypeSelector &selector) override;
-  void visit(const VoiceTypeSelector &selector) override;
-  void visit(const LanguageSelector &selector) override;
-  void visit(const VoiceSelector &selector) override;
-  [[nodiscard]] bool IsShouldApplyLastVisitedStyleSheet() const;
-
-  void visitAllDirectAncestors(const StyleSelector &selector);
-  uint32_t getLevelFromCurrentNode() const;
+  virtual void visitChildren(ICueTreeVisitor &visitor) const = 0;
 
  protected:
-  std::weak_ptr<NodeObject> parent;
-  bool shouldApplyLastVisitedStyleSheet = false;
-  uint32_t levelFromCurrentNode = 0;
+  NodeObject *parent = nullptr;
+  NodeObject *nextSibling = nullptr;
 
+  friend class InternalNodeObject;
 };
 
 } // namespace webvtt
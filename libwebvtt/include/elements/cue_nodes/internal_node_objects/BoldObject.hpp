@@ -10,7 +10,6 @@ class BoldObject : public InternalNodeObject {
   [[nodiscard]]NodeType getNodeType() const override;
   void accept(ICueTreeVisitor &visitor) const override;
 
-  void visit(const BoldTypeSelector &selector) override;
 };
 
 } // namespace webvtt
@@ -9,7 +9,6 @@ class ClassObject : public InternalNodeObject {
  public:
   virtual NodeType getNodeType() const override;
   void accept(ICueTreeVisitor &visitor) const override;
-  void visit(const ClassTypeSelector &selector) override;
 
 };
 } // namespace webvtt
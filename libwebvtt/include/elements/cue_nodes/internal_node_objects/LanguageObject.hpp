@@ -8,13 +8,13 @@ namespace webvtt {
 class LanguageObject : public InternalNodeObject {
  public:
   [[nodiscard]] NodeType getNodeType() const override;
-  void processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation) override;
-  void processEndToken(std::shared_ptr<NodeObject> &nodeObject,
-                       std::stack<std::u32string> &languages,
+  void processAnnotationString(NodeArena &arena,
+                               std::stack<Atom> &languages,
+                               std::u32string_view annotation) override;
+  void processEndToken(NodeObject *&nodeObject,
+                       std::stack<Atom> &languages,
                        NodeType value) override;
   void accept(ICueTreeVisitor &visitor) const override;
-  void visit(const LanguageTypeSelector &selector) override;
-  void visit(const LanguageSelector &selector) override;
  private:
 };
 } // namespace webvtt
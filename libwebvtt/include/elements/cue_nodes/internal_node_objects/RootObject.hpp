@@ -11,8 +11,6 @@ class RootObject : public InternalNodeObject {
   void setCueId(std::u32string_view);
   [[nodiscard]]std::u32string_view getCueId() const;
   void accept(ICueTreeVisitor &visitor) const override;
-  void visit(const IdSelector &selector) override;
-  void visit(const LanguageSelector &selector) override;
  private:
   std::u32string_view cueId;
 };
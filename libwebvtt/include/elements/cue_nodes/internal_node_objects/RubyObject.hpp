@@ -9,7 +9,6 @@ class RubyObject : public InternalNodeObject {
  public:
   [[nodiscard]] NodeType getNodeType() const override;
   void accept(ICueTreeVisitor &visitor) const override;
-  void visit(const RubyTypeSelector &selector) override;
 };
 
 } // namespace webvtt
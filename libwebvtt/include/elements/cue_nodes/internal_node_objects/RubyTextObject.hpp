@@ -8,11 +8,10 @@ namespace webvtt {
 class RubyTextObject : public InternalNodeObject {
  public:
   [[nodiscard]] NodeType getNodeType() const override;
-  void processEndToken(std::shared_ptr<NodeObject> &nodeObject,
-                       std::stack<std::u32string> &languages,
+  void processEndToken(NodeObject *&nodeObject,
+                       std::stack<Atom> &languages,
                        NodeObject::NodeType value) override;
   void accept(ICueTreeVisitor &visitor)  const override;
-  void visit(const RubyTextTypeSelector &selector) override;
 };
 
 } // namespace webvtt
@@ -8,12 +8,13 @@ namespace webvtt {
 class VoiceObject : public InternalNodeObject {
  public:
   [[nodiscard]] NodeType getNodeType() const override;
-  void processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation) override;
+  void processAnnotationString(NodeArena &arena,
+                               std::stack<Atom> &languages,
+                               std::u32string_view annotation) override;
   void accept(ICueTreeVisitor &visitor) const override;
-  void visit(const VoiceTypeSelector &selector) override;
-  void visit(const VoiceSelector &selector) override;
+  [[nodiscard]] Atom getVoiceName() const;
  private:
-  std::u32string voiceName;
+  Atom voiceName;
 };
 
 } // namespace webvtt
@@ -6,14 +6,18 @@
 namespace webvtt {
 class TextObject : public LeafNodeObject {
  public:
+  /**
+   * @param input view that is valid as long as node, usually copied to arena of tree
+   */
   explicit TextObject(std::u32string_view input) {
     this->text = input;
   }
   [[nodiscard]] NodeObject::NodeType getNodeType() const override;
   void accept(ICueTreeVisitor &visitor) const override;
+  [[nodiscard]] std::u32string_view getText() const;
 
  private:
-  std::u32string text;
+  std::u32string_view text;
 };
 
 } // namespace webvtt
@@ -2,17 +2,23 @@
 #define LIBWEBVTT_INCLUDE_ELEMENTS_CUE_NODES_LEAF_NODE_OBJECTS_TIME_STAMP_OBJECT_HPP_
 
 #include "elements/cue_nodes/LeafNodeObject.hpp"
+#include "elements/webvtt_objects/TimeStamp.hpp"
 
 namespace webvtt {
 class TimeStampObject : public LeafNodeObject {
  public:
-  explicit TimeStampObject(double newTime) : time(newTime) {}
+  explicit TimeStampObject(TimeStamp newTime) : time(newTime) {}
 
   [[nodiscard]] NodeObject::NodeType getNodeType() const override;
   void accept(ICueTreeVisitor &visitor) const override;
+  /**
+   * @return time in seconds
+   */
+  [[nodiscard]] double getTime() const;
+  [[nodiscard]] TimeStamp getTimeStamp() const;
 
  private:
-  double time;
+  TimeStamp time;
 };
 
 } // namespace webvtt
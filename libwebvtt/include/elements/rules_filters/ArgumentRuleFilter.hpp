@@ -6,7 +6,16 @@ namespace webvtt {
 
 class ArgumentRuleFilter final : public RuleFilter {
  public:
-  ArgumentRuleFilter();
+  constexpr ArgumentRuleFilter()
+      : RuleFilter(makePropertySet({CSSProperty::COLOR, CSSProperty::OPACITY, CSSProperty::VISIBILITY,
+                                    CSSProperty::TEXT_SHADOW, CSSProperty::WHITE_SPACE,
+                                    CSSProperty::TEXT_COMBINE_UPRIGHT, CSSProperty::RUBY_POSITION})
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::ANIMATION)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::DECORATION)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::BACKGROUND)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::OUTLINE)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::FONT)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::TRANSITION)) {}
 
 };
 
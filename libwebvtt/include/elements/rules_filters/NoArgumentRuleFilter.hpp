@@ -5,7 +5,14 @@
 namespace webvtt {
 class NoArgumentRuleFilter final : public RuleFilter {
  public:
-  NoArgumentRuleFilter();
+  constexpr NoArgumentRuleFilter()
+      : RuleFilter(makePropertySet({CSSProperty::COLOR, CSSProperty::OPACITY, CSSProperty::VISIBILITY,
+                                    CSSProperty::TEXT_SHADOW, CSSProperty::WHITE_SPACE,
+                                    CSSProperty::TEXT_COMBINE_UPRIGHT, CSSProperty::RUBY_POSITION})
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::BACKGROUND)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::OUTLINE)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::FONT)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::DECORATION)) {}
 
 };
 
@@ -1,17 +1,25 @@
 #ifndef LIBWEBVTT_INCLUDE_ELEMENTS_RULES_FILTERS_RULE_FILTER_HPP_
 #define LIBWEBVTT_INCLUDE_ELEMENTS_RULES_FILTERS_RULE_FILTER_HPP_
-#include <set>
+#include "parser/CSSProperties.hpp"
+#include <bitset>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
-#include <memory>
-#include <map>
 
 namespace webvtt {
 
+/**
+ * Set of CSS properties allowed in some context. Sets are computed when library is compiled,
+ * and filters are constant initialized, so they can be used from any thread without synchronization.
+ */
 class RuleFilter {
 
  public:
 
   [[nodiscard]] bool isRuleAllowed(std::string_view name) const;
+  [[nodiscard]] bool isRuleAllowed(CSSProperty property) const {
+    return allowedProperties.test(static_cast<size_t>(property));
+  }
   virtual ~RuleFilter() = 0;
 
   enum class RULE_FILTER_TYPE {
@@ -23,13 +31,11 @@ class RuleFilter {
   static const RuleFilter &
   getRuleFilter(RULE_FILTER_TYPE ruleFilterType);
 
-  RuleFilter() = default;
   RuleFilter(const RuleFilter &) = delete;
   RuleFilter(RuleFilter &&) = delete;
   RuleFilter &operator=(const RuleFilter &) = delete;
   RuleFilter &operator=(RuleFilter &&) = delete;
  protected:
-  std::set<std::string_view> allowedProperties;
   enum class RULE_SHORT_LAND_TYPE {
     ANIMATION,
     TRANSITION,
@@ -39,13 +45,59 @@ class RuleFilter {
     DECORATION
   };
 
-  void addRuleGroupToAllowedRules(RULE_SHORT_LAND_TYPE ruleShortlandType);
+  constexpr explicit RuleFilter(uint64_t allowedProperties) : allowedProperties(allowedProperties) {}
+
+  /**
+   * @return bits of given properties
+   */
+  static constexpr uint64_t makePropertySet(std::initializer_list<CSSProperty> properties);
+
+  /**
+   * @return bits of shorthand property and all properties it sets
+   */
+  static constexpr uint64_t getRuleGroup(RULE_SHORT_LAND_TYPE ruleShortlandType);
 
  private:
-  static std::map<RULE_FILTER_TYPE, std::unique_ptr<RuleFilter>> ruleFilters;
-  static std::unique_ptr<RuleFilter> makeRuleFilter(RULE_FILTER_TYPE ruleFilterType);
+  static_assert(CSSProperties::PROPERTY_NUMBER <= 64, "Property set has to fit in 64 bits");
+  const std::bitset<CSSProperties::PROPERTY_NUMBER> allowedProperties;
 };
 
+constexpr uint64_t RuleFilter::makePropertySet(std::initializer_list<CSSProperty> properties) {
+  uint64_t propertySet = 0;
+  for (CSSProperty property : properties)
+    propertySet |= uint64_t{1} << static_cast<uint32_t>(property);
+  return propertySet;
+}
+
+constexpr uint64_t RuleFilter::getRuleGroup(RULE_SHORT_LAND_TYPE ruleShortlandType) {
+  switch (ruleShortlandType) {
+    case RULE_SHORT_LAND_TYPE::ANIMATION:
+      return makePropertySet({CSSProperty::ANIMATION, CSSProperty::ANIMATION_DELAY, CSSProperty::ANIMATION_DIRECTION,
+                              CSSProperty::ANIMATION_DURATION, CSSProperty::ANIMATION_FILL_MODE,
+                              CSSProperty::ANIMATION_ITERATION_COUNT, CSSProperty::ANIMATION_NAME,
+                              CSSProperty::ANIMATION_PLAY_STATE, CSSProperty::ANIMATION_TIMING_FUNCTION});
+    case RULE_SHORT_LAND_TYPE::BACKGROUND:
+      return makePropertySet({CSSProperty::BACKGROUND, CSSProperty::BACKGROUND_ATTACHMENT, CSSProperty::BACKGROUND_CLIP,
+                              CSSProperty::BACKGROUND_COLOR, CSSProperty::BACKGROUND_IMAGE,
+                              CSSProperty::BACKGROUND_POSITION, CSSProperty::BACKGROUND_REPEAT,
+                              CSSProperty::BACKGROUND_SIZE});
+    case RULE_SHORT_LAND_TYPE::DECORATION:
+      return makePropertySet({CSSProperty::TEXT_DECORATION, CSSProperty::TEXT_DECORATION_COLOR,
+                              CSSProperty::TEXT_DECORATION_LINE, CSSProperty::TEXT_DECORATION_STYLE});
+    case RULE_SHORT_LAND_TYPE::FONT:
+      return makePropertySet({CSSProperty::FONT, CSSProperty::FONT_FAMILY, CSSProperty::FONT_LINE_HEIGHT,
+                              CSSProperty::FONT_SIZE, CSSProperty::FONT_STRETCH, CSSProperty::FONT_STYLE,
+                              CSSProperty::FONT_VARIANT, CSSProperty::FONT_WEIGHT});
+    case RULE_SHORT_LAND_TYPE::OUTLINE:
+      return makePropertySet({CSSProperty::OUTLINE, CSSProperty::OUTLINE_COLOR, CSSProperty::OUTLINE_STYLE,
+                              CSSProperty::OUTLINE_WIDTH});
+    case RULE_SHORT_LAND_TYPE::TRANSITION:
+      return makePropertySet({CSSProperty::TRANSITION, CSSProperty::TRANSITION_DELAY, CSSProperty::TRANSITION_DURATION,
+                              CSSProperty::TRANSITION_PROPERTY, CSSProperty::TRANSITION_TIMING_FUNCTION});
+  }
+  return 0;
+}
+
 } // namespace webvtt
 
 #endif // LIBWEBVTT_INCLUDE_ELEMENTS_RULES_FILTERS_RULE_FILTER_HPP_
@@ -6,7 +6,14 @@ namespace webvtt {
 
 class TimeStampRuleFilter final : public RuleFilter {
  public:
-  TimeStampRuleFilter();
+  constexpr TimeStampRuleFilter()
+      : RuleFilter(makePropertySet({CSSProperty::COLOR, CSSProperty::OPACITY, CSSProperty::VISIBILITY,
+                                    CSSProperty::TEXT_SHADOW})
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::ANIMATION)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::TRANSITION)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::DECORATION)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::BACKGROUND)
+                       | getRuleGroup(RULE_SHORT_LAND_TYPE::OUTLINE)) {}
 
 };
 
@@ -0,0 +1,72 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_ANCESTOR_BLOOM_FILTER_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_ANCESTOR_BLOOM_FILTER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Bloom filter of keys of all ancestors of node being matched.
+ * Filter of every depth of traversal is kept on stack, so leaving node only drops top of stack.
+ * Filter answers no only if key was surely not added, so selector whose ancestor key is missing is skipped.
+ */
+class AncestorBloomFilter {
+ public:
+  AncestorBloomFilter() { clear(); }
+
+  /**
+   * Remove all levels, leaving one empty level for root
+   */
+  void clear();
+
+  /**
+   * Enter node whose keys are given, its children are matched with filter that contains them
+   */
+  void push(std::span<const uint32_t> keys);
+  void pop();
+
+  [[nodiscard]] inline bool mayContain(uint32_t key) const {
+    const Bits &bits = levels.back();
+    uint32_t hash = mix(key);
+    return hasBit(bits, hash) && hasBit(bits, hash >> 16);
+  }
+
+  [[nodiscard]] inline bool mayContainAll(std::span<const uint32_t> keys) const {
+    for (uint32_t key : keys) {
+      if (!mayContain(key))
+        return false;
+    }
+    return true;
+  }
+
+ private:
+  constexpr static size_t BIT_NUMBER = 256;
+  using Bits = std::array<uint64_t, BIT_NUMBER / 64>;
+
+  //Keys are hashes of names, they are mixed so two bit positions are taken from independent bits
+  static constexpr uint32_t mix(uint32_t key) {
+    key ^= key >> 16;
+    key *= 0x85EBCA6Bu;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35u;
+    return key ^ (key >> 16);
+  }
+  static inline bool hasBit(const Bits &bits, uint32_t hash) {
+    uint32_t bit = hash % BIT_NUMBER;
+    return (bits[bit / 64] >> (bit % 64)) & 1;
+  }
+  static inline void setBit(Bits &bits, uint32_t hash) {
+    uint32_t bit = hash % BIT_NUMBER;
+    bits[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+
+  std::vector<Bits> levels;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_ANCESTOR_BLOOM_FILTER_HPP_
@@ -0,0 +1,90 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPILED_SELECTOR_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPILED_SELECTOR_HPP_
+
+#include "elements/atoms/Atom.hpp"
+#include "elements/cue_nodes/NodeObject.hpp"
+#include "elements/style_selectors/StyleSelector.hpp"
+#include "elements/style_selectors/attribute_selectors/AttributeSelector.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Selector of cue style sheet compiled to plain data, tested against nodes without visiting selector objects.
+ * Types, classes and ids are hashed to keys when selector is compiled, so nodes are filtered by comparing integers.
+ * Classes are atoms, and id is view into selector, so selector has to outlive compiled selector.
+ */
+struct CompiledSelector {
+  enum class KeyKind : uint32_t {
+    TYPE = 1,
+    CLASS = 2,
+    ID = 3
+  };
+
+  /**
+   * Test of voice name of voice node or language of language node
+   */
+  struct AttributeTest {
+    NodeObject::NodeType nodeType = NodeObject::NodeType::UNDEFINED;
+    const AttributeSelector *selector = nullptr;
+    //Set if whole value has to be equal, then it is compared with atom of node
+    Atom exactValue;
+  };
+
+  /**
+   * Simple selectors that all have to match one node
+   */
+  struct Compound {
+    //UNDEFINED matches node of any type, ROOT is type of whole cue
+    NodeObject::NodeType type = NodeObject::NodeType::UNDEFINED;
+    std::vector<Atom> classNames;
+    std::optional<std::u32string_view> id;
+    std::vector<AttributeTest> attributeTests;
+    //How node of next compound is related to node of this one
+    StyleSelector::StyleSelectorCombinator combinator = StyleSelector::StyleSelectorCombinator::NONE;
+  };
+
+  //Subject compound first, then compounds written left of it, from right to left
+  std::vector<Compound> compounds;
+  //Keys of all compounds that have to match ancestors of subject
+  std::vector<uint32_t> ancestorKeys;
+  //Key of subject by which selector is looked up, if subject has type, class or id
+  std::optional<uint32_t> subjectKey;
+  uint32_t specificity = 0;
+
+  /**
+   * Compile selector of style sheet, selector list is compiled to one selector per item
+   * @return compiled selectors, without items that can never match, like compound of two types
+   */
+  static std::vector<CompiledSelector> compile(const StyleSelector &selector);
+
+  static constexpr uint32_t makeKey(KeyKind kind, std::u32string_view name) {
+    uint32_t hash = FNV_OFFSET ^ static_cast<uint32_t>(kind);
+    for (char32_t character : name)
+      hash = (hash ^ static_cast<uint32_t>(character)) * FNV_PRIME;
+    return hash;
+  }
+
+  static constexpr uint32_t makeKey(KeyKind kind, uint32_t value) {
+    return (FNV_OFFSET ^ static_cast<uint32_t>(kind) ^ (value << 8)) * FNV_PRIME;
+  }
+
+  static uint32_t makeKey(KeyKind kind, Atom atom) {
+    return makeKey(kind, atom.getId());
+  }
+
+  static constexpr uint32_t makeKey(NodeObject::NodeType type) {
+    return makeKey(KeyKind::TYPE, static_cast<uint32_t>(type));
+  }
+
+ private:
+  constexpr static uint32_t FNV_OFFSET = 2166136261u;
+  constexpr static uint32_t FNV_PRIME = 16777619u;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPILED_SELECTOR_HPP_
@@ -0,0 +1,37 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_HPP_
+
+#include "elements/webvtt_objects/CSSDeclarations.hpp"
+#include <string_view>
+
+namespace webvtt {
+
+/**
+ * Resolved style of node, declarations inherited from parent overridden by declarations of matched sheets.
+ * Styles are interned by cache, so nodes with equal declarations share one object and compare by address.
+ */
+class ComputedStyle {
+ public:
+  using Declarations = CSSDeclarations;
+
+  explicit ComputedStyle(Declarations declarations) : declarations(std::move(declarations)) {}
+  ComputedStyle(const ComputedStyle &) = delete;
+  ComputedStyle(ComputedStyle &&) = delete;
+  ComputedStyle &operator=(const ComputedStyle &) = delete;
+  ComputedStyle &operator=(ComputedStyle &&) = delete;
+  ~ComputedStyle() = default;
+
+  [[nodiscard]] const Declarations &getDeclarations() const { return declarations; }
+
+  /**
+   * @return value of property, or empty view if property is not set
+   */
+  [[nodiscard]] std::string_view getValue(CSSProperty property) const;
+
+ private:
+  const Declarations declarations;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_HPP_
@@ -0,0 +1,125 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_CACHE_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_CACHE_HPP_
+
+#include "elements/style_matching/ComputedStyle.hpp"
+#include "elements/style_matching/CueStyleMatcher.hpp"
+#include "elements/cue_nodes/NodeObject.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace webvtt {
+
+class Cue;
+
+/**
+ * Resolves computed styles of cue nodes, and remembers them by signature of node.
+ * Signature is type, classes, voice and language of node, together with id of signature of its parent,
+ * so it stands for whole chain of ancestors. Node whose signature was already seen gets style by one lookup,
+ * without matching selectors. Cue id is part of signature of root only when some id selector names it, and
+ * when matcher has sibling selectors signature of previous sibling is part of signature of node.
+ * Cache has to be cleared when style sheets are added to matcher.
+ */
+class ComputedStyleCache {
+ public:
+  /**
+   * Style of one node, nodes are in pre-order
+   */
+  struct NodeStyle {
+    const NodeObject *node = nullptr;
+    std::shared_ptr<const ComputedStyle> style;
+  };
+
+  explicit ComputedStyleCache(CueStyleMatcher &matcher);
+  ComputedStyleCache(const ComputedStyleCache &) = delete;
+  ComputedStyleCache(ComputedStyleCache &&) = delete;
+  ComputedStyleCache &operator=(const ComputedStyleCache &) = delete;
+  ComputedStyleCache &operator=(ComputedStyleCache &&) = delete;
+  ~ComputedStyleCache() = default;
+
+  /**
+   * Resolve styles of all nodes of tree
+   * @param root root of cue text tree
+   * @param cueId identifier of cue, matched by id selectors
+   * @param nodeStyles cleared and filled with style of every node
+   */
+  void resolve(const NodeObject &root, std::u32string_view cueId, std::vector<NodeStyle> &nodeStyles);
+  /**
+   * Resolve styles of all nodes of cue, cue with empty text has no nodes
+   */
+  void resolve(const Cue &cue, std::vector<NodeStyle> &nodeStyles);
+
+  /**
+   * Forget all signatures and styles, and reset counters
+   */
+  void clear();
+
+  [[nodiscard]] size_t getHitNumber() const { return hitNumber; }
+  [[nodiscard]] size_t getMissNumber() const { return missNumber; }
+  [[nodiscard]] size_t getSignatureNumber() const { return signatures.size(); }
+  [[nodiscard]] size_t getStyleNumber() const { return styles.size(); }
+
+ private:
+  struct Signature {
+    NodeObject::NodeType type = NodeObject::NodeType::UNDEFINED;
+    //Sorted, since order of classes does not change matching
+    std::vector<Atom> classes;
+    Atom voice;
+    Atom language;
+    std::u32string cueId;
+    uint32_t parentId = 0;
+    uint32_t previousSiblingId = 0;
+
+    bool operator==(const Signature &other) const = default;
+  };
+
+  struct SignatureHash {
+    size_t operator()(const Signature &signature) const;
+  };
+
+  struct Entry {
+    uint32_t id = 0;
+    std::shared_ptr<const ComputedStyle> style;
+  };
+
+  struct StyleLess {
+    using is_transparent = void;
+    bool operator()(const std::shared_ptr<const ComputedStyle> &first,
+                    const std::shared_ptr<const ComputedStyle> &second) const {
+      return first->getDeclarations() < second->getDeclarations();
+    }
+    bool operator()(const ComputedStyle::Declarations &first, const std::shared_ptr<const ComputedStyle> &second) const {
+      return first < second->getDeclarations();
+    }
+    bool operator()(const std::shared_ptr<const ComputedStyle> &first, const ComputedStyle::Declarations &second) const {
+      return first->getDeclarations() < second;
+    }
+  };
+
+  CueStyleMatcher &matcher;
+  std::unordered_map<Signature, Entry, SignatureHash> signatures;
+  std::set<std::shared_ptr<const ComputedStyle>, StyleLess> styles;
+  std::shared_ptr<const ComputedStyle> emptyStyle;
+  size_t hitNumber = 0;
+  size_t missNumber = 0;
+
+  //State of traversal, kept to reuse memory between cues
+  std::u32string_view currentCueId;
+  Signature lookupSignature;
+
+  const Entry &resolveSubtree(const NodeObject &node, const Entry &parent, uint32_t previousSiblingId,
+                              std::vector<NodeStyle> &nodeStyles);
+  void makeSignature(const NodeObject &node, uint32_t parentId, uint32_t previousSiblingId);
+  Entry makeEntry(const NodeObject &node, const ComputedStyle &parentStyle);
+  std::shared_ptr<const ComputedStyle> internStyle(ComputedStyle::Declarations &&declarations);
+
+  static bool isElement(const NodeObject &node);
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_COMPUTED_STYLE_CACHE_HPP_
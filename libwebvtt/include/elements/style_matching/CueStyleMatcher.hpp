@@ -0,0 +1,139 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_CUE_STYLE_MATCHER_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_CUE_STYLE_MATCHER_HPP_
+
+#include "elements/style_matching/AncestorBloomFilter.hpp"
+#include "elements/style_matching/CompiledSelector.hpp"
+#include "elements/cue_nodes/NodeObject.hpp"
+#include "elements/webvtt_objects/StyleSheet.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace webvtt {
+
+class Cue;
+
+/**
+ * Finds style sheets that apply to every node of cue text tree.
+ * Selectors of sheets are compiled once, when sheets are added, and looked up by key of their subject,
+ * so node is tested only against selectors that can match it. Selectors whose ancestors are surely
+ * missing are rejected by bloom filter of ancestors, before walking up the tree.
+ * Added style sheets have to outlive matcher.
+ */
+class CueStyleMatcher {
+ public:
+  /**
+   * Range of matched style sheets of one node
+   */
+  struct NodeRules {
+    const NodeObject *node = nullptr;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+
+  /**
+   * Style sheets matched by all nodes of tree. Nodes are kept in pre-order, and sheets of every node
+   * are ordered by cascade, from lowest specificity to highest and by order of sheets for equal one.
+   */
+  class MatchedRules {
+   public:
+    void clear();
+    [[nodiscard]] const std::vector<NodeRules> &getNodes() const { return nodes; }
+    [[nodiscard]] std::span<const StyleSheet *const> getStyleSheets(const NodeRules &nodeRules) const {
+      return std::span<const StyleSheet *const>(styleSheets).subspan(nodeRules.offset, nodeRules.length);
+    }
+
+   private:
+    friend class CueStyleMatcher;
+    std::vector<NodeRules> nodes;
+    std::vector<const StyleSheet *> styleSheets;
+  };
+
+  CueStyleMatcher() = default;
+  CueStyleMatcher(const CueStyleMatcher &) = delete;
+  CueStyleMatcher(CueStyleMatcher &&) = delete;
+  CueStyleMatcher &operator=(const CueStyleMatcher &) = delete;
+  CueStyleMatcher &operator=(CueStyleMatcher &&) = delete;
+  ~CueStyleMatcher() = default;
+
+  /**
+   * Compile selector of sheet, sheets that are not cue sheets or have no selector are skipped
+   */
+  void addStyleSheet(const StyleSheet &styleSheet);
+  [[nodiscard]] size_t getRuleNumber() const { return rules.size(); }
+
+  /**
+   * Match all nodes of tree in one traversal
+   * @param root root of cue text tree
+   * @param cueId identifier of cue, matched by id selectors
+   * @param matchedRules cleared and filled with sheets of every node
+   */
+  void match(const NodeObject &root, std::u32string_view cueId, MatchedRules &matchedRules);
+  /**
+   * Match all nodes of cue, cue with empty text has no nodes
+   */
+  void match(const Cue &cue, MatchedRules &matchedRules);
+
+  /**
+   * Match one node without traversal of whole tree, ancestors of selectors are checked by walking up the tree
+   * @param cueId identifier of cue that contains node
+   * @return sheets of node ordered by cascade, valid until next matching
+   */
+  std::span<const StyleSheet *const> matchNode(const NodeObject &node, std::u32string_view cueId);
+
+  /**
+   * Whether some selector relates node to its siblings, so sheets of node depend on nodes before it
+   */
+  [[nodiscard]] bool hasSiblingRules() const { return isSiblingRuleAdded; }
+
+  /**
+   * Whether some selector matches cue with given identifier, other cue identifiers don't change matching
+   */
+  [[nodiscard]] bool isRuleId(std::u32string_view id) const { return ruleIds.contains(id); }
+
+ private:
+  struct Rule {
+    CompiledSelector selector;
+    const StyleSheet *styleSheet = nullptr;
+    uint32_t order = 0;
+  };
+
+  struct MatchedRule {
+    uint32_t specificity = 0;
+    uint32_t order = 0;
+    const StyleSheet *styleSheet = nullptr;
+  };
+
+  std::vector<Rule> rules;
+  std::unordered_map<uint32_t, std::vector<uint32_t>> rulesByKey;
+  std::vector<uint32_t> universalRules;
+  uint32_t styleSheetNumber = 0;
+  bool isSiblingRuleAdded = false;
+  //Views into selectors of sheets
+  std::unordered_set<std::u32string_view> ruleIds;
+
+  //State of traversal, kept to reuse memory between cues
+  AncestorBloomFilter ancestorFilter;
+  std::u32string_view currentCueId;
+  std::vector<uint32_t> nodeKeys;
+  std::vector<MatchedRule> matchedRules;
+  std::vector<const StyleSheet *> nodeStyleSheets;
+
+  void matchSubtree(const NodeObject &node, MatchedRules &result);
+  void collectMatchedRules(const NodeObject &node, bool isAncestorFilterUsed);
+  void testRules(const std::vector<uint32_t> &ruleIndexes, const NodeObject &node, bool isAncestorFilterUsed);
+  void collectKeys(const NodeObject &node);
+
+  [[nodiscard]] bool matchesFrom(const CompiledSelector &selector, size_t index, const NodeObject &node) const;
+  [[nodiscard]] bool matchesCompound(const CompiledSelector::Compound &compound, const NodeObject &node) const;
+
+  static bool isElement(const NodeObject &node);
+  static const NodeObject *getPreviousElementSibling(const NodeObject &node);
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_MATCHING_CUE_STYLE_MATCHER_HPP_
@@ -1,6 +1,7 @@
 #ifndef LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_SELECTORS_CLASS_SELECTOR_HPP_
 #define LIBWEBVTT_INCLUDE_ELEMENTS_STYLE_SELECTORS_CLASS_SELECTOR_HPP_
 #include "elements/style_selectors/StyleSelector.hpp"
+#include "elements/atoms/Atom.hpp"
 #include <string>
 
 namespace webvtt {
@@ -8,15 +9,15 @@ namespace webvtt {
 class ClassSelector : public StyleSelector {
  public:
   explicit ClassSelector(std::u32string_view className) {
-    this->className = className;
+    this->className = Atom::intern(className);
   }
   [[nodiscard]] SelectorType getSelectorType() const override;
 
   void accept(IStyleSelectorVisitor &visitor) const override;
 
-  [[nodiscard]]std::u32string_view getClassName() const;
+  [[nodiscard]] Atom getClassName() const;
  private:
-  std::u32string className;
+  Atom className;
 };
 
 } // namespace WebTT
@@ -14,6 +14,7 @@ class CombinatorSelector : public StyleSelector {
   }
   [[nodiscard]] SelectorType getSelectorType() const override;
   void accept(IStyleSelectorVisitor &visitor) const override;
+  [[nodiscard]] const std::list<std::unique_ptr<StyleSelector>> &getStyleSelectors() const;
 
  private:
   std::list<std::unique_ptr<StyleSelector>> styleSelectors;
@@ -0,0 +1,107 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_CSS_DECLARATIONS_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_CSS_DECLARATIONS_HPP_
+
+#include "parser/CSSProperties.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Values of CSS properties, sorted by property. Values are spans of one string.
+ * Set properties are also bits of mask, so position of property is counted from mask
+ * and lookup does not search.
+ */
+class CSSDeclarations {
+ public:
+  /**
+   * Iterates declarations as pairs of property and value
+   */
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::pair<CSSProperty, std::string_view>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    Iterator() = default;
+    Iterator(const CSSDeclarations *declarations, size_t index) : declarations(declarations), index(index) {}
+
+    value_type operator*() const { return declarations->getDeclaration(index); }
+    Iterator &operator++() {
+      index++;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator previous = *this;
+      index++;
+      return previous;
+    }
+    bool operator==(const Iterator &other) const { return index == other.index; }
+
+   private:
+    const CSSDeclarations *declarations = nullptr;
+    size_t index = 0;
+  };
+
+  /**
+   * Set value of property, value of property that is already set is replaced
+   */
+  void set(CSSProperty property, std::string_view value);
+
+  [[nodiscard]] bool contains(CSSProperty property) const { return (mask & getBit(property)) != 0; }
+
+  /**
+   * @return value of property, or nothing if property is not set
+   */
+  [[nodiscard]] std::optional<std::string_view> get(CSSProperty property) const {
+    if (!contains(property))
+      return std::nullopt;
+    return getValue(declarations[getPosition(property)]);
+  }
+
+  [[nodiscard]] size_t size() const { return declarations.size(); }
+  [[nodiscard]] bool empty() const { return declarations.empty(); }
+  [[nodiscard]] Iterator begin() const { return {this, 0}; }
+  [[nodiscard]] Iterator end() const { return {this, declarations.size()}; }
+
+  /**
+   * Declarations are compared by properties and values, regardless of layout of values
+   */
+  bool operator==(const CSSDeclarations &other) const;
+  bool operator<(const CSSDeclarations &other) const;
+
+ private:
+  struct Declaration {
+    CSSProperty property;
+    uint32_t offset;
+    uint32_t length;
+  };
+  static_assert(CSSProperties::PROPERTY_NUMBER <= 64, "Set properties have to fit in mask");
+
+  uint64_t mask = 0;
+  std::vector<Declaration> declarations;
+  std::string values;
+
+  static constexpr uint64_t getBit(CSSProperty property) { return uint64_t{1} << static_cast<uint32_t>(property); }
+  [[nodiscard]] size_t getPosition(CSSProperty property) const {
+    return std::popcount(mask & (getBit(property) - 1));
+  }
+  [[nodiscard]] std::string_view getValue(const Declaration &declaration) const {
+    return std::string_view(values).substr(declaration.offset, declaration.length);
+  }
+  [[nodiscard]] std::pair<CSSProperty, std::string_view> getDeclaration(size_t index) const {
+    return {declarations[index].property, getValue(declarations[index])};
+  }
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_CSS_DECLARATIONS_HPP_
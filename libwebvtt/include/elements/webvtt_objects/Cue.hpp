@@ -2,10 +2,14 @@
 #define LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_CUE_HPP_
 
 #include "elements/cue_nodes/NodeObject.hpp"
+#include "elements/cue_nodes/NodeArena.hpp"
 #include "Block.hpp"
 #include "Region.hpp"
+#include "TimeStamp.hpp"
 #include <string>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 
@@ -57,19 +61,49 @@ class Cue : public Block {
    */
   void setText(std::u32string newText);
 
+  /**
+   * Set cue text as view into utf8 source, which need to outlive cue.
+   * Cue decodes its copy of text only when getText is called.
+   *
+   * @param text cue text
+   */
+  void setText(std::u8string_view newText);
+
+  /**
+   * Set cue identifier as view into utf8 source, which need to outlive cue.
+   *
+   * @param newIdentifier cue identifier
+   */
+  void setIdentifier(std::u8string_view newIdentifier);
+
   /**
    * Set cue start time
    *
-   * @param time time in seconds
+   * @param time time in seconds, rounded to milliseconds
    */
   void setStartTime(double newTime);
+  void setStartTime(TimeStamp newTime);
 
   /**
    * Set cue end time
    *
-   * @param endTime time in seconds
+   * @param endTime time in seconds, rounded to milliseconds
    */
   void setEndTime(double newTime);
+  void setEndTime(TimeStamp newTime);
+
+  /**
+   * @return start time in seconds
+   */
+  [[nodiscard]] double getStartTime() const;
+
+  /**
+   * @return end time in seconds
+   */
+  [[nodiscard]] double getEndTime() const;
+
+  [[nodiscard]] TimeStamp getStartTimeStamp() const;
+  [[nodiscard]] TimeStamp getEndTimeStamp() const;
 
   /**
    * Set cue writing direction
@@ -135,21 +169,45 @@ class Cue : public Block {
   void setSnapToLines(bool newSnapToLines);
 
   /**
-   * Get cue text
+   * Get cue text, decoded on first call. Finished cue can be read from any number of threads.
    *
    */
-  std::u32string_view getText();
+  std::u32string_view getText() const;
+
+  /**
+   * Get cue text without decoding
+   *
+   * @return view into utf8 source if text was set from it, otherwise empty view
+   */
+  std::u8string_view getSourceText() const;
+
+  /**
+   * Get cue identifier, decoded on first call. Finished cue can be read from any number of threads.
+   *
+   */
+  std::u32string_view getIdentifier() const;
+
+  /**
+   * Remove text tree, so new tree can be made
+   * @return emptied arena of text tree, in which new tree is made
+   */
+  NodeArena &clearTextTree();
 
   /**
    * Set text tree root
-   *  @param treeRoot root of cue text
+   *  @param treeRoot root of cue text, made in arena of this cue
+   */
+  void setTextTreeRoot(NodeObject *treeRoot);
+
+  /**
+   * Check if text tree is made, cue with empty text has no tree
    */
-  void setTextTreeRoot(std::shared_ptr<NodeObject> treeRoot);
+  [[nodiscard]] bool hasTextTreeRoot() const;
 
   /**
-   * Get text tree root
+   * Get text tree root, it has to exist
    */
-  const NodeObject &getTextTreeRoot();
+  const NodeObject &getTextTreeRoot() const;
 
  private:
   static constexpr double MAX_CUE_SIZE = 100;
@@ -158,7 +216,7 @@ class Cue : public Block {
   static constexpr double LINE_DEFAULT_VALUE = -1;
   static constexpr double POSITION_DEFAULT_VALUE = -1;
 
-  std::u32string identifier;
+  mutable std::u32string identifier;
   const Region *region = nullptr;
   WritingDirection writingDirection = WritingDirection::HORIZONTAL;
   double lineNumber = LINE_DEFAULT_VALUE;
@@ -167,11 +225,23 @@ class Cue : public Block {
   Alignment lineAlignment = Alignment::START;
   Alignment textAlignment = Alignment::CENTER;
   double size = DEFAULT_CUE_SIZE;
-  std::u32string text;
-  double startTime = 0, endTime = 0;
+  mutable std::u32string text;
+  std::u8string_view sourceIdentifier;
+  std::u8string_view sourceText;
+  //Set when string has nothing left to decode from utf8 source
+  mutable std::atomic<bool> isTextDecoded = true;
+  mutable std::atomic<bool> isIdentifierDecoded = true;
+  mutable std::mutex decodingMutex;
+  TimeStamp startTime{0}, endTime{0};
   bool pauseOnExit = false;
   bool snapToLines = true;
-  std::shared_ptr<NodeObject> textTreeRoot;
+  NodeArena textTreeArena;
+  NodeObject *textTreeRoot = nullptr;
+
+  /**
+   * Decode source into decoded string once, threads reading cue at same time wait for first one
+   */
+  void decodeOnce(std::u32string &decoded, std::atomic<bool> &isDecoded, std::u8string_view source) const;
 };
 }; // namespace webvtt
 
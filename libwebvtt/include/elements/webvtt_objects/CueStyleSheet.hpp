@@ -7,7 +7,7 @@ namespace webvtt {
 class CueStyleSheet : public StyleSheet {
  public:
 
-  StyleSheetType getStyleSheetType() override;
+  [[nodiscard]] StyleSheetType getStyleSheetType() const override;
   bool isSelectorAllowed(StyleSelector::SelectorType selectorType) const override;
 
 };
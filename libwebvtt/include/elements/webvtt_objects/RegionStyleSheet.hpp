@@ -6,7 +6,7 @@
 namespace webvtt {
 class RegionStyleSheet : public StyleSheet {
  public:
-  StyleSheetType getStyleSheetType() override;
+  [[nodiscard]] StyleSheetType getStyleSheetType() const override;
   bool isSelectorAllowed(StyleSelector::SelectorType selectorType) const override;
 };
 
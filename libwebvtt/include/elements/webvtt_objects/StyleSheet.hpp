@@ -2,6 +2,7 @@
 #define LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_STYLE_SHEET_HPP_
 
 #include "elements/webvtt_objects/Block.hpp"
+#include "elements/webvtt_objects/CSSDeclarations.hpp"
 #include "elements/style_selectors/StyleSelector.hpp"
 #include "elements/visitors/ICueTreeVisitor.hpp"
 #include <memory>
@@ -26,11 +27,12 @@ class StyleSheet : public Block {
 
   void setSelector(std::unique_ptr<StyleSelector> newSelector);
   [[nodiscard]] const StyleSelector &getSelector() const;
+  [[nodiscard]] bool hasSelector() const;
 
-  void addCSSRule(std::string_view name, std::string_view newValue);
-  [[maybe_unused]] const std::map<std::string, std::string> &getCSSRules();
+  void addCSSRule(CSSProperty property, std::string_view newValue);
+  [[nodiscard]] const CSSDeclarations &getCSSRules() const;
 
-  virtual StyleSheetType getStyleSheetType() = 0;
+  [[nodiscard]] virtual StyleSheetType getStyleSheetType() const = 0;
   static std::unique_ptr<StyleSheet> makeNewStyleSheet(StyleSheetType styleSheetType);
 
   virtual bool isSelectorAllowed(StyleSelector::SelectorType selectorType) const = 0;
@@ -38,7 +40,7 @@ class StyleSheet : public Block {
 
 
  protected:
-  std::map<std::string, std::string> cssRules;
+  CSSDeclarations cssRules;
   std::unique_ptr<StyleSelector> styleSelector;
 
 };
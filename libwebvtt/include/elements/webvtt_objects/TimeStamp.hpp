@@ -0,0 +1,31 @@
+#ifndef LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_TIME_STAMP_HPP_
+#define LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_TIME_STAMP_HPP_
+
+#include <chrono>
+#include <cmath>
+
+namespace webvtt {
+
+/**
+ * Time in webvtt file, timestamps have millisecond precision so they are stored exactly.
+ * Comparing and sorting timestamps needs only integer operations.
+ */
+using TimeStamp = std::chrono::milliseconds;
+
+/**
+ * @return time in seconds
+ */
+constexpr double toSeconds(TimeStamp time) {
+  return std::chrono::duration<double>(time).count();
+}
+
+/**
+ * @return time rounded to nearest millisecond
+ */
+inline TimeStamp fromSeconds(double seconds) {
+  return TimeStamp(std::llround(seconds * TimeStamp::period::den));
+}
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_ELEMENTS_WEBVTT_OBJECTS_TIME_STAMP_HPP_
@@ -0,0 +1,20 @@
+#ifndef FILE_MAPPING_ERROR_H
+#define FILE_MAPPING_ERROR_H
+
+#include <exception>
+
+namespace webvtt
+{
+    class FileMappingError : public std::exception
+    {
+    public:
+        FileMappingError() = default;
+        virtual const char *what() const noexcept
+        {
+            return "File mapping error";
+        }
+    };
+
+} // namespace webvtt
+
+#endif //FILE_MAPPING_ERROR_H
@@ -0,0 +1,102 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_BATCH_PARSER_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_BATCH_PARSER_HPP_
+
+#include "parser/Parser.hpp"
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Parser of many files on fixed number of threads.
+ * Files are distributed to per thread queues, and thread that empties its queue
+ * steals files from other queues. Every thread reuses one parser for all its files.
+ * Class, voice and language names of all files are interned in process wide atom table,
+ * which is not released by parse. Process parsing many batches of files with arbitrary names
+ * can call Atom::clear between batches, when it keeps no objects parsed before.
+ */
+class BatchParser {
+
+ public:
+  /**
+   * Totals over all files of one batch
+   */
+  struct Statistics {
+    size_t fileNumber = 0;
+    size_t failedFileNumber = 0;
+    size_t byteNumber = 0;
+    size_t cueNumber = 0;
+    double seconds = 0;
+  };
+
+  /**
+   * Called on parsing thread for every parsed file, before its parser is reused.
+   * Parsed objects keep views into mapped file, so they are valid only during call.
+   */
+  using FileCallback = std::function<void(const std::filesystem::path &path, Parser &parser)>;
+
+  /**
+   * Extension of files collected from directories
+   */
+  constexpr static std::string_view FILE_EXTENSION = ".vtt";
+
+  /**
+   * @param threadNumber number of parsing threads, 0 to use one per hardware thread
+   */
+  explicit BatchParser(size_t threadNumber = 0);
+
+  BatchParser(const BatchParser &) = delete;
+  BatchParser(BatchParser &&) = delete;
+  BatchParser &operator=(const BatchParser &) = delete;
+  BatchParser &operator=(BatchParser &&) = delete;
+  ~BatchParser() = default;
+
+  /**
+   * Parse all given files, and all files with webvtt extension in given directories and their subdirectories.
+   * Blocks until all files are parsed.
+   * @param paths files and directories
+   * @param callback called for every parsed file, can be empty
+   * @return totals of batch
+   */
+  Statistics parse(const std::vector<std::filesystem::path> &paths, const FileCallback &callback = nullptr);
+
+  /**
+   * Find files that would be parsed for given paths
+   */
+  static std::vector<std::filesystem::path> collectFiles(const std::vector<std::filesystem::path> &paths);
+
+ private:
+  /**
+   * Indices of files that are still not parsed, owned by one thread
+   */
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<size_t> fileIndices;
+  };
+
+  size_t threadNumber;
+
+  /**
+   * Take file from own queue, or steal from other queues if own is empty
+   * @return index of file, or empty if all queues are empty
+   */
+  static std::optional<size_t> takeFile(std::vector<WorkQueue> &queues, size_t ownQueue);
+
+  /**
+   * Use as run method for parsing threads
+   */
+  static void parsingLoop(const std::vector<std::filesystem::path> &files,
+                          std::vector<WorkQueue> &queues,
+                          size_t ownQueue,
+                          const FileCallback &callback,
+                          Statistics &statistics);
+};
+}
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_BATCH_PARSER_HPP_
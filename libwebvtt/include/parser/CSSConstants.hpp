@@ -10,7 +10,7 @@ class CSSConstants {
   static constexpr std::string_view COLOR = "color";
   static constexpr std::string_view OPACITY = "opacity";
   static constexpr std::string_view VISIBILITY = "visibility";
-  static constexpr std::string_view TEXT_SHADOW = "text_shadow";
+  static constexpr std::string_view TEXT_SHADOW = "text-shadow";
   static constexpr std::string_view WHITE_SPACE = "white-space";
   static constexpr std::string_view TEXT_COMBINE_UPRIGHT = "text-combine-upright";
   static constexpr std::string_view RUBY_POSITION = "ruby-position";
@@ -52,13 +52,13 @@ class CSSConstants {
 
   //Animation rules
   static constexpr std::string_view ANIMATION = "animation";
-  static constexpr std::string_view ANIMATION_NAME = "animation-voiceName";
+  static constexpr std::string_view ANIMATION_NAME = "animation-name";
   static constexpr std::string_view ANIMATION_DURATION = "animation-duration";
   static constexpr std::string_view ANIMATION_TIMING_FUNCTION = "animation-timing-function";
   static constexpr std::string_view ANIMATION_DELAY = "animation-delay";
   static constexpr std::string_view ANIMATION_ITERATION_COUNT = "animation-iteration-count";
   static constexpr std::string_view ANIMATION_DIRECTION = "animation-direction";
-  static constexpr std::string_view ANIMATION_FILL_MODE = "animation-fill_mode";
+  static constexpr std::string_view ANIMATION_FILL_MODE = "animation-fill-mode";
   static constexpr std::string_view ANIMATION_PLAY_STATE = "animation-play-state";
 
   //ALLOWED TYPES
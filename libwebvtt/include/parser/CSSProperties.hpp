@@ -0,0 +1,202 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_CSS_PROPERTIES_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_CSS_PROPERTIES_HPP_
+#include "parser/CSSConstants.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace webvtt {
+
+/**
+ * Supported CSS properties, one for every property name in CSSConstants.
+ * Ordered by names, so declarations sorted by property are also sorted by name.
+ */
+enum class CSSProperty : uint8_t {
+  ANIMATION,
+  ANIMATION_DELAY,
+  ANIMATION_DIRECTION,
+  ANIMATION_DURATION,
+  ANIMATION_FILL_MODE,
+  ANIMATION_ITERATION_COUNT,
+  ANIMATION_NAME,
+  ANIMATION_PLAY_STATE,
+  ANIMATION_TIMING_FUNCTION,
+  BACKGROUND,
+  BACKGROUND_ATTACHMENT,
+  BACKGROUND_CLIP,
+  BACKGROUND_COLOR,
+  BACKGROUND_IMAGE,
+  BACKGROUND_POSITION,
+  BACKGROUND_REPEAT,
+  BACKGROUND_SIZE,
+  COLOR,
+  FONT,
+  FONT_FAMILY,
+  FONT_SIZE,
+  FONT_STRETCH,
+  FONT_STYLE,
+  FONT_VARIANT,
+  FONT_WEIGHT,
+  FONT_LINE_HEIGHT,
+  OPACITY,
+  OUTLINE,
+  OUTLINE_COLOR,
+  OUTLINE_STYLE,
+  OUTLINE_WIDTH,
+  RUBY_POSITION,
+  TEXT_COMBINE_UPRIGHT,
+  TEXT_DECORATION,
+  TEXT_DECORATION_COLOR,
+  TEXT_DECORATION_LINE,
+  TEXT_DECORATION_STYLE,
+  TEXT_SHADOW,
+  TRANSITION,
+  TRANSITION_DELAY,
+  TRANSITION_DURATION,
+  TRANSITION_PROPERTY,
+  TRANSITION_TIMING_FUNCTION,
+  VISIBILITY,
+  WHITE_SPACE
+};
+
+/**
+ * Names of CSS properties and constexpr perfect hash from name to property.
+ * Seed of hash is searched when library is compiled, so every name has its own slot of table
+ * and lookup is one hash and one comparison of strings.
+ */
+class CSSProperties {
+ public:
+  CSSProperties() = delete;
+
+  constexpr static size_t PROPERTY_NUMBER = static_cast<size_t>(CSSProperty::WHITE_SPACE) + 1;
+
+  constexpr static std::array<std::string_view, PROPERTY_NUMBER> NAMES = {
+      CSSConstants::ANIMATION,
+      CSSConstants::ANIMATION_DELAY,
+      CSSConstants::ANIMATION_DIRECTION,
+      CSSConstants::ANIMATION_DURATION,
+      CSSConstants::ANIMATION_FILL_MODE,
+      CSSConstants::ANIMATION_ITERATION_COUNT,
+      CSSConstants::ANIMATION_NAME,
+      CSSConstants::ANIMATION_PLAY_STATE,
+      CSSConstants::ANIMATION_TIMING_FUNCTION,
+      CSSConstants::BACKGROUND,
+      CSSConstants::BACKGROUND_ATTACHMENT,
+      CSSConstants::BACKGROUND_CLIP,
+      CSSConstants::BACKGROUND_COLOR,
+      CSSConstants::BACKGROUND_IMAGE,
+      CSSConstants::BACKGROUND_POSITION,
+      CSSConstants::BACKGROUND_REPEAT,
+      CSSConstants::BACKGROUND_SIZE,
+      CSSConstants::COLOR,
+      CSSConstants::FONT,
+      CSSConstants::FONT_FAMILY,
+      CSSConstants::FONT_SIZE,
+      CSSConstants::FONT_STRETCH,
+      CSSConstants::FONT_STYLE,
+      CSSConstants::FONT_VARIANT,
+      CSSConstants::FONT_WEIGHT,
+      CSSConstants::FONT_LINE_HEIGHT,
+      CSSConstants::OPACITY,
+      CSSConstants::OUTLINE,
+      CSSConstants::OUTLINE_COLOR,
+      CSSConstants::OUTLINE_STYLE,
+      CSSConstants::OUTLINE_WIDTH,
+      CSSConstants::RUBY_POSITION,
+      CSSConstants::TEXT_COMBINE_UPRIGHT,
+      CSSConstants::TEXT_DECORATION,
+      CSSConstants::TEXT_DECORATION_COLOR,
+      CSSConstants::TEXT_DECORATION_LINE,
+      CSSConstants::TEXT_DECORATION_STYLE,
+      CSSConstants::TEXT_SHADOW,
+      CSSConstants::TRANSITION,
+      CSSConstants::TRANSITION_DELAY,
+      CSSConstants::TRANSITION_DURATION,
+      CSSConstants::TRANSITION_PROPERTY,
+      CSSConstants::TRANSITION_TIMING_FUNCTION,
+      CSSConstants::VISIBILITY,
+      CSSConstants::WHITE_SPACE
+  };
+
+  static constexpr std::string_view getName(CSSProperty property) {
+    return NAMES[static_cast<size_t>(property)];
+  }
+
+  /**
+   * @return property of given name, or nothing if property is not supported
+   */
+  template<typename Character>
+  static constexpr std::optional<CSSProperty> find(std::basic_string_view<Character> name);
+
+  static constexpr std::optional<CSSProperty> find(std::string_view name) { return find<char>(name); }
+  static constexpr std::optional<CSSProperty> find(std::u32string_view name) { return find<char32_t>(name); }
+
+ private:
+  constexpr static size_t TABLE_SIZE = 256;
+  constexpr static uint8_t EMPTY_SLOT = 0xFF;
+
+  template<typename Character>
+  static constexpr uint32_t hash(std::basic_string_view<Character> name, uint32_t seed) {
+    uint32_t value = seed;
+    for (Character character : name)
+      value = (value ^ static_cast<uint32_t>(character)) * 16777619u;
+    return (value ^ (value >> 15)) % TABLE_SIZE;
+  }
+
+  static constexpr uint32_t findSeed();
+  static constexpr std::array<uint8_t, TABLE_SIZE> makeTable(uint32_t seed);
+
+  static const uint32_t SEED;
+  static const std::array<uint8_t, TABLE_SIZE> TABLE;
+};
+
+constexpr uint32_t CSSProperties::findSeed() {
+  for (uint32_t seed = 2166136261u;; seed++) {
+    std::array<bool, TABLE_SIZE> isUsed{};
+    bool isPerfect = true;
+    for (std::string_view name : NAMES) {
+      uint32_t slot = hash(name, seed);
+      isPerfect = isPerfect && !isUsed[slot];
+      isUsed[slot] = true;
+    }
+    if (isPerfect)
+      return seed;
+  }
+}
+
+constexpr std::array<uint8_t, CSSProperties::TABLE_SIZE> CSSProperties::makeTable(uint32_t seed) {
+  std::array<uint8_t, TABLE_SIZE> table{};
+  for (auto &slot : table)
+    slot = EMPTY_SLOT;
+  for (size_t property = 0; property < PROPERTY_NUMBER; property++)
+    table[hash(NAMES[property], seed)] = static_cast<uint8_t>(property);
+  return table;
+}
+
+inline constexpr uint32_t CSSProperties::SEED = findSeed();
+inline constexpr std::array<uint8_t, CSSProperties::TABLE_SIZE> CSSProperties::TABLE = makeTable(SEED);
+
+template<typename Character>
+constexpr std::optional<CSSProperty> CSSProperties::find(std::basic_string_view<Character> name) {
+  uint8_t slot = TABLE[hash(name, SEED)];
+  if (slot == EMPTY_SLOT)
+    return std::nullopt;
+  std::string_view candidate = NAMES[slot];
+  if (candidate.size() != name.size())
+    return std::nullopt;
+  for (size_t index = 0; index < name.size(); index++) {
+    if (static_cast<uint32_t>(candidate[index]) != static_cast<uint32_t>(name[index]))
+      return std::nullopt;
+  }
+  return static_cast<CSSProperty>(slot);
+}
+
+static_assert(CSSProperties::find(CSSConstants::COLOR) == CSSProperty::COLOR);
+static_assert(CSSProperties::find(CSSConstants::WHITE_SPACE) == CSSProperty::WHITE_SPACE);
+static_assert(!CSSProperties::find(std::string_view("colour")).has_value());
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_CSS_PROPERTIES_HPP_
@@ -0,0 +1,73 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_CHARACTER_CLASS_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_CHARACTER_CLASS_HPP_
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+
+namespace webvtt {
+
+/**
+ * Classes of ASCII characters, as bits in table of character classes.
+ * Characters outside ASCII do not belong to any class.
+ */
+struct CharacterClass {
+  CharacterClass() = delete;
+
+  static constexpr uint8_t WHITE_SPACE = 1 << 0;
+  static constexpr uint8_t DEC_DIGIT = 1 << 1;
+  static constexpr uint8_t HEX_DIGIT = 1 << 2;
+  static constexpr uint8_t ALPHA = 1 << 3;
+  static constexpr uint8_t SPACE_OR_TAB = 1 << 4;
+  static constexpr uint8_t ALPHA_NUMERIC = DEC_DIGIT | ALPHA;
+};
+
+constexpr std::array<uint8_t, 256> makeCharacterClassTable() {
+  std::array<uint8_t, 256> table{};
+  for (char32_t character : std::u32string_view(U"\t\n\f\r "))
+    table[character] |= CharacterClass::WHITE_SPACE;
+  table[U'\t'] |= CharacterClass::SPACE_OR_TAB;
+  table[U' '] |= CharacterClass::SPACE_OR_TAB;
+
+  for (char32_t character = U'0'; character <= U'9'; character++)
+    table[character] |= CharacterClass::DEC_DIGIT | CharacterClass::HEX_DIGIT;
+  for (char32_t character = U'a'; character <= U'z'; character++) {
+    table[character] |= CharacterClass::ALPHA;
+    table[character - U'a' + U'A'] |= CharacterClass::ALPHA;
+    if (character <= U'f') {
+      table[character] |= CharacterClass::HEX_DIGIT;
+      table[character - U'a' + U'A'] |= CharacterClass::HEX_DIGIT;
+    }
+  }
+  return table;
+}
+
+inline constexpr std::array<uint8_t, 256> CHARACTER_CLASS_TABLE = makeCharacterClassTable();
+
+/**
+ * @return true if character belongs to any of given classes
+ */
+constexpr bool isInCharacterClass(uint32_t character, uint8_t classes) {
+  return character < CHARACTER_CLASS_TABLE.size() && (CHARACTER_CLASS_TABLE[character] & classes) != 0;
+}
+
+/**
+ * Character test that can be passed to scanners of ParserUtil and inlined in them
+ */
+template<uint8_t Classes>
+struct CharacterClassTest {
+  constexpr bool operator()(uint32_t character) const {
+    return isInCharacterClass(character, Classes);
+  }
+};
+
+/**
+ * Callable that tells if character is looked for
+ */
+template<typename Predicate>
+concept CharacterPredicate = std::predicate<const Predicate &, uint32_t>;
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_CHARACTER_CLASS_HPP_
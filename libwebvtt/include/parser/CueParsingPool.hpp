@@ -0,0 +1,115 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_CUE_PARSING_POOL_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_CUE_PARSING_POOL_HPP_
+
+#include "buffer/UniquePtrSyncBuffer.hpp"
+#include "elements/webvtt_objects/Cue.hpp"
+#include "elements/webvtt_objects/Region.hpp"
+#include "parser/object_parser/base_classes/CueParserBase.hpp"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace webvtt {
+
+/**
+ * Pool of threads that build cues from collected cue blocks.
+ * Every worker has its own cue parser, and parsed cues are written to cue buffer
+ * in same order in which blocks are submitted.
+ * Regions used by cues must be complete before first block is submitted.
+ */
+class CueParsingPool {
+
+ public:
+  /**
+   * Preprocessed parts of one cue block, as collected by parser
+   */
+  struct CueBlock {
+    std::u32string identifier;
+    std::u32string timingLine;
+    std::u32string text;
+  };
+
+  /**
+   * @param workerNumber number of threads that build cues
+   * @param regions regions to which cues can refer
+   * @param cues buffer in which parsed cues are written
+   * @param defaultLanguage language of cue text, if not set with tags
+   */
+  CueParsingPool(size_t workerNumber,
+                 std::shared_ptr<UniquePtrSyncBuffer<Region>> regions,
+                 std::shared_ptr<UniquePtrSyncBuffer<Cue>> cues,
+                 std::u32string_view defaultLanguage);
+
+  CueParsingPool(const CueParsingPool &) = delete;
+  CueParsingPool(CueParsingPool &&) = delete;
+  CueParsingPool &operator=(const CueParsingPool &) = delete;
+  CueParsingPool &operator=(CueParsingPool &&) = delete;
+  ~CueParsingPool();
+
+  /**
+   * Give block to workers.
+   * Blocks while too many submitted cues are not yet written to cue buffer.
+   */
+  void submit(CueBlock block);
+
+  /**
+   * Wait until all submitted blocks are parsed and written to cue buffer, then stop workers.
+   */
+  void finish();
+
+  /**
+   * Build cue from block, same for parallel parsing and parsing on one thread
+   * @param cueParser parser without current object
+   * @param block collected cue block, its content is moved to cue
+   * @param defaultLanguage language of cue text, if not set with tags
+   * @return parsed cue
+   */
+  static std::unique_ptr<Cue> parseCueBlock(CueParserBase &cueParser,
+                                            CueBlock &block,
+                                            std::u32string_view defaultLanguage);
+
+ private:
+  constexpr static size_t MAX_PENDING_BLOCKS_PER_WORKER = 64;
+
+  struct Job {
+    size_t sequenceNumber = 0;
+    CueBlock block;
+  };
+
+  const std::shared_ptr<UniquePtrSyncBuffer<Region>> regions;
+  const std::shared_ptr<UniquePtrSyncBuffer<Cue>> cues;
+  const std::u32string defaultLanguage;
+  const size_t maxPendingBlocks;
+
+  std::mutex mutex;
+  std::condition_variable jobsCV;
+  std::condition_variable publishedCV;
+
+  std::deque<Job> jobs;
+  //Cues parsed before some cue that precedes them, keyed by sequence number
+  std::map<size_t, std::unique_ptr<Cue>> parsedCues;
+  size_t submittedNumber = 0;
+  size_t publishedNumber = 0;
+  bool finishing = false;
+
+  std::vector<std::thread> workers;
+
+  /**
+   * Use as run method for worker threads.
+   */
+  void workerLoop();
+
+  /**
+   * Write parsed cue and all following ones that are already parsed to cue buffer.
+   * Mutex need to be locked.
+   */
+  void publish(size_t sequenceNumber, std::unique_ptr<Cue> cue);
+};
+}
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_CUE_PARSING_POOL_HPP_
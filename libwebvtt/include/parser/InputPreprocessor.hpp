@@ -0,0 +1,46 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_INPUT_PREPROCESSOR_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_INPUT_PREPROCESSOR_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+namespace webvtt {
+
+/**
+ * Preprocessing of decoded input, done chunk by chunk:
+ * CR LF pair and lone CR are replaced with LF, NULL and U+FFFF with replacement character.
+ * CR at the end of chunk is remembered, so LF at the beginning of next chunk is dropped.
+ */
+class InputPreprocessor {
+
+ public:
+  InputPreprocessor() = default;
+  InputPreprocessor(const InputPreprocessor &) = delete;
+  InputPreprocessor(InputPreprocessor &&) = delete;
+  InputPreprocessor &operator=(const InputPreprocessor &) = delete;
+  InputPreprocessor &operator=(InputPreprocessor &&) = delete;
+
+  /**
+   * Preprocess next chunk of input
+   * @param input decoded characters
+   * @param output must have space for input.size() characters, can be same as input.data()
+   * @return number of written characters
+   */
+  size_t process(std::u32string_view input, char32_t *output);
+
+  /**
+   * Forget CR from previous chunk, so next chunk is processed as beginning of input
+   */
+  void reset();
+
+ private:
+  bool lastReadCR = false;
+
+  /**
+   * Preprocess characters one by one
+   */
+  size_t processScalar(std::u32string_view input, char32_t *output);
+};
+}
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_INPUT_PREPROCESSOR_HPP_
@@ -0,0 +1,33 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_NAMED_REFERENCE_TRIE_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_NAMED_REFERENCE_TRIE_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace webvtt {
+
+/**
+ * HTML named character references, kept in trie that is built at compile time.
+ * Trie is constant data, so nothing is constructed at program start.
+ */
+class NamedReferenceTrie {
+
+ public:
+  NamedReferenceTrie() = delete;
+
+  struct Match {
+    //Number of characters in matched name, 0 if no name matches
+    size_t length = 0;
+    std::u32string_view value;
+  };
+
+  /**
+   * Find longest reference name that is prefix of input, in one walk over input.
+   * Name includes semicolon if reference has one.
+   */
+  static Match longestMatch(std::u32string_view input);
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_NAMED_REFERENCE_TRIE_HPP_
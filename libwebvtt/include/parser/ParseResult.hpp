@@ -0,0 +1,64 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_PARSE_RESULT_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_PARSE_RESULT_HPP_
+
+#include <utility>
+#include <variant>
+
+namespace webvtt {
+
+/**
+ * Reason why parsing of value failed
+ */
+enum class ParseError {
+  EMPTY_INPUT,
+  INVALID_POSITION,
+  INVALID_CHARACTER,
+  INVALID_FORMAT,
+  OUT_OF_RANGE,
+};
+
+/**
+ * Text of parse error, for logging
+ */
+constexpr const char *getParseErrorMessage(ParseError error) {
+  switch (error) {
+    case ParseError::EMPTY_INPUT:return "Parsed value is empty";
+    case ParseError::INVALID_POSITION:return "Parsing position does not point to input";
+    case ParseError::INVALID_CHARACTER:return "Parsed value contains invalid character";
+    case ParseError::INVALID_FORMAT:return "Parsed value has invalid format";
+    case ParseError::OUT_OF_RANGE:return "Parsed value is out of range";
+  }
+  return "Unknown parse error";
+}
+
+/**
+ * Parsed value or reason why parsing failed, returned instead of throwing exception.
+ * Interface follows std::expected.
+ */
+template<typename Value>
+class ParseResult {
+
+ public:
+  ParseResult(Value value) : result(std::move(value)) {}
+  ParseResult(ParseError error) : result(error) {}
+
+  [[nodiscard]] bool hasValue() const { return std::holds_alternative<Value>(result); }
+  explicit operator bool() const { return hasValue(); }
+
+  /**
+   * @throws std::bad_variant_access if parsing failed
+   */
+  [[nodiscard]] const Value &value() const { return std::get<Value>(result); }
+  [[nodiscard]] const Value &operator*() const { return *std::get_if<Value>(&result); }
+
+  /**
+   * Valid only if parsing failed
+   */
+  [[nodiscard]] ParseError error() const { return *std::get_if<ParseError>(&result); }
+
+ private:
+  std::variant<Value, ParseError> result;
+};
+}
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_PARSE_RESULT_HPP_
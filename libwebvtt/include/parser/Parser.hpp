@@ -3,8 +3,9 @@
 
 #include "utf8.h"
 #include "buffer/StringBuffer.hpp"
-#include "buffer/StringSyncBuffer.hpp"
+#include "buffer/StringBufferFactory.hpp"
 #include "buffer/UniquePtrSyncBuffer.hpp"
+#include "buffer/CueSyncBuffer.hpp"
 #include "elements/webvtt_objects/Cue.hpp"
 #include "elements/webvtt_objects/Region.hpp"
 #include "elements/webvtt_objects/CueStyleSheet.hpp"
@@ -12,6 +13,8 @@
 #include "parser/object_parser/base_classes/CueParserBase.hpp"
 #include "parser/object_parser/base_classes/StyleSheetParserBase.hpp"
 #include "parser/object_parser/base_classes/RegionParserBase.hpp"
+#include "parser/InputPreprocessor.hpp"
+#include "parser/CueParsingPool.hpp"
 
 #include <string>
 #include <array>
@@ -19,21 +22,58 @@
 #include <memory.h>
 #include <thread>
 #include <atomic>
+#include <utility>
 
 namespace webvtt {
 
 class Parser {
 
  public:
-  explicit Parser(std::shared_ptr<StringBuffer<char32_t>> inputStream);
+  /**
+   * @param inputStream buffer with decoded data
+   * @param preprocessedBufferType implementation of buffer between preprocessing and parsing thread
+   */
+  explicit Parser(std::shared_ptr<StringBuffer<char32_t>> inputStream,
+                  StringBufferType preprocessedBufferType = StringBufferType::SYNC_BUFFER);
   void setPredefineLanguage(std::u32string_view language);
+
+  /**
+   * Set number of threads that build cues in parallel after header is parsed.
+   * Parsing thread then only splits input into blocks, and cues are still written to cue buffer in order.
+   * Need to be set before startParsing, not used by parseAll.
+   * @param threadNumber number of threads, 0 or 1 to build cues on parsing thread
+   */
+  void setCueParsingThreadNumber(size_t threadNumber);
+
   bool startParsing();
 
+  /**
+   * Parse whole input in calling thread, without starting any thread.
+   * Blocks are collected directly from utf8 input, cue identifiers and text are kept as views into it,
+   * so input need to outlive parsed cues. Text is decoded into reused buffer to build cue tree,
+   * cue decodes its own copy of identifier or text only when it is read.
+   * Parsed objects are in cue, region and style sheet buffers after return, with their input ended.
+   * Input stream given in constructor is not used.
+   * @param input utf8 encoded content of webvtt file
+   * @return false if parsing already started
+   */
+  bool parseAll(std::u8string_view input);
+
+  /**
+   * Prepare parser for parsing new input with parseAll, keeping its object parsers.
+   * Objects parsed from previous input are deleted from buffers.
+   * @return false if parsing threads were started with startParsing
+   */
+  bool reset();
+
   [[nodiscard]] std::shared_ptr<UniquePtrSyncBuffer<Region>> getRegionBuffer();
-  [[nodiscard]] std::shared_ptr<UniquePtrSyncBuffer<Cue>> getCueBuffer();
+  /**
+   * @return buffer of parsed cues, which can also be queried by time while parsing
+   */
+  [[nodiscard]] std::shared_ptr<CueSyncBuffer> getCueBuffer();
   [[nodiscard]] std::shared_ptr<UniquePtrSyncBuffer<StyleSheet>> getStyleSheetBuffer();
 
-  Parser() = default;
+  Parser();
   Parser(const Parser &) = delete;
   Parser(Parser &&) = delete;
   Parser &operator=(const Parser &) = delete;
@@ -45,12 +85,20 @@ class Parser {
   constexpr static std::u32string_view STYLE_NAME = U"STYLE";
   constexpr static std::u32string_view REGION_NAME = U"REGION";
 
+  constexpr static std::u8string_view EXTENSION_NAME_UTF8 = u8"WEBVTT";
+  constexpr static std::u8string_view STYLE_NAME_UTF8 = u8"STYLE";
+  constexpr static std::u8string_view REGION_NAME_UTF8 = u8"REGION";
+  constexpr static std::u8string_view TIME_STAMP_SEPARATOR_UTF8 = u8"-->";
+  constexpr static std::u8string_view LINE_END_CHARACTERS = u8"\r\n";
+
   std::u32string predefinedLanguage;
 
   constexpr static int EXTENSION_NAME_LENGTH = 6;
-  constexpr static int DEFAULT_READ_NUMBER = 15;
+  constexpr static int DEFAULT_READ_NUMBER = 1024;
 
-  bool lastReadCR = false;
+  size_t cueParsingThreadNumber = 0;
+
+  InputPreprocessor preprocessor;
   bool seenCue = false;
   bool seenFirstCue = false;
 
@@ -59,7 +107,7 @@ class Parser {
   bool parsingStarted = false;
 
   std::shared_ptr<StringBuffer<char32_t>> inputStream;
-  std::unique_ptr<StringSyncBuffer<char32_t>> preprocessedStream;
+  std::unique_ptr<StringBuffer<char32_t>> preprocessedStream;
 
   std::unique_ptr<std::thread> preProcessingThread;
   std::unique_ptr<std::thread> parsingThread;
@@ -68,17 +116,42 @@ class Parser {
   std::unique_ptr<StyleSheetParserBase> styleSheetParser;
   std::unique_ptr<RegionParserBase> regionParser;
 
-  std::shared_ptr<UniquePtrSyncBuffer<Cue>> cues;
+  std::unique_ptr<CueParsingPool> cueParsingPool;
+
+  std::shared_ptr<CueSyncBuffer> cues;
   std::shared_ptr<UniquePtrSyncBuffer<Region>> regions;
   std::shared_ptr<UniquePtrSyncBuffer<StyleSheet>> styleSheets;
 
-  void cleanDecodedData(std::u32string &input);
-
   void preProcessDecodedStreamLoop();
 
   void parsingLoop();
 
   bool collectBlock(bool inHeader);
+
+  /**
+   * Same as parsingLoop, but reading directly from utf8 input
+   * @param input valid utf8 input
+   */
+  void parsingLoopUTF8(std::u8string_view input);
+
+  /**
+   * Same as collectBlock, but reading directly from utf8 input
+   * @param input valid utf8 input
+   * @param position position in input at which block starts, moved after collected block
+   * @param inHeader true if block is collected in file header
+   * @return true if new object is collected
+   */
+  bool collectBlockUTF8(std::u8string_view input, size_t &position, bool inHeader);
+
+  /**
+   * Read line from utf8 input, line end is LF, CR or CR LF
+   * @param input valid utf8 input
+   * @param position position at which line starts, moved after line end
+   * @return line without line end, and false if input ended before line end
+   */
+  static std::pair<std::u8string_view, bool> readLine(std::u8string_view input, size_t &position);
+
+  static void skipLineEnds(std::u8string_view input, size_t &position);
 };
 
 } // namespace webvtt
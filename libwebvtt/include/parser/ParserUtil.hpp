@@ -3,11 +3,13 @@
 
 #include "utf8.h"
 #include "logger/LoggingUtility.hpp"
+#include "parser/ParseResult.hpp"
+#include "parser/CharacterClass.hpp"
+#include "elements/webvtt_objects/TimeStamp.hpp"
 #include <string>
 #include <algorithm>
 #include <tuple>
 #include <map>
-#include <functional>
 #include <array>
 #include <set>
 
@@ -18,10 +20,6 @@ class ParserUtil {
   ParserUtil() = delete;
 
   static const std::map<uint32_t, std::u32string> numberHTMLReferences;
-  static const std::map<std::string, std::u32string> namedHTMLREferences;
-
-  static constexpr uint32_t MAX_NAMED_HTML_REF_LENGTH = 31;
-
   static const std::set<uint32_t> unallowedNumbers;
 
   static const std::array<uint32_t, 4> low_border;
@@ -105,6 +103,21 @@ class ParserUtil {
 
   static std::u32string utf8to32(std::u8string_view s);
 
+  /**
+   * Check if utf8 text is unchanged by preprocessing, so it can be used without decoding whole input
+   * @param s utf8 text
+   * @return false if text contain CR, NULL or U+FFFF
+   */
+  static bool isPreprocessedUTF8(std::u8string_view s);
+
+  /**
+   * Decode utf8 text and preprocess it in same way as whole input:
+   * CR LF pair and lone CR are replaced with LF, NULL and U+FFFF with replacement character
+   * @param s utf8 text
+   * @return decoded text
+   */
+  static std::u32string decodePreprocessedUTF8(std::u8string_view s);
+
   static constexpr std::u32string_view TIME_STAMP_SEPARATOR = U"-->";
   static constexpr std::u32string_view EMPTY_STRING_VIEW = U"";
 
@@ -117,19 +130,36 @@ class ParserUtil {
   static constexpr std::u32string_view LANG_ATTRIBUTE_MARK = U"lang";
   static constexpr std::u32string_view VOICE_ATTRIBUTE_MARK = U"voice";
 
-  static bool isASCIIWhiteSpaceCharacter(uint32_t character);
+  static constexpr bool isASCIIWhiteSpaceCharacter(uint32_t character) {
+    return isInCharacterClass(character, CharacterClass::WHITE_SPACE);
+  }
+
+  static constexpr bool isAsciiDecDigit(uint32_t character) {
+    return isInCharacterClass(character, CharacterClass::DEC_DIGIT);
+  }
+  static constexpr bool isAsciiHexDigit(uint32_t character) {
+    return isInCharacterClass(character, CharacterClass::HEX_DIGIT);
+  }
 
-  static bool isAsciiDecDigit(uint32_t character);
-  static bool isAsciiHexDigit(uint32_t character);
+  static constexpr bool isAsciiAlphaNumeric(uint32_t character) {
+    return isInCharacterClass(character, CharacterClass::ALPHA_NUMERIC);
+  }
 
-  static bool isAsciiAlphaNumeric(uint32_t character);
+  /**
+   * Character tests for scanners, calls to them are inlined
+   */
+  static constexpr CharacterClassTest<CharacterClass::WHITE_SPACE> IS_WHITE_SPACE{};
+  static constexpr CharacterClassTest<CharacterClass::SPACE_OR_TAB> IS_SPACE_OR_TAB{};
+  static constexpr CharacterClassTest<CharacterClass::DEC_DIGIT> IS_DEC_DIGIT{};
+  static constexpr CharacterClassTest<CharacterClass::HEX_DIGIT> IS_HEX_DIGIT{};
 
   static void checkIfIteratorPointToInput(std::u32string_view input, const std::u32string_view::iterator &position);
 
+  template<CharacterPredicate Predicate>
   static std::string
   collectCharacters(std::u32string_view input,
                     std::u32string_view::iterator &position,
-                    const std::function<bool(uint32_t character)> &isLookedCharacter);
+                    const Predicate &isLookedCharacter);
 
   //TODO add dot option
   static double
@@ -152,9 +182,18 @@ class ParserUtil {
   static std::u32string_view
   parseUntilCharacter(std::u32string_view input, uint32_t character, std::u32string_view::iterator &position);
 
+  template<CharacterPredicate Predicate>
   static std::u32string_view parseWhileCondition(std::u32string_view input, std::u32string_view::iterator &position,
-                                                 const std::function<bool(uint32_t)> &condition,
+                                                 const Predicate &condition,
                                                  uint8_t maxNumberOfCharacters);
+
+  /**
+   * Move position to first character for which condition holds, or to end of input
+   * @return skipped part of input
+   */
+  template<CharacterPredicate Predicate>
+  static std::u32string_view parseUntilCondition(std::u32string_view input, std::u32string_view::iterator &position,
+                                                 const Predicate &condition);
   static std::u32string_view
   parseUntilAnyOfGivenCharacters(std::u32string_view input,
                                  std::u32string_view characters,
@@ -168,16 +207,36 @@ class ParserUtil {
 
   static void clearAndSetCharacter(std::u32string &input, uint32_t characterToSet);
 
-  static void strip(std::u32string_view &input, const std::function<bool(uint32_t)> &isAskedCharacter);
-  static void strip(std::u32string &input, const std::function<bool(uint32_t)> &isAskedCharacter);
+  template<CharacterPredicate Predicate>
+  static void strip(std::u32string_view &input, const Predicate &isAskedCharacter);
+  template<CharacterPredicate Predicate>
+  static void strip(std::u32string &input, const Predicate &isAskedCharacter);
 
+  template<CharacterPredicate Predicate>
   static void replaceAllSequenceOfCharactersWithGivenCharacter(std::u32string &input,
-                                                               const std::function<bool(uint32_t)> &isAskedCharacter,
+                                                               const Predicate &isAskedCharacter,
                                                                uint32_t character);
 
-  static double
+  static TimeStamp
   parseTimeStamp(std::u32string_view input, std::u32string_view::iterator &position);
 
+  /**
+   * Variants of number and timestamp parsing that report failure in result instead of throwing.
+   * They do not allocate, and numbers are converted from ASCII with std::from_chars.
+   */
+  static ParseResult<double>
+  tryParsePercentage(std::u32string_view input);
+  static ParseResult<double>
+  tryParseFloatPointingNumber(std::u32string_view input);
+  static ParseResult<long>
+  tryParseLongNumber(std::u32string_view input, uint8_t base = 10);
+  static ParseResult<long>
+  tryParseLongNumber(std::string_view input, uint8_t base = 10);
+  static ParseResult<std::tuple<double, double>>
+  tryParseCoordinates(std::u32string_view coordinates, uint32_t separator);
+  static ParseResult<TimeStamp>
+  tryParseTimeStamp(std::u32string_view input, std::u32string_view::iterator &position);
+
   static std::u32string_view makeStringViewFromIterator(std::u32string_view input,
                                                         const std::u32string_view::iterator &begin,
                                                         const typename std::u32string_view::iterator &end);
@@ -204,4 +263,6 @@ class ParserUtil {
 };
 }; // namespace webvtt
 
+#include "templates/parser/ParserUtil.tpp"
+
 #endif // LIBWEBVTT_INCLUDE_PARSER_OBJECT_PARSER_PARSER_UTIL_HPP_
\ No newline at end of file
@@ -30,8 +30,12 @@ class FetchSelectorState : public StyleState {
   virtual std::unique_ptr<StyleSelector> makeNewStyleSelector(StyleSheetParser &parser) = 0;
   virtual void preprocessBuffer(StyleSheetParser &parser) = 0;
 
-  bool escapedSequence = false;
-  uint8_t counterOfEscapedSequence = 0;
+ private:
+  /**
+   * Preprocess buffer of selector
+   * @return false if buffer is not valid selector and parser is moved to error state
+   */
+  bool isBufferAccepted(StyleSheetParser &parser);
 };
 
 } // namespace webvtt
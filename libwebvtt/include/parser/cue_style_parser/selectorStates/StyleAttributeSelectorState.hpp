@@ -23,6 +23,12 @@ class StyleAttributeSelectorState : public FetchSelectorState {
   void preprocessBuffer(StyleSheetParser &parser) override;
 
   void foundDefaultBehaviour(StyleSheetParser &parser, uint32_t character) override;
+  /**
+   * Collect all characters until closing square bracket, so white space and quoted values stay in attribute
+   */
+  bool additionalBehaviour(StyleSheetParser &parser, uint32_t character) override;
+  static bool isAttributeClosed(std::u32string_view attribute);
+  static void stripQuotes(std::u32string_view &value);
 
   void checkIfValueGivenAsString(StyleSheetParser &parser);
 
@@ -0,0 +1,19 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_CUE_STYLE_PARSER_SELECTOR_STATES_STYLE_COMBINATOR_STATE_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_CUE_STYLE_PARSER_SELECTOR_STATES_STYLE_COMBINATOR_STATE_HPP_
+#include "parser/cue_style_parser/states/StyleState.hpp"
+
+namespace webvtt {
+
+/**
+ * State after combinator found behind selector, white space around combinator is skipped in it.
+ * White space found first is descendant combinator, which is replaced by explicit combinator if one follows.
+ */
+class StyleCombinatorState : public StyleState {
+ public:
+  StyleCombinatorState() = default;
+  void processState(StyleSheetParser &parser) override;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_CUE_STYLE_PARSER_SELECTOR_STATES_STYLE_COMBINATOR_STATE_HPP_
@@ -2,8 +2,8 @@
 #define LIBWEBVTT_INCLUDE_PARSER_CUE_STYLE_PARSER_STATES__STYLE_STATE_HPP_
 
 #include <stdint.h>
-#include <memory>
-#include <map>
+#include <array>
+#include <cstddef>
 
 namespace webvtt
 {
@@ -48,14 +48,22 @@ namespace webvtt
 
     virtual ~StyleState() = default;
 
-    static StyleState *getInstance(StyleStateType styleStateType);
+    /**
+     * @return state object shared by all parsers, nullptr for types without state
+     */
+    static StyleState *getInstance(StyleStateType styleStateType) {
+      return statesInstance[static_cast<size_t>(styleStateType)];
+    }
 
   protected:
     static uint32_t getNextCharacter(StyleSheetParser &parser);
 
   private:
-    static std::map<StyleStateType, std::unique_ptr<StyleState>> statesInstance;
-    static std::unique_ptr<StyleState> makeNewState(StyleStateType styleStateType);
+    constexpr static size_t STATE_TYPE_NUMBER = static_cast<size_t>(StyleStateType::END_COMMENT_STATE) + 1;
+    using StatesArray = std::array<StyleState *, STATE_TYPE_NUMBER>;
+
+    static const StatesArray statesInstance;
+    static constexpr StatesArray makeAllStates();
   };
 
 }
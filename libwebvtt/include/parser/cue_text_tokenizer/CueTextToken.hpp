@@ -0,0 +1,54 @@
+#ifndef LIBWEBVTT_INCLUDE_PARSER_CUE_TEXT_TOKENIZER_CUE_TEXT_TOKEN_HPP_
+#define LIBWEBVTT_INCLUDE_PARSER_CUE_TEXT_TOKENIZER_CUE_TEXT_TOKEN_HPP_
+
+#include "elements/cue_nodes/NodeObject.hpp"
+#include "elements/cue_nodes/NodeArena.hpp"
+#include <span>
+#include <stack>
+#include <string>
+
+namespace webvtt {
+
+/**
+ * Token of cue text, returned by value from tokenizer.
+ * Views point to cue text or to buffers of tokenizer, so they are valid until next token is read.
+ */
+struct CueTextToken {
+  enum class TokenType {
+    STRING,
+    START_TAG,
+    END_TAG,
+    TIME_STAMP_TAG
+  };
+
+  TokenType type = TokenType::STRING;
+  /**
+   * Text of string token or name of tag
+   */
+  std::u32string_view value;
+  std::span<const std::u32string_view> classes;
+  std::u32string_view annotation;
+
+  /**
+   * Make token without classes and annotation
+   */
+  static CueTextToken makeToken(TokenType type, std::u32string_view value) {
+    return {.type = type, .value = value, .classes = {}, .annotation = {}};
+  }
+
+  /**
+   * Change cue text tree by token
+   * @param nodeObject node to which token is applied, changed to node for next token
+   * @param languages stack of languages of nodes opened so far
+   * @param arena arena of tree, in which new nodes and copies of token strings are made
+   */
+  void process(NodeObject *&nodeObject, std::stack<Atom> &languages, NodeArena &arena) const;
+
+ private:
+  void processStartTag(NodeObject *&nodeObject, std::stack<Atom> &languages, NodeArena &arena) const;
+  void processTimeStampTag(NodeObject *&nodeObject, NodeArena &arena) const;
+};
+
+} // namespace webvtt
+
+#endif // LIBWEBVTT_INCLUDE_PARSER_CUE_TEXT_TOKENIZER_CUE_TEXT_TOKEN_HPP_
@@ -1,40 +1,97 @@
 #ifndef LIBWEBVTT_INCLUDE_PARSER_CUE_TEXT_TOKENIZER_CUE_TEXT_TOKENIZER_HPP_
 #define LIBWEBVTT_INCLUDE_PARSER_CUE_TEXT_TOKENIZER_CUE_TEXT_TOKENIZER_HPP_
 
-#include "parser/cue_text_tokenizer/states/CueTextTokenizerState.hpp"
-#include "parser/cue_text_tokenizer/tokens/Token.hpp"
-#include "state_machine/StateMachineForParsingText.hpp"
+#include "parser/cue_text_tokenizer/CueTextToken.hpp"
+#include <cstdint>
+#include <optional>
 #include <string>
-#include <list>
+#include <vector>
 
 namespace webvtt {
 
-class CueTextTokenizer : public StateMachineForParsingText<CueTextTokenizerState,
-                                                           CueTextTokenizerState::TokenizerState> {
+/**
+ * Splits cue text to tokens. States of tokenizer are values of enum, dispatched by one switch,
+ * and tokens are values with views into cue text, so no memory is allocated for plain tokens.
+ */
+class CueTextTokenizer {
  public:
-  constexpr static uint32_t STOP_TOKENIZER = 0xFFFF;
+  enum class TokenizerState {
+    DATA,
+    TAG,
+    START_TAG,
+    START_TAG_CLASS,
+    START_TAG_ANNOTATION,
+    END_TAG,
+    TIME_STAMP_TAG
+  };
 
-  explicit CueTextTokenizer() {
-    currentState = CueTextTokenizerState::getInstance(CueTextTokenizerState::TokenizerState::DATA);
-  }
-  std::unique_ptr<Token> getNextToken();
+  /**
+   * Passed to states at end of input, it is not code point so it never matches character of input
+   */
+  constexpr static uint32_t STOP_TOKENIZER = 0x110000;
 
-  inline std::u32string &getResult() { return result; }
+  CueTextTokenizer() = default;
+  CueTextTokenizer(const CueTextTokenizer &) = delete;
+  CueTextTokenizer(CueTextTokenizer &&) = delete;
+  CueTextTokenizer &operator=(const CueTextTokenizer &) = delete;
+  CueTextTokenizer &operator=(CueTextTokenizer &&) = delete;
+  ~CueTextTokenizer() = default;
 
-  inline std::u32string &getBuffer() { return buffer; }
+  void setText(std::u32string_view newInput);
+  inline std::u32string_view getInput() const { return input; }
+  inline std::u32string_view::iterator &getCurrentPosition() { return currentPosition; }
 
-  inline std::list<std::u32string> &getClasses() { return classes; }
-
-  void addBufferToClasses() {
-    if (!this->buffer.empty())
-      this->classes.push_back(this->buffer);
-  }
+  /**
+   * Read token that starts at current position
+   * @return token whose views are valid until next call and as long as input
+   */
+  CueTextToken getNextToken();
 
  private:
-  std::u32string buffer;
+  /**
+   * Characters of token, viewed in input while they follow each other there
+   * and copied to buffer only when they do not, e.g. after character reference
+   */
+  class TokenText {
+   public:
+    void clear();
+    void push(std::u32string_view::iterator character);
+    void append(std::u32string_view::iterator first, std::u32string_view::iterator last);
+    void append(std::u32string_view text);
+    [[nodiscard]] std::u32string_view view() const;
+    [[nodiscard]] inline bool empty() const { return view().empty(); }
+
+   private:
+    void copyToBuffer();
+
+    std::u32string_view::iterator begin{};
+    std::u32string_view::iterator end{};
+    bool isCopied = false;
+    std::u32string buffer;
+  };
+
+  void advance();
+  /**
+   * Append character reference at current position to tag name or text, or ampersand if there is none
+   */
+  void appendHTMLCharacter(std::u32string_view::iterator ampersand,
+                           std::optional<uint32_t> additionalCharacter, bool isInAttribute);
+  void addClass(std::u32string_view::iterator classEnd);
+  CueTextToken makeStartTagToken();
+  /**
+   * Strip annotation and replace white space sequences in it with single space
+   */
+  void collapseAnnotation();
+
+  std::u32string_view input{};
+  std::u32string_view::iterator currentPosition{};
 
-  std::u32string result;
-  std::list<std::u32string> classes;
+  TokenText result;
+  TokenText annotationText;
+  std::u32string collapsedAnnotation;
+  std::u32string_view annotation;
+  std::u32string_view::iterator classStart{};
+  std::vector<std::u32string_view> classes;
 };
 
 } // namespace webvtt
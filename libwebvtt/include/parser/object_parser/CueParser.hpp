@@ -30,6 +30,8 @@ class CueParser : public CueParserBase {
  */
   void setTextToObject(std::u32string text) override;
 
+  void setTextToObject(std::u8string_view text) override;
+
   void parseTextStyleAndMakeStyleTree(std::u32string_view defaultLanguage = U"") override;
 
   explicit CueParser(std::shared_ptr<UniquePtrSyncBuffer<Region>> regions) : currentRegions(std::move(regions)) {}
@@ -46,6 +48,10 @@ class CueParser : public CueParserBase {
 
   std::unique_ptr<CueTextTokenizer> cueTextTokenizer = std::make_unique<CueTextTokenizer>();
 
+  //Text of every cue set from utf8 source is decoded here to build its tree, buffer is reused for all cues,
+  //so cue keeps only view and decodes its own copy only if getText is called
+  std::u32string decodedText;
+
   //HYPHEN-MINUS HYPHEN_MINUS HYPHEN_GREATER
   static constexpr std::u32string_view TIME_STAMP_SEPARATOR = U"-->";
 
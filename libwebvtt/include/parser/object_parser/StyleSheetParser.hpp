@@ -26,19 +26,32 @@ class StyleSheetParser : public StyleSheetParserBase,
   }
 
   void buildObjectFromString(std::u32string_view input) override;
-  void addCSSRule(std::string_view name, std::string_view value);
+  void addCSSRule(CSSProperty property, std::string_view value);
 
   void addSelectorToCurrentCombinatorSelectorList();
   void addSelectorToCurrentCompoundSelectorList(std::unique_ptr<StyleSelector> styleSelector);
   void addSelectorToCurrentObject();
 
   void setCombinatorToMostRecentSelector(StyleSelector::StyleSelectorCombinator styleSelectorCombinator);
+  /**
+   * @return combinator that follows most recent selector, UNDEFINED if there is no selector
+   */
+  [[nodiscard]] StyleSelector::StyleSelectorCombinator getCombinatorOfMostRecentSelector() const;
 
   void addCurrentObjectToStyleSheetList();
 
   inline std::u32string &getBuffer() { return buffer; }
   inline std::u32string &getAdditionalBuffer() { return additionalBuffer; }
 
+  /**
+   * Css escaped sequence being collected in selector, kept in parser because states are shared
+   */
+  struct EscapedSequence {
+    bool inSequence = false;
+    uint8_t characterCounter = 0;
+  };
+  inline EscapedSequence &getEscapedSequence() { return escapedSequence; }
+
   inline void setEndParsing(bool isEnd) { this->endParsing = isEnd; }
   [[nodiscard]] inline bool isEndParsing() const { return endParsing; }
 
@@ -62,6 +75,7 @@ class StyleSheetParser : public StyleSheetParserBase,
 
   std::u32string buffer;
   std::u32string additionalBuffer;
+  EscapedSequence escapedSequence;
 
   StyleState *savedStateBeforeComment = nullptr;
   StyleState::StyleStateType savedPseudoState = StyleState::StyleStateType::NONE;
@@ -9,6 +9,12 @@ class CueParserBase : public ObjectParser<Cue> {
  public:
   virtual void setTextToObject(std::u32string text) = 0;
 
+  /**
+   * Set cue text as view into utf8 source, which need to outlive cue
+   * @param text cue text
+   */
+  virtual void setTextToObject(std::u8string_view text) = 0;
+
   virtual void parseTextStyleAndMakeStyleTree(std::u32string_view defaultLanguage = U"") = 0;
 };
 }
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <buffer/NonSyncStringBuffer.hpp>
 
+#include "logger/LoggingUtility.hpp"
 
 namespace webvtt {
 template<typename OneElemType>
@@ -45,6 +48,46 @@ std::optional <OneElemType> NonSyncStringBuffer<OneElemType>::readOne() {
 }
 template<typename OneElemType>
 bool NonSyncStringBuffer<OneElemType>::isReadDone() {
-  return this->readPosition == this->buffer.end() && this->inputEnded;
+  return this->readPosition == this->buffer.length() && this->inputEnded;
+}
+template<typename OneElemType>
+bool NonSyncStringBuffer<OneElemType>::writeChunk(std::span<const OneElemType> input) {
+  try {
+    if (this->inputEnded)
+      return false;
+
+    this->buffer.append(input.begin(), input.end());
+
+    return true;
+  }
+  catch (const std::bad_alloc &error) {
+    DILOGE(error.what());
+    this->setInputEnded();
+    throw;
+  }
+}
+template<typename OneElemType>
+size_t NonSyncStringBuffer<OneElemType>::readChunk(std::span<OneElemType> output) {
+  size_t number = std::min(output.size(), this->buffer.length() - this->readPosition);
+  std::copy_n(this->buffer.begin() + this->readPosition, number, output.begin());
+  this->readPosition += number;
+
+  return number;
+}
+template<typename OneElemType>
+void NonSyncStringBuffer<OneElemType>::readUntilSpecificData(std::basic_string<OneElemType> &output,
+                                                             const OneElemType &specificData) {
+  auto found = this->buffer.find(specificData, this->readPosition);
+  if (found == std::basic_string<OneElemType>::npos)
+    found = this->buffer.length();
+
+  output.append(this->buffer, this->readPosition, found - this->readPosition);
+  this->readPosition = found;
+}
+template<typename OneElemType>
+void NonSyncStringBuffer<OneElemType>::clearBufferUntilReadPosition() {
+  if (this->readPosition < this->buffer.length() - this->readPosition)
+    return;
+  StringBuffer<OneElemType>::clearBufferUntilReadPosition();
 }
 }
\ No newline at end of file
@@ -23,16 +23,39 @@ std::basic_string<OneElemType> StringBuffer<OneElemType>::readMultiple(uint32_t
   return values;
 }
 template<typename OneElemType>
+bool StringBuffer<OneElemType>::writeChunk(std::span<const OneElemType> input) {
+  for (auto one : input) {
+    if (!this->writeOne(one))
+      return false;
+  }
+  return true;
+}
+template<typename OneElemType>
+size_t StringBuffer<OneElemType>::readChunk(std::span<OneElemType> output) {
+  size_t number = 0;
+  while (number < output.size()) {
+    auto result = this->readOne();
+    if (!result.has_value())
+      break;
+    output[number++] = result.value();
+  }
+  return number;
+}
+template<typename OneElemType>
 std::basic_string<OneElemType> StringBuffer<OneElemType>::readUntilSpecificData(const OneElemType &specificData) {
   std::basic_string<OneElemType> values;
-
+  this->readUntilSpecificData(values, specificData);
+  return values;
+}
+template<typename OneElemType>
+void StringBuffer<OneElemType>::readUntilSpecificData(std::basic_string<OneElemType> &output,
+                                                      const OneElemType &specificData) {
   auto result = this->peekOne();
   while (result.has_value() && result.value() != specificData) {
     result = this->readOne();
-    values.push_back(result.value());
+    output.push_back(result.value());
     result = this->peekOne();
   }
-  return values;
 }
 template<typename OneElemType>
 std::basic_string<OneElemType> StringBuffer<OneElemType>::readWhileSpecificData(const OneElemType &specificData) {
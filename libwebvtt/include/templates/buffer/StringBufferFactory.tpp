@@ -0,0 +1,19 @@
+
+#include <buffer/StringBufferFactory.hpp>
+#include <buffer/StringSyncBuffer.hpp>
+#include <buffer/StringRingBuffer.hpp>
+
+namespace webvtt {
+
+template<typename OneElemType>
+std::unique_ptr<StringBuffer<OneElemType>> makeStringBuffer(StringBufferType type) {
+  switch (type) {
+    case StringBufferType::RING_BUFFER:
+      return std::make_unique<StringRingBuffer<OneElemType>>();
+    case StringBufferType::SYNC_BUFFER:
+    default:
+      return std::make_unique<StringSyncBuffer<OneElemType>>();
+  }
+}
+
+}
@@ -0,0 +1,315 @@
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <thread>
+#include <buffer/StringRingBuffer.hpp>
+
+#include "logger/LoggingUtility.hpp"
+
+namespace webvtt {
+
+template<typename OneElemType>
+StringRingBuffer<OneElemType>::StringRingBuffer(size_t minimalCapacity)
+    : capacity(roundCapacity(minimalCapacity)), mask(capacity - 1) {
+  ring = std::make_unique<OneElemType[]>(capacity);
+}
+template<typename OneElemType>
+size_t StringRingBuffer<OneElemType>::roundCapacity(size_t minimalCapacity) {
+  return std::bit_ceil(std::max<size_t>(minimalCapacity, 1));
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::isInputEnded() {
+  return ended.load(std::memory_order_acquire);
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::setInputEnded() {
+  ended.store(true);
+
+  dataEvents.fetch_add(1);
+  dataEvents.notify_all();
+  spaceEvents.fetch_add(1);
+  spaceEvents.notify_all();
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::isReadDone() {
+  return waitForData() == 0;
+}
+template<typename OneElemType>
+std::optional<OneElemType> StringRingBuffer<OneElemType>::peekOne() {
+  if (waitForData() == 0)
+    return std::nullopt;
+
+  return ring[this->readPosition & mask];
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::writeMultiple(const std::basic_string<OneElemType> &input) {
+  return this->writeChunk(input);
+}
+template<typename OneElemType>
+std::basic_string<OneElemType> StringRingBuffer<OneElemType>::readMultiple(uint32_t number) {
+  std::basic_string<OneElemType> values;
+
+  while (values.length() < number) {
+    size_t available = waitForData();
+    if (available == 0)
+      break;
+
+    size_t start = this->readPosition & mask;
+    size_t readNumber = std::min({available, number - values.length(), capacity - start});
+    values.append(ring.get() + start, readNumber);
+    this->readPosition += readNumber;
+    releaseReadData(false);
+  }
+  return values;
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::writeChunk(std::span<const OneElemType> input) {
+  if (ended.load(std::memory_order_acquire))
+    return false;
+
+  while (!input.empty()) {
+    size_t freeSpace = waitForSpace();
+    if (freeSpace == 0)
+      return false;
+
+    size_t position = writePosition.load(std::memory_order_relaxed);
+    size_t start = position & mask;
+    size_t number = std::min(freeSpace, input.size());
+    size_t untilEnd = std::min(number, capacity - start);
+
+    std::copy_n(input.begin(), untilEnd, ring.get() + start);
+    std::copy_n(input.begin() + untilEnd, number - untilEnd, ring.get());
+
+    //Whole batch is published at once
+    writePosition.store(position + number);
+    signal(dataEvents, readerWaiting);
+
+    input = input.subspan(number);
+  }
+  return true;
+}
+template<typename OneElemType>
+size_t StringRingBuffer<OneElemType>::readChunk(std::span<OneElemType> output) {
+  size_t available = waitForData();
+  size_t start = this->readPosition & mask;
+  size_t number = std::min(available, output.size());
+  size_t untilEnd = std::min(number, capacity - start);
+
+  std::copy_n(ring.get() + start, untilEnd, output.begin());
+  std::copy_n(ring.get(), number - untilEnd, output.begin() + untilEnd);
+
+  this->readPosition += number;
+  releaseReadData(false);
+  return number;
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::readUntilSpecificData(std::basic_string<OneElemType> &output,
+                                                          const OneElemType &specificData) {
+  while (true) {
+    size_t available = waitForData();
+    if (available == 0)
+      return;
+
+    size_t start = this->readPosition & mask;
+    auto segmentBegin = ring.get() + start;
+    auto segmentEnd = segmentBegin + std::min(available, capacity - start);
+    auto found = std::find(segmentBegin, segmentEnd, specificData);
+
+    output.append(segmentBegin, found);
+    this->readPosition += found - segmentBegin;
+    releaseReadData(false);
+
+    if (found != segmentEnd)
+      return;
+  }
+}
+template<typename OneElemType>
+std::basic_string<OneElemType> StringRingBuffer<OneElemType>::readWhileSpecificData(const OneElemType &specificData) {
+  std::basic_string<OneElemType> values;
+
+  while (true) {
+    size_t available = waitForData();
+    if (available == 0)
+      return values;
+
+    while (available > 0 && ring[this->readPosition & mask] == specificData) {
+      values.push_back(specificData);
+      this->readPosition++;
+      available--;
+    }
+    releaseReadData(false);
+
+    if (available > 0)
+      return values;
+  }
+}
+template<typename OneElemType>
+size_t StringRingBuffer<OneElemType>::getReadPosition() {
+  retainedPosition = this->readPosition;
+  positionRetained = true;
+  return this->readPosition;
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::setReadPosition(size_t position) {
+  if (position < releasedPosition.load(std::memory_order_relaxed))
+    return false;
+
+  if (position > cachedWritePosition)
+    cachedWritePosition = writePosition.load(std::memory_order_acquire);
+  if (position > cachedWritePosition)
+    return false;
+
+  if (positionRetained && position < retainedPosition)
+    retainedPosition = position;
+
+  this->readPosition = position;
+  return true;
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::clearBufferUntilReadPosition() {
+  positionRetained = false;
+  releaseReadData(true);
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::resetBuffer() {
+  writePosition.store(0);
+  releasedPosition.store(0);
+  cachedReleasedPosition = 0;
+  cachedWritePosition = 0;
+  positionRetained = false;
+  this->readPosition = 0;
+  growState.store(GrowState::NONE);
+  ended.store(false);
+}
+template<typename OneElemType>
+bool StringRingBuffer<OneElemType>::writeOne(const OneElemType &elem) {
+  return writeChunk(std::span<const OneElemType>(&elem, 1));
+}
+template<typename OneElemType>
+std::optional<OneElemType> StringRingBuffer<OneElemType>::readOne() {
+  if (waitForData() == 0)
+    return std::nullopt;
+
+  auto res = ring[this->readPosition & mask];
+  this->readPosition++;
+  releaseReadData(false);
+
+  return res;
+}
+template<typename OneElemType>
+size_t StringRingBuffer<OneElemType>::waitForData() {
+  if (cachedWritePosition != this->readPosition)
+    return cachedWritePosition - this->readPosition;
+
+  while (true) {
+    cachedWritePosition = writePosition.load(std::memory_order_acquire);
+    if (cachedWritePosition != this->readPosition)
+      return cachedWritePosition - this->readPosition;
+
+    if (ended.load(std::memory_order_acquire)) {
+      cancelGrowing();
+      cachedWritePosition = writePosition.load(std::memory_order_acquire);
+      return cachedWritePosition - this->readPosition;
+    }
+
+    //Producer may be waiting for space, so everything possible is given back before sleeping
+    releaseReadData(true);
+    //Ring is read again only after producer publishes data written to grown ring
+    if (growState.load(std::memory_order_acquire) == GrowState::NONE
+        && this->readPosition - releasedPosition.load(std::memory_order_relaxed) == capacity) {
+      growState.store(GrowState::REQUESTED);
+      signal(spaceEvents, writerWaiting);
+    }
+
+    auto events = dataEvents.load();
+    readerWaiting.store(true);
+    if (writePosition.load() == this->readPosition && !ended.load())
+      dataEvents.wait(events);
+    readerWaiting.store(false);
+  }
+}
+template<typename OneElemType>
+size_t StringRingBuffer<OneElemType>::waitForSpace() {
+  size_t position = writePosition.load(std::memory_order_relaxed);
+
+  while (true) {
+    size_t freeSpace = capacity - (position - cachedReleasedPosition);
+    if (freeSpace != 0)
+      return freeSpace;
+
+    if (ended.load(std::memory_order_acquire))
+      return 0;
+
+    auto requested = GrowState::REQUESTED;
+    if (growState.compare_exchange_strong(requested, GrowState::GROWING)) {
+      grow();
+      continue;
+    }
+
+    cachedReleasedPosition = releasedPosition.load(std::memory_order_acquire);
+    if (position - cachedReleasedPosition != capacity)
+      continue;
+
+    auto events = spaceEvents.load();
+    writerWaiting.store(true);
+    if (releasedPosition.load() == cachedReleasedPosition && !ended.load()
+        && growState.load() != GrowState::REQUESTED)
+      spaceEvents.wait(events);
+    writerWaiting.store(false);
+  }
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::grow() {
+  try {
+    size_t position = writePosition.load(std::memory_order_relaxed);
+    size_t released = releasedPosition.load(std::memory_order_acquire);
+    size_t newCapacity = capacity * 2;
+    auto newRing = std::make_unique<OneElemType[]>(newCapacity);
+    for (size_t copied = released; copied != position; copied++)
+      newRing[copied & (newCapacity - 1)] = ring[copied & mask];
+
+    ring = std::move(newRing);
+    capacity = newCapacity;
+    mask = newCapacity - 1;
+    cachedReleasedPosition = released;
+    DILOGI("Ring buffer is full of retained data, ring is grown");
+  }
+  catch (const std::bad_alloc &error) {
+    DILOGE(error.what());
+    growState.store(GrowState::NONE);
+    throw;
+  }
+  growState.store(GrowState::NONE, std::memory_order_release);
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::cancelGrowing() {
+  auto requested = GrowState::REQUESTED;
+  if (growState.compare_exchange_strong(requested, GrowState::NONE))
+    return;
+  while (growState.load(std::memory_order_acquire) == GrowState::GROWING)
+    std::this_thread::yield();
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::releaseReadData(bool force) {
+  size_t target = positionRetained ? retainedPosition : this->readPosition;
+  size_t released = releasedPosition.load(std::memory_order_relaxed);
+
+  if (target == released)
+    return;
+  if (!force && target - released < capacity / 4)
+    return;
+
+  releasedPosition.store(target);
+  signal(spaceEvents, writerWaiting);
+}
+template<typename OneElemType>
+void StringRingBuffer<OneElemType>::signal(std::atomic<uint32_t> &events, std::atomic<bool> &waiting) {
+  //Only first signal after other side started waiting need to wake it
+  if (!waiting.load() || !waiting.exchange(false))
+    return;
+  events.fetch_add(1);
+  events.notify_one();
+}
+
+}
@@ -1,5 +1,6 @@
 
 #include "utf8.h"
+#include <algorithm>
 #include <optional>
 #include <list>
 #include <buffer/StringSyncBuffer.hpp>
@@ -8,6 +9,9 @@
 
 namespace webvtt {
 
+template<typename OneElemType>
+StringSyncBuffer<OneElemType>::StringSyncBuffer(size_t highWaterMark) : highWaterMark(highWaterMark) {
+}
 template<typename OneElemType>
 bool StringSyncBuffer<OneElemType>::isInputEnded() {
   std::lock_guard<std::mutex> lock(this->mutex);
@@ -18,12 +22,12 @@ void StringSyncBuffer<OneElemType>::setInputEnded() {
   std::lock_guard<std::mutex> lock(this->mutex);
   this->inputEnded = true;
   this->emptyCV.notify_all();
+  this->fullCV.notify_all();
 }
 template<typename OneElemType>
 bool StringSyncBuffer<OneElemType>::isReadDone() {
   std::unique_lock<std::mutex> lock(this->mutex);
-  while (this->readPosition == this->buffer.length() && !this->inputEnded)
-    this->emptyCV.wait(lock);
+  waitForData(lock);
 
   bool retVal = this->readPosition == this->buffer.length();
   this->emptyCV.notify_all();
@@ -41,24 +45,115 @@ std::optional<OneElemType> StringSyncBuffer<OneElemType>::readNext() {
 }
 template<typename OneElemType>
 bool StringSyncBuffer<OneElemType>::writeMultiple(const std::basic_string<OneElemType> &input) {
-  std::lock_guard<std::mutex> lock(this->mutexWrite);
-  return StringBuffer<OneElemType>::writeMultiple(input);
+  return this->writeChunk(input);
 }
 template<typename OneElemType>
 std::basic_string<OneElemType> StringSyncBuffer<OneElemType>::readMultiple(uint32_t number) {
-  std::lock_guard<std::mutex> lock(this->mutexRead);
-  return StringBuffer<OneElemType>::readMultiple(number);
+  std::lock_guard<std::mutex> lockRead(this->mutexRead);
+  std::unique_lock<std::mutex> lock(this->mutex);
 
+  std::basic_string<OneElemType> values;
+  while (values.length() < number) {
+    waitForData(lock);
+    if (this->readPosition == this->buffer.length())
+      break;
+
+    size_t readNumber = std::min<size_t>(number - values.length(), this->buffer.length() - this->readPosition);
+    values.append(this->buffer, this->readPosition, readNumber);
+    this->readPosition += readNumber;
+    notifyConsumed();
+  }
+  return values;
+}
+template<typename OneElemType>
+bool StringSyncBuffer<OneElemType>::writeChunk(std::span<const OneElemType> input) {
+  std::lock_guard<std::mutex> lockWrite(this->mutexWrite);
+  try {
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    do {
+      waitForSpace(lock);
+      if (this->inputEnded)
+        return false;
+
+      compact();
+
+      size_t number = input.size();
+      if (highWaterMark != 0)
+        number = std::min(number, highWaterMark - (this->buffer.length() - this->readPosition));
+
+      this->buffer.append(input.begin(), input.begin() + number);
+      input = input.subspan(number);
+
+      this->emptyCV.notify_all();
+    } while (!input.empty());
+
+    return true;
+  }
+  catch (const std::bad_alloc &error) {
+    DILOGE(error.what());
+    this->setInputEnded();
+    throw;
+  }
+}
+template<typename OneElemType>
+size_t StringSyncBuffer<OneElemType>::readChunk(std::span<OneElemType> output) {
+  std::lock_guard<std::mutex> lockRead(this->mutexRead);
+  std::unique_lock<std::mutex> lock(this->mutex);
+
+  waitForData(lock);
+
+  size_t number = std::min(output.size(), this->buffer.length() - this->readPosition);
+  std::copy_n(this->buffer.begin() + this->readPosition, number, output.begin());
+  this->readPosition += number;
+  notifyConsumed();
+
+  return number;
 }
 template<typename OneElemType>
 std::basic_string<OneElemType> StringSyncBuffer<OneElemType>::readUntilSpecificData(const OneElemType &specificData) {
-  std::lock_guard<std::mutex> lock(this->mutexRead);
-  return StringBuffer<OneElemType>::readUntilSpecificData(specificData);
+  std::basic_string<OneElemType> values;
+  this->readUntilSpecificData(values, specificData);
+  return values;
+}
+template<typename OneElemType>
+void StringSyncBuffer<OneElemType>::readUntilSpecificData(std::basic_string<OneElemType> &output,
+                                                          const OneElemType &specificData) {
+  std::lock_guard<std::mutex> lockRead(this->mutexRead);
+  std::unique_lock<std::mutex> lock(this->mutex);
+
+  while (true) {
+    auto found = this->buffer.find(specificData, this->readPosition);
+    if (found == std::basic_string<OneElemType>::npos)
+      found = this->buffer.length();
+
+    //Scanned data is taken immediately, so line longer than high-water mark doesn't block the writer
+    output.append(this->buffer, this->readPosition, found - this->readPosition);
+    this->readPosition = found;
+    notifyConsumed();
+
+    if (found != this->buffer.length() || this->inputEnded)
+      return;
+    waitForData(lock);
+  }
 }
 template<typename OneElemType>
 std::basic_string<OneElemType> StringSyncBuffer<OneElemType>::readWhileSpecificData(const OneElemType &specificData) {
-  std::lock_guard<std::mutex> lock(this->mutexRead);
-  return StringBuffer<OneElemType>::readWhileSpecificData(specificData);
+  std::lock_guard<std::mutex> lockRead(this->mutexRead);
+  std::unique_lock<std::mutex> lock(this->mutex);
+
+  std::basic_string<OneElemType> values;
+  while (true) {
+    while (this->readPosition < this->buffer.length() && this->buffer[this->readPosition] == specificData) {
+      values.push_back(specificData);
+      this->readPosition++;
+    }
+    notifyConsumed();
+
+    if (this->readPosition < this->buffer.length() || this->inputEnded)
+      return values;
+    waitForData(lock);
+  }
 }
 template<typename OneElemType>
 std::optional<OneElemType> StringSyncBuffer<OneElemType>::isReadDoneAndAdvancedIfNot() {
@@ -66,37 +161,52 @@ std::optional<OneElemType> StringSyncBuffer<OneElemType>::isReadDoneAndAdvancedI
 }
 template<typename OneElemType>
 size_t StringSyncBuffer<OneElemType>::getReadPosition() {
-  this->isReadDone();
-  return this->readPosition;
+  std::unique_lock<std::mutex> lock(this->mutex);
+  waitForData(lock);
+
+  retainedPosition = this->readPosition;
+  positionRetained = true;
+  return discardedLength + this->readPosition;
 }
 template<typename OneElemType>
 bool StringSyncBuffer<OneElemType>::setReadPosition(size_t position) {
   std::lock_guard<std::mutex> lock(this->mutex);
-  return StringBuffer<OneElemType>::setReadPosition(position);
+  if (position < discardedLength)
+    return false;
+
+  if (!StringBuffer<OneElemType>::setReadPosition(position - discardedLength))
+    return false;
+
+  if (positionRetained)
+    retainedPosition = std::min(retainedPosition, this->readPosition);
+  return true;
 }
 template<typename OneElemType>
 void StringSyncBuffer<OneElemType>::clearBufferUntilReadPosition() {
   std::lock_guard<std::mutex> lock(this->mutex);
-  StringBuffer<OneElemType>::clearBufferUntilReadPosition();
-
+  positionRetained = false;
+  compact();
+  notifyConsumed();
 }
 template<typename OneElemType>
 void StringSyncBuffer<OneElemType>::resetBuffer() {
   std::lock_guard<std::mutex> lock(this->mutex);
   StringBuffer<OneElemType>::resetBuffer();
+  discardedLength = 0;
+  positionRetained = false;
 }
 template<typename OneElemType>
 std::optional<OneElemType> StringSyncBuffer<OneElemType>::readOne() {
   std::unique_lock<std::mutex> lock(this->mutex);
 
-  while (this->readPosition == this->buffer.length() && !this->inputEnded)
-    this->emptyCV.wait(lock);
+  waitForData(lock);
 
   if (this->readPosition == this->buffer.length())
     return std::nullopt;
 
   auto res = this->buffer[this->readPosition];
   this->readPosition++;
+  notifyConsumed();
 
   return res;
 }
@@ -105,9 +215,11 @@ bool StringSyncBuffer<OneElemType>::writeOne(const OneElemType &elem) {
   try {
     std::unique_lock<std::mutex> lock(this->mutex);
 
+    waitForSpace(lock);
     if (this->inputEnded)
       return false;
 
+    compact();
     this->buffer.push_back(elem);
 
     this->emptyCV.notify_all();
@@ -123,8 +235,7 @@ template<typename OneElemType>
 std::optional<OneElemType> StringSyncBuffer<OneElemType>::peekOne() {
   std::unique_lock<std::mutex> lock(this->mutex);
 
-  while (this->readPosition == this->buffer.length() && !this->inputEnded)
-    this->emptyCV.wait(lock);
+  waitForData(lock);
 
   if (this->readPosition == this->buffer.length())
     return std::nullopt;
@@ -133,5 +244,43 @@ std::optional<OneElemType> StringSyncBuffer<OneElemType>::peekOne() {
 
   return res;
 }
+template<typename OneElemType>
+size_t StringSyncBuffer<OneElemType>::releasablePosition() const {
+  return positionRetained ? std::min(retainedPosition, this->readPosition) : this->readPosition;
+}
+template<typename OneElemType>
+bool StringSyncBuffer<OneElemType>::isFull() const {
+  //Only unread data is counted, reader waiting for data with retained position would otherwise block writer
+  return highWaterMark != 0 && this->buffer.length() - this->readPosition >= highWaterMark;
+}
+template<typename OneElemType>
+void StringSyncBuffer<OneElemType>::waitForData(std::unique_lock<std::mutex> &lock) {
+  while (this->readPosition == this->buffer.length() && !this->inputEnded)
+    this->emptyCV.wait(lock);
+}
+template<typename OneElemType>
+void StringSyncBuffer<OneElemType>::waitForSpace(std::unique_lock<std::mutex> &lock) {
+  while (isFull() && !this->inputEnded)
+    this->fullCV.wait(lock);
+}
+template<typename OneElemType>
+void StringSyncBuffer<OneElemType>::notifyConsumed() {
+  if (highWaterMark != 0)
+    this->fullCV.notify_all();
+}
+template<typename OneElemType>
+void StringSyncBuffer<OneElemType>::compact() {
+  size_t released = releasablePosition();
+
+  //Erasing only when consumed part is at least half of the buffer keeps compaction cost linear
+  if (released == 0 || released < this->buffer.length() - released)
+    return;
+
+  this->buffer.erase(0, released);
+  this->readPosition -= released;
+  if (positionRetained)
+    retainedPosition -= released;
+  discardedLength += released;
+}
 
 }
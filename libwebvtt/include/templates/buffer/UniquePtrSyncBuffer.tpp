@@ -8,17 +8,43 @@ namespace webvtt {
 
 template<typename Elem>
 const Elem *UniquePtrSyncBuffer<Elem>::getElemByID(std::u32string_view id) const {
+  //Nothing is written after end of input, so complete index is only read
+  if (this->indexComplete.load(std::memory_order_acquire)) {
+    auto found = this->elemsByID.find(id);
+    return found == this->elemsByID.end() ? nullptr : found->second;
+  }
+
   std::lock_guard<std::mutex> lock(this->mutex);
-  // TODO Think why in reverse order
-  auto found = std::find_if(this->buffer.rbegin(),
-                            this->buffer.rend(),
-                            [&id](const std::unique_ptr<Elem> &elem) {
-                              return elem->getIdentifier() == id;
-                            });
-  if (found == this->buffer.rend())
-    return nullptr;
-  else
-    return found->get();
+  this->indexRemaining();
+  if (this->inputEnded)
+    this->indexComplete.store(true, std::memory_order_release);
+  auto found = this->elemsByID.find(id);
+  return found == this->elemsByID.end() ? nullptr : found->second;
+}
+
+template<typename Elem>
+void UniquePtrSyncBuffer<Elem>::indexRemaining() const {
+  //Elements without identifier, like style sheets, are never searched
+  if constexpr (requires(Elem &elem) { elem.getIdentifier(); }) {
+    //Later definition overwrites earlier one with same identifier
+    for (; this->firstNotIndexed != this->buffer.end(); ++this->firstNotIndexed)
+      this->elemsByID.insert_or_assign(std::u32string((*this->firstNotIndexed)->getIdentifier()),
+                                       this->firstNotIndexed->get());
+  }
+}
+
+template<typename Elem>
+void UniquePtrSyncBuffer<Elem>::pushBack(std::unique_ptr<Elem> oneElem) {
+  //End iterator stays same after push back, so positions at end need to be moved to new element
+  bool readAll = this->readPosition == this->buffer.end();
+  bool indexedAll = this->firstNotIndexed == this->buffer.end();
+
+  this->buffer.push_back(std::move(oneElem));
+
+  if (readAll)
+    this->readPosition = --this->buffer.end();
+  if (indexedAll)
+    this->firstNotIndexed = --this->buffer.end();
 }
 
 template<typename Elem>
@@ -59,19 +85,10 @@ template<typename Elem>
 bool UniquePtrSyncBuffer<Elem>::writeOne(std::unique_ptr<Elem> oneElem) {
   try {
     std::unique_lock<std::mutex> lock(this->mutex);
-    bool shouldRetBack = false;
     if (this->inputEnded)
       return false;
-    {
-      //All data already read need to m
-      if (this->readPosition == this->buffer.end())
-        shouldRetBack = true;
-
-      this->buffer.push_back(std::move(oneElem));
 
-      if (shouldRetBack)
-        this->readPosition = --this->buffer.end();
-    }
+    this->pushBack(std::move(oneElem));
     this->emptyCV.notify_all();
     return true;
   }
@@ -111,10 +128,16 @@ bool UniquePtrSyncBuffer<Elem>::isReadDone() {
   return retVal;
 }
 
+template<typename Elem>
+size_t UniquePtrSyncBuffer<Elem>::size() const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->buffer.size();
+}
+
 template<typename Elem>
 void UniquePtrSyncBuffer<Elem>::setInputEnded() {
   std::lock_guard<std::mutex> lock(this->mutex);
-  this->inputEnded = true;
+  this->inputEnded.store(true, std::memory_order_release);
   this->emptyCV.notify_all();
 }
 
@@ -126,9 +149,16 @@ void UniquePtrSyncBuffer<Elem>::setReadPositionToBeginning() {
 template<typename Elem>
 void UniquePtrSyncBuffer<Elem>::clearBuffer() {
   std::lock_guard<std::mutex> lock(this->mutex);
+  this->clearElements();
+}
+template<typename Elem>
+void UniquePtrSyncBuffer<Elem>::clearElements() {
+  this->inputEnded = false;
+  this->indexComplete = false;
+  this->elemsByID.clear();
   this->buffer.clear();
   this->readPosition = this->buffer.begin();
-  inputEnded = false;
+  this->firstNotIndexed = this->buffer.begin();
 }
 
 } // namespace webvtt
@@ -0,0 +1,86 @@
+#include "elements/atoms/Atom.hpp"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace webvtt {
+
+/**
+ * Entries are kept in deque, so their strings never move and views of them are keys of map.
+ * Known strings are found under shared lock, only new strings take exclusive lock.
+ */
+template<typename Character>
+class BasicAtom<Character>::Table {
+ public:
+  const Entry *find(StringView string) {
+    std::shared_lock lock(mutex);
+    auto found = entries.find(string);
+    return found != entries.end() ? found->second : nullptr;
+  }
+
+  const Entry *intern(StringView string) {
+    if (const Entry *found = find(string))
+      return found;
+
+    std::unique_lock lock(mutex);
+    //String could be added by other thread between locks
+    auto found = entries.find(string);
+    if (found != entries.end())
+      return found->second;
+    const Entry &entry = storage.emplace_back(Entry{std::basic_string<Character>(string),
+                                                    static_cast<uint32_t>(storage.size() + 1)});
+    entries.emplace(StringView(entry.string), &entry);
+    return &entry;
+  }
+
+  void clear() {
+    std::unique_lock lock(mutex);
+    //Swapped with empty containers, because clear keeps deque blocks and map buckets allocated
+    std::unordered_map<StringView, const Entry *>().swap(entries);
+    std::deque<Entry>().swap(storage);
+  }
+
+  size_t size() {
+    std::shared_lock lock(mutex);
+    return storage.size();
+  }
+
+ private:
+  std::shared_mutex mutex;
+  std::deque<Entry> storage;
+  std::unordered_map<StringView, const Entry *> entries;
+};
+
+template<typename Character>
+BasicAtom<Character> BasicAtom<Character>::intern(StringView string) {
+  if (string.empty())
+    return {};
+  return BasicAtom(getTable().intern(string));
+}
+
+template<typename Character>
+BasicAtom<Character> BasicAtom<Character>::find(StringView string) {
+  if (string.empty())
+    return {};
+  return BasicAtom(getTable().find(string));
+}
+
+template<typename Character>
+void BasicAtom<Character>::clear() {
+  getTable().clear();
+}
+
+template<typename Character>
+size_t BasicAtom<Character>::getInternedNumber() {
+  return getTable().size();
+}
+
+template<typename Character>
+typename BasicAtom<Character>::Table &BasicAtom<Character>::getTable() {
+  //Never destroyed, so atoms stay valid in destructors of static objects
+  static Table &table = *new Table();
+  return table;
+}
+
+} // namespace webvtt
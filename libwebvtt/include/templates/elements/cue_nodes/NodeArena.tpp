@@ -0,0 +1,37 @@
+#include "elements/cue_nodes/NodeArena.hpp"
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace webvtt {
+
+template<typename Object, typename... Arguments>
+Object *NodeArena::make(Arguments &&...arguments) {
+  if constexpr (std::is_trivially_destructible_v<Object>) {
+    return new(allocate(sizeof(Object), alignof(Object))) Object(std::forward<Arguments>(arguments)...);
+  } else {
+    void *record = allocate(sizeof(Destructor), alignof(Destructor));
+    auto *object = new(allocate(sizeof(Object), alignof(Object))) Object(std::forward<Arguments>(arguments)...);
+    //Registered only after construction, so object that throws is never destroyed
+    lastDestructor = new(record) Destructor{&NodeArena::destroy<Object>, object, lastDestructor};
+    return object;
+  }
+}
+
+template<typename Object>
+std::span<Object> NodeArena::makeArray(size_t size) {
+  static_assert(std::is_trivially_destructible_v<Object>, "Objects of array are not destroyed by arena");
+  if (size == 0)
+    return {};
+  auto *array = static_cast<Object *>(allocate(size * sizeof(Object), alignof(Object)));
+  std::uninitialized_value_construct_n(array, size);
+  return {array, size};
+}
+
+template<typename Object>
+void NodeArena::destroy(void *object) {
+  static_cast<Object *>(object)->~Object();
+}
+
+} // namespace webvtt
@@ -0,0 +1,93 @@
+#include "parser/ParserUtil.hpp"
+
+namespace webvtt {
+
+template<CharacterPredicate Predicate>
+std::string ParserUtil::collectCharacters(std::u32string_view input,
+                                          std::u32string_view::iterator &position,
+                                          const Predicate &isLookedCharacter) {
+  checkIfIteratorPointToInput(input, position);
+  std::string collectedCharacters;
+  while (position != input.end() && isLookedCharacter(*position)) {
+    utf8::append(*position, collectedCharacters);
+    position++;
+  }
+  return collectedCharacters;
+}
+
+template<CharacterPredicate Predicate>
+std::u32string_view ParserUtil::parseWhileCondition(std::u32string_view input,
+                                                    std::u32string_view::iterator &position,
+                                                    const Predicate &condition,
+                                                    uint8_t maxNumberOfCharacters) {
+  checkIfIteratorPointToInput(input, position);
+
+  auto startPosition = position;
+  uint8_t iteration = 0;
+  while (position != input.end() && iteration < maxNumberOfCharacters && condition(*position)) {
+    iteration++;
+    position++;
+  }
+  return input.substr(startPosition - input.begin(), position - startPosition);
+}
+
+template<CharacterPredicate Predicate>
+std::u32string_view ParserUtil::parseUntilCondition(std::u32string_view input,
+                                                    std::u32string_view::iterator &position,
+                                                    const Predicate &condition) {
+  checkIfIteratorPointToInput(input, position);
+
+  auto startPosition = position;
+  while (position != input.end() && !condition(*position))
+    position++;
+  return input.substr(startPosition - input.begin(), position - startPosition);
+}
+
+template<CharacterPredicate Predicate>
+void ParserUtil::strip(std::u32string_view &input, const Predicate &isAskedCharacter) {
+  auto begin = input.begin();
+  while (begin != input.end() && isAskedCharacter(*begin))
+    begin++;
+
+  auto end = input.end();
+  while (end != begin && isAskedCharacter(*(end - 1)))
+    end--;
+
+  input = input.substr(begin - input.begin(), end - begin);
+}
+
+template<CharacterPredicate Predicate>
+void ParserUtil::strip(std::u32string &input, const Predicate &isAskedCharacter) {
+  std::u32string_view stripped = input;
+  strip(stripped, isAskedCharacter);
+
+  //Stripped view is inside input, so it is cut in place
+  size_t begin = stripped.data() - input.data();
+  input.erase(begin + stripped.length());
+  input.erase(0, begin);
+}
+
+template<CharacterPredicate Predicate>
+void ParserUtil::replaceAllSequenceOfCharactersWithGivenCharacter(std::u32string &input,
+                                                                  const Predicate &isAskedCharacter,
+                                                                  uint32_t character) {
+  //Characters are compacted in one pass, instead of erasing every sequence
+  auto output = input.begin();
+  auto position = input.begin();
+  while (position != input.end()) {
+    if (!isAskedCharacter(*position)) {
+      *output++ = *position++;
+      continue;
+    }
+
+    auto startPosition = position;
+    while (position != input.end() && isAskedCharacter(*position))
+      position++;
+
+    //Single character is kept as it is
+    *output++ = (position - startPosition == 1) ? *startPosition : character;
+  }
+  input.erase(output, input.end());
+}
+
+} // namespace webvtt
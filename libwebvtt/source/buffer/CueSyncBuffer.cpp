@@ -0,0 +1,48 @@
+#include "buffer/CueSyncBuffer.hpp"
+#include "logger/LoggingUtility.hpp"
+
+namespace webvtt {
+
+bool CueSyncBuffer::writeOne(std::unique_ptr<Cue> oneElem) {
+  try {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->inputEnded)
+      return false;
+
+    //Index is updated before cue is visible to readers
+    index.add(*oneElem);
+    this->pushBack(std::move(oneElem));
+
+    this->emptyCV.notify_all();
+    return true;
+  }
+  catch (const std::bad_alloc &error) {
+    DILOGE(error.what());
+    this->setInputEnded();
+    throw;
+  }
+}
+
+void CueSyncBuffer::clearBuffer() {
+  //Index and cues are cleared together, so no cue written between them stays indexed after it is deleted
+  std::lock_guard<std::mutex> lock(this->mutex);
+  index.clear();
+  this->clearElements();
+}
+
+std::vector<const Cue *> CueSyncBuffer::activeAt(TimeStamp time) const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return index.activeAt(time);
+}
+
+std::vector<const Cue *> CueSyncBuffer::overlapping(TimeStamp startTime, TimeStamp endTime) const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return index.overlapping(startTime, endTime);
+}
+
+std::optional<TimeStamp> CueSyncBuffer::nextChangeAfter(TimeStamp time) const {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return index.nextChangeAfter(time);
+}
+
+} // namespace webvtt
@@ -0,0 +1,127 @@
+#include "buffer/CueTimeIndex.hpp"
+#include <algorithm>
+
+namespace webvtt {
+
+namespace {
+constexpr TimeStamp NO_END_TIME = TimeStamp::min();
+}
+
+void CueTimeIndex::add(const Cue &cue) {
+  Entry entry{cue.getStartTimeStamp(), cue.getEndTimeStamp(), &cue};
+
+  auto endPosition = std::upper_bound(endTimes.begin(), endTimes.end(), entry.endTime);
+  endTimes.insert(endPosition, entry.endTime);
+
+  //Cues in file are usually ordered by start time, so new cue is almost always appended
+  if (entries.empty() || entries.back().startTime <= entry.startTime) {
+    entries.push_back(entry);
+    if (entries.size() > capacity)
+      rebuildTree();
+    else
+      updateTree(entries.size() - 1);
+    return;
+  }
+
+  auto position = std::upper_bound(entries.begin(), entries.end(), entry.startTime,
+                                   [](TimeStamp startTime, const Entry &other) {
+                                     return startTime < other.startTime;
+                                   });
+  entries.insert(position, entry);
+  rebuildTree();
+}
+
+void CueTimeIndex::rebuildTree() {
+  capacity = std::max(capacity, MIN_CAPACITY);
+  while (capacity < entries.size())
+    capacity *= 2;
+
+  maxEndTree.assign(2 * capacity, NO_END_TIME);
+  for (size_t index = 0; index < entries.size(); index++)
+    maxEndTree[capacity + index] = entries[index].endTime;
+  for (size_t node = capacity - 1; node > 0; node--)
+    maxEndTree[node] = std::max(maxEndTree[2 * node], maxEndTree[2 * node + 1]);
+}
+
+void CueTimeIndex::updateTree(size_t entryIndex) {
+  size_t node = capacity + entryIndex;
+  maxEndTree[node] = entries[entryIndex].endTime;
+  for (node /= 2; node > 0; node /= 2)
+    maxEndTree[node] = std::max(maxEndTree[2 * node], maxEndTree[2 * node + 1]);
+}
+
+void CueTimeIndex::collect(size_t entryNumber, TimeStamp time, std::vector<const Cue *> &result) const {
+  if (entryNumber == 0)
+    return;
+
+  //Subtrees of entries that all end before time are skipped, so only O(log n) nodes are visited per found cue
+  struct Range {
+    size_t node;
+    size_t begin;
+    size_t size;
+  };
+  std::vector<Range> stack{{1, 0, capacity}};
+  while (!stack.empty()) {
+    Range range = stack.back();
+    stack.pop_back();
+    if (range.begin >= entryNumber || maxEndTree[range.node] <= time)
+      continue;
+
+    if (range.size == 1) {
+      result.push_back(entries[range.begin].cue);
+      continue;
+    }
+    size_t half = range.size / 2;
+    stack.push_back({2 * range.node + 1, range.begin + half, half});
+    stack.push_back({2 * range.node, range.begin, half});
+  }
+}
+
+std::vector<const Cue *> CueTimeIndex::activeAt(TimeStamp time) const {
+  auto startedEnd = std::upper_bound(entries.begin(), entries.end(), time,
+                                     [](TimeStamp time, const Entry &entry) {
+                                       return time < entry.startTime;
+                                     });
+  std::vector<const Cue *> result;
+  collect(startedEnd - entries.begin(), time, result);
+  return result;
+}
+
+std::vector<const Cue *> CueTimeIndex::overlapping(TimeStamp startTime, TimeStamp endTime) const {
+  auto startedEnd = std::lower_bound(entries.begin(), entries.end(), endTime,
+                                     [](const Entry &entry, TimeStamp time) {
+                                       return entry.startTime < time;
+                                     });
+  std::vector<const Cue *> result;
+  collect(startedEnd - entries.begin(), startTime, result);
+  return result;
+}
+
+std::optional<TimeStamp> CueTimeIndex::nextChangeAfter(TimeStamp time) const {
+  std::optional<TimeStamp> change;
+
+  auto nextStart = std::upper_bound(entries.begin(), entries.end(), time,
+                                    [](TimeStamp time, const Entry &entry) {
+                                      return time < entry.startTime;
+                                    });
+  if (nextStart != entries.end())
+    change = nextStart->startTime;
+
+  auto nextEnd = std::upper_bound(endTimes.begin(), endTimes.end(), time);
+  if (nextEnd != endTimes.end() && (!change || *nextEnd < *change))
+    change = *nextEnd;
+  return change;
+}
+
+size_t CueTimeIndex::size() const {
+  return entries.size();
+}
+
+void CueTimeIndex::clear() {
+  entries.clear();
+  endTimes.clear();
+  maxEndTree.clear();
+  capacity = 0;
+}
+
+} // namespace webvtt
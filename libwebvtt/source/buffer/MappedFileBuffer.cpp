@@ -0,0 +1,106 @@
+#include "buffer/MappedFileBuffer.hpp"
+#include "exceptions/FileMappingError.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace webvtt {
+
+MappedFileBuffer::MappedFileBuffer(const std::string &path) {
+  int fileDescriptor = open(path.c_str(), O_RDONLY);
+  if (fileDescriptor == -1) {
+    DILOGE("Error in file opening");
+    throw FileMappingError();
+  }
+
+  struct stat fileInfo{};
+  if (fstat(fileDescriptor, &fileInfo) == -1) {
+    close(fileDescriptor);
+    DILOGE("Error in reading file size");
+    throw FileMappingError();
+  }
+
+  //Empty file can't be mapped, it is represented with empty content
+  auto length = static_cast<size_t>(fileInfo.st_size);
+  if (length != 0) {
+    mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mapping == MAP_FAILED) {
+      mapping = nullptr;
+      close(fileDescriptor);
+      DILOGE("Error in file mapping");
+      throw FileMappingError();
+    }
+    //File is read once from beginning to end, so kernel can read ahead aggressively
+    madvise(mapping, length, MADV_SEQUENTIAL);
+    content = std::u8string_view(static_cast<const char8_t *>(mapping), length);
+  }
+  close(fileDescriptor);
+}
+
+MappedFileBuffer::~MappedFileBuffer() {
+  if (mapping != nullptr)
+    munmap(mapping, content.length());
+}
+
+std::u8string_view MappedFileBuffer::getContent() const {
+  return content;
+}
+
+bool MappedFileBuffer::isInputEnded() {
+  return true;
+}
+
+void MappedFileBuffer::setInputEnded() {
+}
+
+bool MappedFileBuffer::isReadDone() {
+  return readPosition == content.length();
+}
+
+std::optional<char8_t> MappedFileBuffer::peekOne() {
+  if (readPosition == content.length())
+    return std::nullopt;
+  return content[readPosition];
+}
+
+size_t MappedFileBuffer::readChunk(std::span<char8_t> output) {
+  size_t number = std::min(output.size(), content.length() - readPosition);
+  std::copy_n(content.begin() + readPosition, number, output.begin());
+  readPosition += number;
+  return number;
+}
+
+void MappedFileBuffer::readUntilSpecificData(std::u8string &output, const char8_t &specificData) {
+  auto found = std::min(content.find(specificData, readPosition), content.length());
+  output.append(content.substr(readPosition, found - readPosition));
+  readPosition = found;
+}
+
+bool MappedFileBuffer::setReadPosition(size_t position) {
+  if (position > content.length())
+    return false;
+  readPosition = position;
+  return true;
+}
+
+void MappedFileBuffer::clearBufferUntilReadPosition() {
+}
+
+void MappedFileBuffer::resetBuffer() {
+  readPosition = 0;
+}
+
+std::optional<char8_t> MappedFileBuffer::readOne() {
+  if (readPosition == content.length())
+    return std::nullopt;
+  return content[readPosition++];
+}
+
+bool MappedFileBuffer::writeOne(const char8_t &) {
+  return false;
+}
+
+}
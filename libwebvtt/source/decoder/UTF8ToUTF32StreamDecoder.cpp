@@ -1,49 +1,62 @@
 #include "decoder/UTF8ToUTF32StreamDecoder.hpp"
-#include "parser/ParserUtil.hpp"
-#include "utf8.h"
+#include "decoder/UTF8Transcoder.hpp"
+#include <algorithm>
+#include <span>
 #include <thread>
 #include <utility>
+#include <vector>
 #include "logger/LoggingUtility.hpp"
-#include "buffer/StringSyncBuffer.hpp"
+#include "buffer/StringBufferFactory.hpp"
 
 namespace webvtt {
-UTF8ToUTF32StreamDecoder::UTF8ToUTF32StreamDecoder(std::shared_ptr<StringBuffer<char8_t>> newInputStream)
+UTF8ToUTF32StreamDecoder::UTF8ToUTF32StreamDecoder(std::shared_ptr<StringBuffer<char8_t>> newInputStream,
+                                                   StringBufferType outputBufferType)
     : inputStream(std::move(newInputStream)) {
-  outputStream = std::make_shared<StringSyncBuffer<char32_t>>();
+  outputStream = makeStringBuffer<char32_t>(outputBufferType);
 }
 
-std::u32string UTF8ToUTF32StreamDecoder::decodeReadBytes(std::u8string &readBytes) {
-  auto positionInvalid = ParserUtil::find_invalid(readBytes);
-
-  auto validUTF8 = std::u8string_view(readBytes);
-  std::u32string utf_32;
-
-  if (positionInvalid == std::string::npos) {
-    utf_32 = ParserUtil::utf8to32(validUTF8);
-    readBytes.clear();
-  } else {
-    utf_32 = ParserUtil::utf8to32(validUTF8.substr(0, positionInvalid));
-    readBytes.erase(readBytes.begin(), readBytes.begin() + positionInvalid);
-  }
-  return utf_32;
+std::pair<size_t, size_t> UTF8ToUTF32StreamDecoder::decodeReadBytes(std::u8string_view readBytes, char32_t *output) {
+  size_t validLength = UTF8Transcoder::validPrefixLength(readBytes);
+  return {validLength, UTF8Transcoder::transcodeValid(readBytes.substr(0, validLength), output)};
 }
 
 void UTF8ToUTF32StreamDecoder::decodeInputStream() {
-  std::u8string buffer;
-  std::u8string bytes;
+  //Sequence split between two chunks is moved to the beginning of bytes and completed by next read
+  constexpr size_t SPLIT_SEQUENCE_SPACE = UTF8Transcoder::MAX_SEQUENCE_LENGTH - 1;
+  std::vector<char8_t> bytes(SPLIT_SEQUENCE_SPACE + DEFAULT_READ_NUMBER);
+  std::vector<char32_t> decoded(SPLIT_SEQUENCE_SPACE + DEFAULT_READ_NUMBER);
+  size_t pendingNumber = 0;
+  bool invalidInput = false;
 
   try {
 
     while (true) {
-      bytes = inputStream->readMultiple(DEFAULT_READ_NUMBER);
+      size_t readNumber = inputStream->readChunk(std::span(bytes).subspan(pendingNumber, DEFAULT_READ_NUMBER));
 
-      if (bytes.length() == 0) {
+      if (readNumber == 0) {
         break;
       }
-      buffer.append(bytes);
-      std::u32string decodedBytes = decodeReadBytes(buffer);
+      if (invalidInput) {
+        continue;
+      }
+      size_t bytesNumber = pendingNumber + readNumber;
+      auto [decodedBytesNumber, decodedNumber] = decodeReadBytes(std::u8string_view(bytes.data(), bytesNumber),
+                                                                 decoded.data());
+      pendingNumber = bytesNumber - decodedBytesNumber;
 
-      outputStream->writeMultiple(decodedBytes);
+      if (pendingNumber > SPLIT_SEQUENCE_SPACE) {
+        //Not split sequence, but invalid one. Decoding stops at it, rest of input is discarded
+        DILOGE("Input stream is not valid utf8");
+        invalidInput = true;
+      } else {
+        std::copy_n(bytes.begin() + decodedBytesNumber, pendingNumber, bytes.begin());
+      }
+
+      if (!outputStream->writeChunk(std::span<const char32_t>(decoded.data(), decodedNumber))) {
+        //Reader of decoded data stopped, writer of input must not stay blocked on full buffer
+        inputStream->setInputEnded();
+        break;
+      }
     }
     outputStream->setInputEnded();
   }
@@ -63,7 +76,7 @@ bool UTF8ToUTF32StreamDecoder::startDecoding() {
   return true;
 };
 
-std::shared_ptr<StringSyncBuffer<char32_t>> UTF8ToUTF32StreamDecoder::getDecodedStream() {
+std::shared_ptr<StringBuffer<char32_t>> UTF8ToUTF32StreamDecoder::getDecodedStream() {
   if (not decodingStarted)
     return nullptr;
   return outputStream;
@@ -0,0 +1,415 @@
+#include "decoder/UTF8Transcoder.hpp"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LIBWEBVTT_X86_SIMD
+#endif
+
+namespace webvtt {
+namespace {
+
+constexpr uint64_t ASCII_MASK = 0x8080808080808080ULL;
+
+bool isContinuation(uint8_t byte) {
+  return (byte & 0xC0) == 0x80;
+}
+
+bool isASCIIWord(const char8_t *current) {
+  uint64_t word;
+  std::memcpy(&word, current, sizeof(word));
+  return (word & ASCII_MASK) == 0;
+}
+
+/**
+ * @return length of valid sequence that start at current, 0 if sequence is invalid or incomplete
+ */
+size_t validSequenceLength(const char8_t *current, const char8_t *end) {
+  uint8_t lead = *current;
+  uint8_t secondMin = 0x80;
+  uint8_t secondMax = 0xBF;
+  size_t length;
+
+  if (lead < 0x80)
+    return 1;
+  if (lead < 0xC2)
+    return 0;
+
+  if (lead < 0xE0) {
+    length = 2;
+  } else if (lead < 0xF0) {
+    length = 3;
+    if (lead == 0xE0)
+      secondMin = 0xA0; //overlong
+    else if (lead == 0xED)
+      secondMax = 0x9F; //surrogates
+  } else if (lead < 0xF5) {
+    length = 4;
+    if (lead == 0xF0)
+      secondMin = 0x90; //overlong
+    else if (lead == 0xF4)
+      secondMax = 0x8F; //above U+10FFFF
+  } else {
+    return 0;
+  }
+
+  if (static_cast<size_t>(end - current) < length)
+    return 0;
+  if (current[1] < secondMin || current[1] > secondMax)
+    return 0;
+  for (size_t i = 2; i < length; i++)
+    if (!isContinuation(current[i]))
+      return 0;
+  return length;
+}
+
+size_t validPrefixLengthScalar(std::u8string_view input) {
+  const char8_t *begin = input.data();
+  const char8_t *current = begin;
+  const char8_t *end = begin + input.size();
+
+  while (current != end) {
+    if (end - current >= 8 && isASCIIWord(current)) {
+      current += 8;
+      continue;
+    }
+    size_t length = validSequenceLength(current, end);
+    if (length == 0)
+      break;
+    current += length;
+  }
+  return current - begin;
+}
+
+/**
+ * Decode one valid sequence and move current after it
+ */
+char32_t decodeSequence(const char8_t *&current) {
+  uint8_t lead = *current;
+  char32_t codePoint;
+
+  if (lead < 0x80) {
+    codePoint = lead;
+    current += 1;
+  } else if (lead < 0xE0) {
+    codePoint = (lead & 0x1F) << 6 | (current[1] & 0x3F);
+    current += 2;
+  } else if (lead < 0xF0) {
+    codePoint = (lead & 0x0F) << 12 | (current[1] & 0x3F) << 6 | (current[2] & 0x3F);
+    current += 3;
+  } else {
+    codePoint = (lead & 0x07) << 18 | (current[1] & 0x3F) << 12 | (current[2] & 0x3F) << 6 | (current[3] & 0x3F);
+    current += 4;
+  }
+  return codePoint;
+}
+
+size_t transcodeValidScalar(std::u8string_view input, char32_t *output) {
+  const char8_t *current = input.data();
+  const char8_t *end = current + input.size();
+  char32_t *outputBegin = output;
+
+  while (current != end) {
+    if (end - current >= 8 && isASCIIWord(current)) {
+      for (int i = 0; i < 8; i++)
+        output[i] = current[i];
+      current += 8;
+      output += 8;
+      continue;
+    }
+    *output++ = decodeSequence(current);
+  }
+  return output - outputBegin;
+}
+
+/**
+ * Vector validation cannot confirm sequences that start in last three bytes before position,
+ * so scalar validation continues from start of sequence before them.
+ */
+size_t scalarRestartPosition(std::u8string_view input, size_t position) {
+  constexpr size_t LOOK_BACK = UTF8Transcoder::MAX_SEQUENCE_LENGTH - 1;
+  size_t restart = position < LOOK_BACK ? 0 : position - LOOK_BACK;
+  while (restart > 0 && isContinuation(input[restart]))
+    restart--;
+  return restart;
+}
+
+size_t finishWithScalar(std::u8string_view input, size_t position) {
+  size_t restart = scalarRestartPosition(input, position);
+  return restart + validPrefixLengthScalar(input.substr(restart));
+}
+
+#ifdef LIBWEBVTT_X86_SIMD
+
+/*
+ * Vector validation uses lookup algorithm from John Keiser, Daniel Lemire,
+ * "Validating UTF-8 In Less Than One Instruction Per Byte".
+ * Every error bit is set by looking up high nibble of previous byte, low nibble
+ * of previous byte and high nibble of current byte; error exist only if bit is set in all three.
+ */
+constexpr uint8_t TOO_SHORT = 1 << 0;      // 11______ 0_______ or 11______ 11______
+constexpr uint8_t TOO_LONG = 1 << 1;       // 0_______ 10______
+constexpr uint8_t OVERLONG_3 = 1 << 2;     // 11100000 100_____
+constexpr uint8_t TOO_LARGE = 1 << 3;      // 11110100 1001____ or 11110100 101_____ or 11110101+
+constexpr uint8_t SURROGATE = 1 << 4;      // 11101101 101_____
+constexpr uint8_t OVERLONG_2 = 1 << 5;     // 1100000_ 10______
+constexpr uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101+ 1000____
+constexpr uint8_t OVERLONG_4 = 1 << 6;     // 11110000 1000____
+constexpr uint8_t TWO_CONTS = 1 << 7;      // 10______ 10______, checked again with sequence lengths
+constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+#define LIBWEBVTT_BYTE_1_HIGH_TABLE \
+  TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+  TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, \
+  TOO_SHORT | OVERLONG_2, \
+  TOO_SHORT, \
+  TOO_SHORT | OVERLONG_3 | SURROGATE, \
+  TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+
+#define LIBWEBVTT_BYTE_1_LOW_TABLE \
+  CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, \
+  CARRY | OVERLONG_2, \
+  CARRY, \
+  CARRY, \
+  CARRY | TOO_LARGE, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000, \
+  CARRY | TOO_LARGE | TOO_LARGE_1000
+
+#define LIBWEBVTT_BYTE_2_HIGH_TABLE \
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, \
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE, \
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+__attribute__((target("sse4.1")))
+__m128i errorsSSE41(__m128i input, __m128i previousInput) {
+  const __m128i byte1HighTable = _mm_setr_epi8(LIBWEBVTT_BYTE_1_HIGH_TABLE);
+  const __m128i byte1LowTable = _mm_setr_epi8(LIBWEBVTT_BYTE_1_LOW_TABLE);
+  const __m128i byte2HighTable = _mm_setr_epi8(LIBWEBVTT_BYTE_2_HIGH_TABLE);
+  const __m128i lowNibble = _mm_set1_epi8(0x0F);
+
+  __m128i previous1 = _mm_alignr_epi8(input, previousInput, 16 - 1);
+  __m128i byte1High = _mm_shuffle_epi8(byte1HighTable, _mm_and_si128(_mm_srli_epi16(previous1, 4), lowNibble));
+  __m128i byte1Low = _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(previous1, lowNibble));
+  __m128i byte2High = _mm_shuffle_epi8(byte2HighTable, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibble));
+  __m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+  //Third and fourth byte of sequence must be continuation, so they are the only allowed TWO_CONTS
+  __m128i previous2 = _mm_alignr_epi8(input, previousInput, 16 - 2);
+  __m128i previous3 = _mm_alignr_epi8(input, previousInput, 16 - 3);
+  __m128i isThirdByte = _mm_subs_epu8(previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  __m128i isFourthByte = _mm_subs_epu8(previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  __m128i mustBeContinuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte),
+                                             _mm_set1_epi8(static_cast<char>(0x80)));
+  return _mm_xor_si128(mustBeContinuation, specialCases);
+}
+
+__attribute__((target("sse4.1")))
+size_t validPrefixLengthSSE41(std::u8string_view input) {
+  constexpr size_t BLOCK_SIZE = 16;
+  __m128i previousInput = _mm_setzero_si128();
+  size_t position = 0;
+
+  for (; position + BLOCK_SIZE <= input.size(); position += BLOCK_SIZE) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + position));
+    //Pure ascii block is valid only if previous one did not end inside sequence
+    if (_mm_movemask_epi8(block) == 0 && _mm_movemask_epi8(previousInput) == 0) {
+      previousInput = block;
+      continue;
+    }
+    __m128i errors = errorsSSE41(block, previousInput);
+    if (!_mm_testz_si128(errors, errors))
+      break;
+    previousInput = block;
+  }
+  return finishWithScalar(input, position);
+}
+
+__attribute__((target("sse4.1")))
+size_t transcodeValidSSE41(std::u8string_view input, char32_t *output) {
+  constexpr size_t BLOCK_SIZE = 16;
+  const char8_t *current = input.data();
+  const char8_t *end = current + input.size();
+  char32_t *outputBegin = output;
+
+  while (static_cast<size_t>(end - current) >= BLOCK_SIZE) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+    if (_mm_movemask_epi8(block) == 0) {
+      auto *vectorOutput = reinterpret_cast<__m128i *>(output);
+      _mm_storeu_si128(vectorOutput, _mm_cvtepu8_epi32(block));
+      _mm_storeu_si128(vectorOutput + 1, _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+      _mm_storeu_si128(vectorOutput + 2, _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+      _mm_storeu_si128(vectorOutput + 3, _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+      current += BLOCK_SIZE;
+      output += BLOCK_SIZE;
+      continue;
+    }
+    //Decode sequences until the end of block, last one can end in next block
+    const char8_t *blockEnd = current + BLOCK_SIZE;
+    while (current < blockEnd)
+      *output++ = decodeSequence(current);
+  }
+  output += transcodeValidScalar(std::u8string_view(current, end - current), output);
+  return output - outputBegin;
+}
+
+template<int COUNT>
+__attribute__((target("avx2")))
+__m256i previousBytesAVX2(__m256i input, __m256i previousInput) {
+  //Upper half of previous block followed by lower half of current block
+  __m256i shifted = _mm256_permute2x128_si256(previousInput, input, 0x21);
+  return _mm256_alignr_epi8(input, shifted, 16 - COUNT);
+}
+
+__attribute__((target("avx2")))
+__m256i errorsAVX2(__m256i input, __m256i previousInput) {
+  const __m256i byte1HighTable = _mm256_setr_epi8(LIBWEBVTT_BYTE_1_HIGH_TABLE, LIBWEBVTT_BYTE_1_HIGH_TABLE);
+  const __m256i byte1LowTable = _mm256_setr_epi8(LIBWEBVTT_BYTE_1_LOW_TABLE, LIBWEBVTT_BYTE_1_LOW_TABLE);
+  const __m256i byte2HighTable = _mm256_setr_epi8(LIBWEBVTT_BYTE_2_HIGH_TABLE, LIBWEBVTT_BYTE_2_HIGH_TABLE);
+  const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+
+  __m256i previous1 = previousBytesAVX2<1>(input, previousInput);
+  __m256i byte1High = _mm256_shuffle_epi8(byte1HighTable, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), lowNibble));
+  __m256i byte1Low = _mm256_shuffle_epi8(byte1LowTable, _mm256_and_si256(previous1, lowNibble));
+  __m256i byte2High = _mm256_shuffle_epi8(byte2HighTable, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble));
+  __m256i specialCases = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+  __m256i previous2 = previousBytesAVX2<2>(input, previousInput);
+  __m256i previous3 = previousBytesAVX2<3>(input, previousInput);
+  __m256i isThirdByte = _mm256_subs_epu8(previous2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  __m256i isFourthByte = _mm256_subs_epu8(previous3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte),
+                                                _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(mustBeContinuation, specialCases);
+}
+
+__attribute__((target("avx2")))
+size_t validPrefixLengthAVX2(std::u8string_view input) {
+  constexpr size_t BLOCK_SIZE = 32;
+  __m256i previousInput = _mm256_setzero_si256();
+  size_t position = 0;
+
+  for (; position + BLOCK_SIZE <= input.size(); position += BLOCK_SIZE) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input.data() + position));
+    //Pure ascii block is valid only if previous one did not end inside sequence
+    if (_mm256_movemask_epi8(block) == 0 && _mm256_movemask_epi8(previousInput) == 0) {
+      previousInput = block;
+      continue;
+    }
+    __m256i errors = errorsAVX2(block, previousInput);
+    if (!_mm256_testz_si256(errors, errors))
+      break;
+    previousInput = block;
+  }
+  return finishWithScalar(input, position);
+}
+
+__attribute__((target("avx2")))
+size_t transcodeValidAVX2(std::u8string_view input, char32_t *output) {
+  constexpr size_t BLOCK_SIZE = 32;
+  const char8_t *current = input.data();
+  const char8_t *end = current + input.size();
+  char32_t *outputBegin = output;
+
+  while (static_cast<size_t>(end - current) >= BLOCK_SIZE) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(current));
+    if (_mm256_movemask_epi8(block) == 0) {
+      auto *vectorOutput = reinterpret_cast<__m256i *>(output);
+      __m128i low = _mm256_castsi256_si128(block);
+      __m128i high = _mm256_extracti128_si256(block, 1);
+      _mm256_storeu_si256(vectorOutput, _mm256_cvtepu8_epi32(low));
+      _mm256_storeu_si256(vectorOutput + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+      _mm256_storeu_si256(vectorOutput + 2, _mm256_cvtepu8_epi32(high));
+      _mm256_storeu_si256(vectorOutput + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+      current += BLOCK_SIZE;
+      output += BLOCK_SIZE;
+      continue;
+    }
+    //Decode sequences until the end of block, last one can end in next block
+    const char8_t *blockEnd = current + BLOCK_SIZE;
+    while (current < blockEnd)
+      *output++ = decodeSequence(current);
+  }
+  output += transcodeValidScalar(std::u8string_view(current, end - current), output);
+  return output - outputBegin;
+}
+
+#undef LIBWEBVTT_BYTE_1_HIGH_TABLE
+#undef LIBWEBVTT_BYTE_1_LOW_TABLE
+#undef LIBWEBVTT_BYTE_2_HIGH_TABLE
+
+#endif
+
+UTF8Transcoder::Implementation detectImplementation() {
+#ifdef LIBWEBVTT_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return UTF8Transcoder::Implementation::AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return UTF8Transcoder::Implementation::SSE41;
+#endif
+  return UTF8Transcoder::Implementation::SCALAR;
+}
+
+/**
+ * Implementation that is not supported by CPU is replaced with best supported one
+ */
+UTF8Transcoder::Implementation supportedImplementation(UTF8Transcoder::Implementation implementation) {
+  UTF8Transcoder::Implementation best = UTF8Transcoder::bestSupported();
+  return implementation > best ? best : implementation;
+}
+}
+
+UTF8Transcoder::Implementation UTF8Transcoder::bestSupported() {
+  static const Implementation best = detectImplementation();
+  return best;
+}
+
+std::string_view UTF8Transcoder::implementationName(Implementation implementation) {
+  switch (implementation) {
+    case Implementation::AVX2:return "avx2";
+    case Implementation::SSE41:return "sse4.1";
+    default:return "scalar";
+  }
+}
+
+size_t UTF8Transcoder::validPrefixLength(std::u8string_view input) {
+  return validPrefixLength(input, bestSupported());
+}
+
+size_t UTF8Transcoder::validPrefixLength(std::u8string_view input, Implementation implementation) {
+  switch (supportedImplementation(implementation)) {
+#ifdef LIBWEBVTT_X86_SIMD
+    case Implementation::AVX2:return validPrefixLengthAVX2(input);
+    case Implementation::SSE41:return validPrefixLengthSSE41(input);
+#endif
+    default:return validPrefixLengthScalar(input);
+  }
+}
+
+size_t UTF8Transcoder::transcodeValid(std::u8string_view input, char32_t *output) {
+  return transcodeValid(input, output, bestSupported());
+}
+
+size_t UTF8Transcoder::transcodeValid(std::u8string_view input, char32_t *output, Implementation implementation) {
+  switch (supportedImplementation(implementation)) {
+#ifdef LIBWEBVTT_X86_SIMD
+    case Implementation::AVX2:return transcodeValidAVX2(input, output);
+    case Implementation::SSE41:return transcodeValidSSE41(input, output);
+#endif
+    default:return transcodeValidScalar(input, output);
+  }
+}
+}
@@ -0,0 +1,94 @@
+#include "elements/cue_nodes/FlatCueTree.hpp"
+#include "elements/cue_nodes/InternalNodeObject.hpp"
+#include "elements/cue_nodes/internal_node_objects/VoiceObject.hpp"
+#include "elements/cue_nodes/leaf_node_objects/TextObject.hpp"
+#include "elements/cue_nodes/leaf_node_objects/TimeStampObject.hpp"
+
+namespace webvtt {
+
+FlatCueTree::FlatCueTree(const NodeObject &root) {
+  const NodeObject *node = &root;
+  uint32_t parent = NO_PARENT;
+
+  while (true) {
+    uint32_t index = appendNode(*node, parent);
+    if (const NodeObject *child = node->getFirstChild()) {
+      node = child;
+      parent = index;
+      continue;
+    }
+
+    //Subtrees are complete up to first ancestor with next sibling
+    while (true) {
+      nodes[index].subtreeSize = nodes.size() - index;
+      if (index == 0)
+        return;
+      if (const NodeObject *sibling = node->getNextSibling()) {
+        node = sibling;
+        parent = nodes[index].parent;
+        break;
+      }
+      node = node->getParent();
+      index = nodes[index].parent;
+    }
+  }
+}
+
+uint32_t FlatCueTree::appendNode(const NodeObject &nodeObject, uint32_t parent) {
+  Node node;
+  node.type = nodeObject.getNodeType();
+  node.parent = parent;
+
+  switch (node.type) {
+    case NodeObject::NodeType::TEXT:
+      node.text = appendString(static_cast<const TextObject &>(nodeObject).getText());
+      break;
+    case NodeObject::NodeType::TIME_STAMP:
+      node.time = static_cast<const TimeStampObject &>(nodeObject).getTimeStamp();
+      break;
+    default: {
+      const auto &internalNode = static_cast<const InternalNodeObject &>(nodeObject);
+      if (node.type == NodeObject::NodeType::VOICE)
+        node.text = appendString(static_cast<const VoiceObject &>(nodeObject).getVoiceName().getString());
+      node.language = appendString(internalNode.getLanguage().getString());
+
+      node.classes.offset = classNames.size();
+      for (Atom oneClass : internalNode.getClasses())
+        classNames.push_back(appendString(oneClass.getString()));
+      node.classes.length = classNames.size() - node.classes.offset;
+      break;
+    }
+  }
+  nodes.push_back(node);
+  return nodes.size() - 1;
+}
+
+FlatCueTree::Span FlatCueTree::appendString(std::u32string_view string) {
+  Span span{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(string.size())};
+  strings += string;
+  return span;
+}
+
+FlatCueTree::Iterator FlatCueTree::begin() const {
+  if (nodes.empty())
+    return end();
+  return {nodes.data(), {EventType::ENTER, nodes.data()}};
+}
+
+FlatCueTree::Iterator FlatCueTree::end() const {
+  return {nodes.data(), {}};
+}
+
+const std::vector<FlatCueTree::Node> &FlatCueTree::getNodes() const {
+  return nodes;
+}
+
+std::u32string_view FlatCueTree::getString(Span span) const {
+  return std::u32string_view(strings).substr(span.offset, span.length);
+}
+
+std::span<const FlatCueTree::Span> FlatCueTree::getClasses(const Node &node) const {
+  return std::span<const Span>(classNames).subspan(node.classes.offset, node.classes.length);
+}
+
+} // namespace webvtt
@@ -8,14 +8,23 @@
 #include "elements/cue_nodes/internal_node_objects/RubyTextObject.hpp"
 #include "elements/cue_nodes/internal_node_objects/UnderlineObject.hpp"
 #include "elements/cue_nodes/internal_node_objects/VoiceObject.hpp"
-#include "elements/style_selectors/StyleSelector.hpp"
 
+#include <algorithm>
 #include <stack>
 #include <string>
 
 namespace webvtt {
-void InternalNodeObject::appendChild(std::shared_ptr<NodeObject> nodeObject) {
-  children.push_back(nodeObject);
+void InternalNodeObject::appendChild(NodeObject *nodeObject) {
+  nodeObject->parent = this;
+  if (lastChild == nullptr)
+    firstChild = nodeObject;
+  else
+    lastChild->nextSibling = nodeObject;
+  lastChild = nodeObject;
+}
+
+NodeObject *InternalNodeObject::getFirstChild() const {
+  return firstChild;
 }
 
 
@@ -41,24 +50,24 @@ InternalNodeObject::convertToInternalNodeType(std::u32string_view nodeTypeName)
   return NodeType::UNDEFINED;
 };
 
-std::shared_ptr<InternalNodeObject> InternalNodeObject::makeInternalNode(NodeObject::NodeType nodeType) {
-  std::shared_ptr<InternalNodeObject> retValue = nullptr;
+InternalNodeObject *InternalNodeObject::makeInternalNode(NodeArena &arena, NodeObject::NodeType nodeType) {
+  InternalNodeObject *retValue = nullptr;
   switch (nodeType) {
-    case NodeType::BOLD:retValue = std::make_shared<BoldObject>();
+    case NodeType::BOLD:retValue = arena.make<BoldObject>();
       break;
-    case NodeType::CLASS:retValue = std::make_shared<ClassObject>();
+    case NodeType::CLASS:retValue = arena.make<ClassObject>();
       break;
-    case NodeType::ITALIC:retValue = std::make_shared<ItalicObject>();
+    case NodeType::ITALIC:retValue = arena.make<ItalicObject>();
       break;
-    case NodeType::LANGUAGE:retValue = std::make_shared<LanguageObject>();
+    case NodeType::LANGUAGE:retValue = arena.make<LanguageObject>();
       break;
-    case NodeType::RUBY:retValue = std::make_shared<RubyObject>();
+    case NodeType::RUBY:retValue = arena.make<RubyObject>();
       break;
-    case NodeType::RUBY_TEXT:retValue = std::make_shared<RubyTextObject>();
+    case NodeType::RUBY_TEXT:retValue = arena.make<RubyTextObject>();
       break;
-    case NodeType::UNDERLINE:retValue = std::make_shared<UnderlineObject>();
+    case NodeType::UNDERLINE:retValue = arena.make<UnderlineObject>();
       break;
-    case NodeType::VOICE:return std::make_shared<VoiceObject>();
+    case NodeType::VOICE:return arena.make<VoiceObject>();
       break;
     default:retValue = nullptr;
       break;
@@ -66,35 +75,30 @@ std::shared_ptr<InternalNodeObject> InternalNodeObject::makeInternalNode(NodeObj
   return retValue;
 };
 
-void InternalNodeObject::setClasses(std::list<std::u32string> &newClasses) {
-  this->classes = newClasses;
+void InternalNodeObject::setClasses(NodeArena &arena, std::span<const std::u32string_view> newClasses) {
+  auto atoms = arena.makeArray<Atom>(newClasses.size());
+  std::transform(newClasses.begin(), newClasses.end(), atoms.begin(), Atom::intern);
+  this->classes = atoms;
 }
-void InternalNodeObject::setLanguage(std::u32string &newLanguage) {
+void InternalNodeObject::setLanguage(Atom newLanguage) {
   this->language = newLanguage;
 };
-void InternalNodeObject::processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation) {
+void InternalNodeObject::processAnnotationString(NodeArena &,
+                                                 std::stack<Atom> &,
+                                                 std::u32string_view) {
   //Do nothing by default
 }
 
-void InternalNodeObject::visitChildren(ICueTreeVisitor &visitor) {
-  for (auto &child : children)
+void InternalNodeObject::visitChildren(ICueTreeVisitor &visitor) const {
+  for (NodeObject *child = firstChild; child != nullptr; child = child->nextSibling)
     child->accept(visitor);
 }
-const std::list<std::u32string> &InternalNodeObject::getClasses() {
+std::span<const Atom> InternalNodeObject::getClasses() const {
   return classes;
 }
 
-std::u32string_view InternalNodeObject::getLanguage() {
+Atom InternalNodeObject::getLanguage() const {
   return language;
 }
-void InternalNodeObject::visit(const ClassSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = false;
-  for (const auto &oneClass: this->getClasses()) {
-    if (selector.getClassName() == oneClass) {
-      shouldApplyLastVisitedStyleSheet = true;
-      break;
-    }
-  }
-}
 
 } // namespace webvtt
@@ -2,12 +2,17 @@
 
 namespace webvtt
 {
-    void LeafNodeObject::appendChild(std::shared_ptr<NodeObject> nodeObject)
+    void LeafNodeObject::appendChild(NodeObject *)
     {
         throw std::runtime_error("Add Node Object not supported to leaf node in tree");
     }
 
-    void LeafNodeObject::visitChildren(ICueTreeVisitor &visitor)
+    NodeObject *LeafNodeObject::getFirstChild() const
+    {
+        return nullptr;
+    }
+
+    void LeafNodeObject::visitChildren(ICueTreeVisitor &) const
     {
         throw std::runtime_error("Visit children not supported to leaf node in tree");
     }
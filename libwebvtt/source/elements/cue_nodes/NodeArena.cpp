@@ -0,0 +1,56 @@
+#include "elements/cue_nodes/NodeArena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace webvtt {
+
+NodeArena::~NodeArena() {
+  reset();
+}
+
+void *NodeArena::allocate(size_t size, size_t alignment) {
+  size_t padding = -reinterpret_cast<uintptr_t>(position) & (alignment - 1);
+  if (padding + size > static_cast<size_t>(end - position)) {
+    addBlock(size + alignment);
+    padding = -reinterpret_cast<uintptr_t>(position) & (alignment - 1);
+  }
+  void *memory = position + padding;
+  position += padding + size;
+  return memory;
+}
+
+void NodeArena::addBlock(size_t minimalSize) {
+  size_t size = std::max(nextBlockSize, minimalSize + sizeof(Block));
+  auto *block = static_cast<Block *>(::operator new(size));
+  block->previous = lastBlock;
+  lastBlock = block;
+
+  position = reinterpret_cast<std::byte *>(block + 1);
+  end = reinterpret_cast<std::byte *>(block) + size;
+  nextBlockSize = std::min(nextBlockSize * 2, MAX_BLOCK_SIZE);
+}
+
+std::u32string_view NodeArena::copyString(std::u32string_view string) {
+  if (string.empty())
+    return {};
+  auto *copy = static_cast<char32_t *>(allocate(string.size() * sizeof(char32_t), alignof(char32_t)));
+  std::copy(string.begin(), string.end(), copy);
+  return {copy, string.size()};
+}
+
+void NodeArena::reset() {
+  //Records are in blocks, so objects are destroyed before blocks are released
+  for (; lastDestructor != nullptr; lastDestructor = lastDestructor->previous)
+    lastDestructor->destroy(lastDestructor->object);
+
+  while (lastBlock != nullptr) {
+    Block *previous = lastBlock->previous;
+    ::operator delete(lastBlock);
+    lastBlock = previous;
+  }
+  position = inlineBlock;
+  end = inlineBlock + INLINE_BLOCK_SIZE;
+  nextBlockSize = INLINE_BLOCK_SIZE * 2;
+}
+
+} // namespace webvtt
@@ -10,8 +10,4 @@ BoldObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void BoldObject::visit(const BoldTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
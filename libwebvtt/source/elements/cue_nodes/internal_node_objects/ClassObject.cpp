@@ -11,8 +11,4 @@ ClassObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void ClassObject::visit(const ClassTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
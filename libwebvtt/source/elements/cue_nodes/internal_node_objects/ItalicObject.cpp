@@ -11,8 +11,4 @@ ItalicObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void ItalicObject::visit(const ItalicTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
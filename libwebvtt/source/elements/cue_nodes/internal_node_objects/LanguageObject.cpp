@@ -5,16 +5,18 @@
 #include <string>
 
 namespace webvtt {
-void LanguageObject::processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation) {
-  languages.push(annotation);
+void LanguageObject::processAnnotationString(NodeArena &,
+                                             std::stack<Atom> &languages,
+                                             std::u32string_view annotation) {
+  languages.push(Atom::intern(annotation));
 }
 
 NodeObject::NodeType LanguageObject::getNodeType() const {
   return NodeObject::NodeType::LANGUAGE;
 };
 
-void LanguageObject::processEndToken(std::shared_ptr<NodeObject> &nodeObject,
-                                     std::stack<std::u32string> &languages,
+void LanguageObject::processEndToken(NodeObject *&nodeObject,
+                                     std::stack<Atom> &languages,
                                      NodeObject::NodeType value) {
   NodeObject::processEndToken(nodeObject, languages, value);
   if (nodeObject->getNodeType() == value) {
@@ -27,11 +29,5 @@ void
 LanguageObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
-void LanguageObject::visit(const LanguageTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-void LanguageObject::visit(const LanguageSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = selector.isValueMatch(this->language);
-}
 
 } // namespace webvtt
@@ -10,8 +10,4 @@ RubyObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void RubyObject::visit(const RubyTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
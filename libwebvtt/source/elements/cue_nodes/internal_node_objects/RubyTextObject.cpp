@@ -6,18 +6,18 @@ namespace webvtt {
 NodeObject::NodeType RubyTextObject::getNodeType() const {
   return NodeObject::NodeType::RUBY_TEXT;
 };
-void RubyTextObject::processEndToken(std::shared_ptr<NodeObject> &nodeObject,
-                                     std::stack<std::u32string> &languages,
+void RubyTextObject::processEndToken(NodeObject *&nodeObject,
+                                     std::stack<Atom> &languages,
                                      NodeType value) {
   NodeObject::processEndToken(nodeObject, languages, value);
 
   if (value == NodeObject::NodeType::RUBY && nodeObject->getNodeType() == NodeObject::NodeType::RUBY_TEXT) {
-    auto parent = nodeObject->getParent().lock();
+    auto parent = nodeObject->getParent();
     if (parent == nullptr) {
       DILOGE("No parent to ruby text object");
       return;
     }
-    auto grandparent = parent->getParent().lock();
+    auto grandparent = parent->getParent();
     if (grandparent == nullptr) {
       DILOGE("No grand parent to ruby text object");
       return;
@@ -31,8 +31,4 @@ void RubyTextObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void RubyTextObject::visit(const RubyTextTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
@@ -11,8 +11,4 @@ void UnderlineObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
 
-void UnderlineObject::visit(const UnderlineTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-
 } // namespace webvtt
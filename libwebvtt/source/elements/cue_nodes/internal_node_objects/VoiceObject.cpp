@@ -3,8 +3,10 @@
 
 namespace webvtt {
 
-void VoiceObject::processAnnotationString(std::stack<std::u32string> &languages, std::u32string &annotation) {
-  this->voiceName = annotation;
+void VoiceObject::processAnnotationString(NodeArena &,
+                                          std::stack<Atom> &,
+                                          std::u32string_view annotation) {
+  this->voiceName = Atom::intern(annotation);
 }
 NodeObject::NodeType VoiceObject::getNodeType() const {
   return NodeObject::NodeType::VOICE;
@@ -14,11 +16,8 @@ void
 VoiceObject::accept(ICueTreeVisitor &visitor) const {
   visitor.visit(*this);
 }
-void VoiceObject::visit(const VoiceTypeSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = true;
-}
-void VoiceObject::visit(const VoiceSelector &selector) {
-  shouldApplyLastVisitedStyleSheet = selector.isValueMatch(this->voiceName);
+Atom VoiceObject::getVoiceName() const {
+  return voiceName;
 }
 
 } // namespace webvtt
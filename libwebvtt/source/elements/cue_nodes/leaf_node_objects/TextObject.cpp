@@ -14,4 +14,9 @@ namespace webvtt
       visitor.visit(*this);
     }
 
+    std::u32string_view TextObject::getText() const
+    {
+        return text;
+    }
+
 } // namespace webvtt
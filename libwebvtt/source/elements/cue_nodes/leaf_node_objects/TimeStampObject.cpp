@@ -9,5 +9,11 @@ void
 TimeStampObject::accept(ICueTreeVisitor &visitor) const  {
   visitor.visit(*this);
 }
+double TimeStampObject::getTime() const {
+  return toSeconds(time);
+}
+TimeStamp TimeStampObject::getTimeStamp() const {
+  return time;
+}
 
 } // namespace webvtt
@@ -0,0 +1,24 @@
+#include "elements/style_matching/AncestorBloomFilter.hpp"
+
+namespace webvtt {
+
+void AncestorBloomFilter::clear() {
+  levels.assign(1, Bits{});
+}
+
+void AncestorBloomFilter::push(std::span<const uint32_t> keys) {
+  Bits bits = levels.back();
+  for (uint32_t key : keys) {
+    uint32_t hash = mix(key);
+    setBit(bits, hash);
+    setBit(bits, hash >> 16);
+  }
+  levels.push_back(bits);
+}
+
+void AncestorBloomFilter::pop() {
+  if (levels.size() > 1)
+    levels.pop_back();
+}
+
+} // namespace webvtt
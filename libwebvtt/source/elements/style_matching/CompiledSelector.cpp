@@ -0,0 +1,137 @@
+#include "elements/style_matching/CompiledSelector.hpp"
+#include "elements/visitors/IStyleSelectorVisitor.hpp"
+#include <algorithm>
+
+namespace webvtt {
+
+namespace {
+
+constexpr uint32_t ID_SPECIFICITY = 0x10000;
+constexpr uint32_t CLASS_SPECIFICITY = 0x100;
+constexpr uint32_t TYPE_SPECIFICITY = 0x1;
+
+/**
+ * Visits selector of style sheet and appends its simple selectors to compound being compiled
+ */
+class SelectorCompiler : public IStyleSelectorVisitor {
+ public:
+  std::vector<CompiledSelector> compiledSelectors;
+
+  void addCompound(const StyleSelector &selector) {
+    current.compounds.emplace_back();
+    selector.accept(*this);
+    current.compounds.back().combinator = selector.getStyleSelectorCombinator();
+  }
+
+  void finishSelector() {
+    auto &compounds = current.compounds;
+    if (compounds.empty() || !isMatchable) {
+      current = {};
+      isMatchable = true;
+      return;
+    }
+
+    //Combinator is written after compound it follows, compound is stored with combinator to compound before it
+    for (size_t index = compounds.size() - 1; index > 0; index--)
+      compounds[index].combinator = compounds[index - 1].combinator;
+    compounds.front().combinator = StyleSelector::StyleSelectorCombinator::NONE;
+    std::reverse(compounds.begin(), compounds.end());
+
+    const auto &subject = compounds.front();
+    if (subject.id)
+      current.subjectKey = CompiledSelector::makeKey(CompiledSelector::KeyKind::ID, *subject.id);
+    else if (!subject.classNames.empty())
+      current.subjectKey = CompiledSelector::makeKey(CompiledSelector::KeyKind::CLASS, subject.classNames.front());
+    else if (subject.type != NodeObject::NodeType::UNDEFINED)
+      current.subjectKey = CompiledSelector::makeKey(subject.type);
+
+    for (size_t index = 1; index < compounds.size(); index++) {
+      auto relation = compounds[index - 1].combinator;
+      if (relation == StyleSelector::StyleSelectorCombinator::DESCENDANT
+          || relation == StyleSelector::StyleSelectorCombinator::CHILD)
+        addAncestorKeys(compounds[index]);
+    }
+
+    compiledSelectors.push_back(std::move(current));
+    current = {};
+  }
+
+  void visit(const MatchAllSelector &) override { setType(NodeObject::NodeType::ROOT, 0); }
+  void visit(const IdSelector &selector) override {
+    compound().id = selector.getId();
+    current.specificity += ID_SPECIFICITY;
+  }
+  void visit(const ClassSelector &selector) override {
+    compound().classNames.push_back(selector.getClassName());
+    current.specificity += CLASS_SPECIFICITY;
+  }
+
+  void visit(const CompoundSelector &selector) override {
+    for (const auto &simpleSelector : selector.getStyleSelectors())
+      simpleSelector->accept(*this);
+  }
+  void visit(const CombinatorSelector &selector) override {
+    for (const auto &compoundSelector : selector.getStyleSelectors()) {
+      addCompound(*compoundSelector);
+      if (compoundSelector->getStyleSelectorCombinator() == StyleSelector::StyleSelectorCombinator::MULTIPLE)
+        finishSelector();
+    }
+  }
+
+  void visit(const BoldTypeSelector &) override { setType(NodeObject::NodeType::BOLD); }
+  void visit(const ClassTypeSelector &) override { setType(NodeObject::NodeType::CLASS); }
+  void visit(const ItalicTypeSelector &) override { setType(NodeObject::NodeType::ITALIC); }
+  void visit(const LanguageTypeSelector &) override { setType(NodeObject::NodeType::LANGUAGE); }
+  void visit(const RubyTypeSelector &) override { setType(NodeObject::NodeType::RUBY); }
+  void visit(const RubyTextTypeSelector &) override { setType(NodeObject::NodeType::RUBY_TEXT); }
+  void visit(const UnderlineTypeSelector &) override { setType(NodeObject::NodeType::UNDERLINE); }
+  void visit(const VoiceTypeSelector &) override { setType(NodeObject::NodeType::VOICE); }
+
+  void visit(const LanguageSelector &selector) override { addAttributeTest(NodeObject::NodeType::LANGUAGE, selector); }
+  void visit(const VoiceSelector &selector) override { addAttributeTest(NodeObject::NodeType::VOICE, selector); }
+
+ private:
+  CompiledSelector current;
+  bool isMatchable = true;
+
+  CompiledSelector::Compound &compound() { return current.compounds.back(); }
+
+  void setType(NodeObject::NodeType type, uint32_t specificity = TYPE_SPECIFICITY) {
+    //Node has one type, so compound with two different types never matches
+    if (compound().type != NodeObject::NodeType::UNDEFINED && compound().type != type)
+      isMatchable = false;
+    compound().type = type;
+    current.specificity += specificity;
+  }
+
+  void addAttributeTest(NodeObject::NodeType nodeType, const AttributeSelector &selector) {
+    Atom exactValue;
+    if (selector.getStringMatchingType() == AttributeSelector::StringMatchType::EXACT_MATCHING)
+      exactValue = Atom::intern(selector.getAttributeValue());
+    compound().attributeTests.push_back({nodeType, &selector, exactValue});
+    current.specificity += CLASS_SPECIFICITY;
+  }
+
+  void addAncestorKeys(const CompiledSelector::Compound &ancestor) {
+    if (ancestor.type != NodeObject::NodeType::UNDEFINED)
+      current.ancestorKeys.push_back(CompiledSelector::makeKey(ancestor.type));
+    for (auto className : ancestor.classNames)
+      current.ancestorKeys.push_back(CompiledSelector::makeKey(CompiledSelector::KeyKind::CLASS, className));
+    if (ancestor.id)
+      current.ancestorKeys.push_back(CompiledSelector::makeKey(CompiledSelector::KeyKind::ID, *ancestor.id));
+  }
+};
+
+} // namespace
+
+std::vector<CompiledSelector> CompiledSelector::compile(const StyleSelector &selector) {
+  SelectorCompiler compiler;
+  if (selector.getSelectorType() == StyleSelector::SelectorType::COMBINATOR)
+    selector.accept(compiler);
+  else
+    compiler.addCompound(selector);
+  compiler.finishSelector();
+  return std::move(compiler.compiledSelectors);
+}
+
+} // namespace webvtt
@@ -0,0 +1,9 @@
+#include "elements/style_matching/ComputedStyle.hpp"
+
+namespace webvtt {
+
+std::string_view ComputedStyle::getValue(CSSProperty property) const {
+  return declarations.get(property).value_or(std::string_view());
+}
+
+} // namespace webvtt
@@ -0,0 +1,125 @@
+#include "elements/style_matching/ComputedStyleCache.hpp"
+#include "elements/cue_nodes/InternalNodeObject.hpp"
+#include "elements/cue_nodes/internal_node_objects/VoiceObject.hpp"
+#include "elements/webvtt_objects/Cue.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace webvtt {
+
+size_t ComputedStyleCache::SignatureHash::operator()(const Signature &signature) const {
+  size_t hash = static_cast<size_t>(signature.type);
+  auto combine = [&hash](size_t value) { hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2); };
+  for (Atom className : signature.classes)
+    combine(className.getId());
+  combine(signature.voice.getId());
+  combine(signature.language.getId());
+  combine(std::hash<std::u32string_view>()(signature.cueId));
+  combine(signature.parentId);
+  combine(signature.previousSiblingId);
+  return hash;
+}
+
+ComputedStyleCache::ComputedStyleCache(CueStyleMatcher &matcher) : matcher(matcher) {
+  clear();
+}
+
+void ComputedStyleCache::resolve(const NodeObject &root, std::u32string_view cueId, std::vector<NodeStyle> &nodeStyles) {
+  nodeStyles.clear();
+  currentCueId = cueId;
+  resolveSubtree(root, Entry{0, emptyStyle}, 0, nodeStyles);
+}
+
+void ComputedStyleCache::resolve(const Cue &cue, std::vector<NodeStyle> &nodeStyles) {
+  if (!cue.hasTextTreeRoot()) {
+    nodeStyles.clear();
+    return;
+  }
+  resolve(cue.getTextTreeRoot(), cue.getIdentifier(), nodeStyles);
+}
+
+void ComputedStyleCache::clear() {
+  signatures.clear();
+  styles.clear();
+  emptyStyle = internStyle({});
+  hitNumber = 0;
+  missNumber = 0;
+}
+
+const ComputedStyleCache::Entry &ComputedStyleCache::resolveSubtree(const NodeObject &node, const Entry &parent,
+                                                                    uint32_t previousSiblingId,
+                                                                    std::vector<NodeStyle> &nodeStyles) {
+  //Text and time stamps are not matched by selectors, they take style of parent
+  if (!isElement(node)) {
+    nodeStyles.push_back({&node, parent.style});
+    return parent;
+  }
+
+  makeSignature(node, parent.id, previousSiblingId);
+  auto signature = signatures.find(lookupSignature);
+  if (signature != signatures.end()) {
+    hitNumber++;
+  } else {
+    missNumber++;
+    signature = signatures.emplace(lookupSignature, makeEntry(node, *parent.style)).first;
+  }
+  //Elements of unordered map keep their address, so entry stays valid while children are added
+  const Entry &entry = signature->second;
+  nodeStyles.push_back({&node, entry.style});
+
+  uint32_t previousChildId = 0;
+  for (const NodeObject *child = node.getFirstChild(); child != nullptr; child = child->getNextSibling()) {
+    const Entry &childEntry = resolveSubtree(*child, entry, previousChildId, nodeStyles);
+    if (matcher.hasSiblingRules() && isElement(*child))
+      previousChildId = childEntry.id;
+  }
+  return entry;
+}
+
+void ComputedStyleCache::makeSignature(const NodeObject &node, uint32_t parentId, uint32_t previousSiblingId) {
+  const auto &element = static_cast<const InternalNodeObject &>(node);
+  auto type = node.getNodeType();
+  lookupSignature.type = type;
+
+  //Signature is reused, so lookup of known signature does not allocate
+  auto classes = element.getClasses();
+  lookupSignature.classes.assign(classes.begin(), classes.end());
+  std::sort(lookupSignature.classes.begin(), lookupSignature.classes.end());
+
+  if (type == NodeObject::NodeType::VOICE)
+    lookupSignature.voice = static_cast<const VoiceObject &>(node).getVoiceName();
+  else
+    lookupSignature.voice = {};
+  lookupSignature.language = element.getLanguage();
+  //Identifier not used by any selector matches like empty one, so such cues share signatures
+  if (type == NodeObject::NodeType::ROOT && matcher.isRuleId(currentCueId))
+    lookupSignature.cueId = currentCueId;
+  else
+    lookupSignature.cueId.clear();
+
+  lookupSignature.parentId = parentId;
+  lookupSignature.previousSiblingId = previousSiblingId;
+}
+
+ComputedStyleCache::Entry ComputedStyleCache::makeEntry(const NodeObject &node, const ComputedStyle &parentStyle) {
+  ComputedStyle::Declarations declarations = parentStyle.getDeclarations();
+  for (const StyleSheet *styleSheet : matcher.matchNode(node, currentCueId)) {
+    for (auto [property, value] : styleSheet->getCSSRules())
+      declarations.set(property, value);
+  }
+  return {static_cast<uint32_t>(signatures.size() + 1), internStyle(std::move(declarations))};
+}
+
+std::shared_ptr<const ComputedStyle> ComputedStyleCache::internStyle(ComputedStyle::Declarations &&declarations) {
+  auto style = styles.find(declarations);
+  if (style != styles.end())
+    return *style;
+  return *styles.insert(std::make_shared<const ComputedStyle>(std::move(declarations))).first;
+}
+
+bool ComputedStyleCache::isElement(const NodeObject &node) {
+  auto type = node.getNodeType();
+  return type != NodeObject::NodeType::TEXT && type != NodeObject::NodeType::TIME_STAMP;
+}
+
+} // namespace webvtt
@@ -0,0 +1,207 @@
+#include "elements/style_matching/CueStyleMatcher.hpp"
+#include "elements/cue_nodes/InternalNodeObject.hpp"
+#include "elements/cue_nodes/internal_node_objects/VoiceObject.hpp"
+#include "elements/webvtt_objects/Cue.hpp"
+#include <algorithm>
+
+namespace webvtt {
+
+void CueStyleMatcher::MatchedRules::clear() {
+  nodes.clear();
+  styleSheets.clear();
+}
+
+void CueStyleMatcher::addStyleSheet(const StyleSheet &styleSheet) {
+  if (styleSheet.getStyleSheetType() != StyleSheet::StyleSheetType::CUE || !styleSheet.hasSelector())
+    return;
+
+  uint32_t order = styleSheetNumber++;
+  for (auto &selector : CompiledSelector::compile(styleSheet.getSelector())) {
+    auto ruleIndex = static_cast<uint32_t>(rules.size());
+    for (const auto &compound : selector.compounds) {
+      isSiblingRuleAdded |= compound.combinator == StyleSelector::StyleSelectorCombinator::NEXT_SIBLING
+          || compound.combinator == StyleSelector::StyleSelectorCombinator::SUBSEQUENT_SIBLING;
+      if (compound.id)
+        ruleIds.insert(*compound.id);
+    }
+    if (selector.subjectKey)
+      rulesByKey[*selector.subjectKey].push_back(ruleIndex);
+    else
+      universalRules.push_back(ruleIndex);
+    rules.push_back({std::move(selector), &styleSheet, order});
+  }
+}
+
+void CueStyleMatcher::match(const NodeObject &root, std::u32string_view cueId, MatchedRules &result) {
+  result.clear();
+  ancestorFilter.clear();
+  currentCueId = cueId;
+  matchSubtree(root, result);
+}
+
+void CueStyleMatcher::match(const Cue &cue, MatchedRules &result) {
+  if (!cue.hasTextTreeRoot()) {
+    result.clear();
+    return;
+  }
+  match(cue.getTextTreeRoot(), cue.getIdentifier(), result);
+}
+
+std::span<const StyleSheet *const> CueStyleMatcher::matchNode(const NodeObject &node, std::u32string_view cueId) {
+  currentCueId = cueId;
+  collectMatchedRules(node, false);
+  nodeStyleSheets.clear();
+  for (const auto &matchedRule : matchedRules)
+    nodeStyleSheets.push_back(matchedRule.styleSheet);
+  return nodeStyleSheets;
+}
+
+void CueStyleMatcher::matchSubtree(const NodeObject &node, MatchedRules &result) {
+  NodeRules nodeRules{&node, static_cast<uint32_t>(result.styleSheets.size()), 0};
+  collectMatchedRules(node, true);
+  for (const auto &matchedRule : matchedRules)
+    result.styleSheets.push_back(matchedRule.styleSheet);
+  nodeRules.length = static_cast<uint32_t>(matchedRules.size());
+  result.nodes.push_back(nodeRules);
+
+  NodeObject *child = node.getFirstChild();
+  if (child == nullptr)
+    return;
+  //Keys of node are collected with its rules, and are in filter while its children are matched
+  ancestorFilter.push(nodeKeys);
+  for (; child != nullptr; child = child->getNextSibling())
+    matchSubtree(*child, result);
+  ancestorFilter.pop();
+}
+
+void CueStyleMatcher::collectMatchedRules(const NodeObject &node, bool isAncestorFilterUsed) {
+  nodeKeys.clear();
+  matchedRules.clear();
+  if (!isElement(node))
+    return;
+
+  collectKeys(node);
+  for (uint32_t key : nodeKeys) {
+    auto bucket = rulesByKey.find(key);
+    if (bucket != rulesByKey.end())
+      testRules(bucket->second, node, isAncestorFilterUsed);
+  }
+  testRules(universalRules, node, isAncestorFilterUsed);
+
+  //Sheet matched by several selectors of its list is applied once, with highest specificity
+  std::sort(matchedRules.begin(), matchedRules.end(), [](const MatchedRule &first, const MatchedRule &second) {
+    return first.order != second.order ? first.order < second.order : first.specificity > second.specificity;
+  });
+  auto last = std::unique(matchedRules.begin(), matchedRules.end(),
+                          [](const MatchedRule &first, const MatchedRule &second) {
+                            return first.order == second.order;
+                          });
+  matchedRules.erase(last, matchedRules.end());
+  std::stable_sort(matchedRules.begin(), matchedRules.end(),
+                   [](const MatchedRule &first, const MatchedRule &second) {
+                     return first.specificity < second.specificity;
+                   });
+}
+
+void CueStyleMatcher::testRules(const std::vector<uint32_t> &ruleIndexes, const NodeObject &node,
+                                bool isAncestorFilterUsed) {
+  for (uint32_t ruleIndex : ruleIndexes) {
+    const Rule &rule = rules[ruleIndex];
+    if (isAncestorFilterUsed && !ancestorFilter.mayContainAll(rule.selector.ancestorKeys))
+      continue;
+    if (matchesFrom(rule.selector, 0, node))
+      matchedRules.push_back({rule.selector.specificity, rule.order, rule.styleSheet});
+  }
+}
+
+void CueStyleMatcher::collectKeys(const NodeObject &node) {
+  auto type = node.getNodeType();
+  nodeKeys.push_back(CompiledSelector::makeKey(type));
+  for (Atom className : static_cast<const InternalNodeObject &>(node).getClasses())
+    nodeKeys.push_back(CompiledSelector::makeKey(CompiledSelector::KeyKind::CLASS, className));
+  if (type == NodeObject::NodeType::ROOT && !currentCueId.empty())
+    nodeKeys.push_back(CompiledSelector::makeKey(CompiledSelector::KeyKind::ID, currentCueId));
+}
+
+bool CueStyleMatcher::matchesFrom(const CompiledSelector &selector, size_t index, const NodeObject &node) const {
+  const auto &compound = selector.compounds[index];
+  if (!matchesCompound(compound, node))
+    return false;
+  if (index + 1 == selector.compounds.size())
+    return true;
+
+  switch (compound.combinator) {
+    case StyleSelector::StyleSelectorCombinator::CHILD: {
+      const NodeObject *parent = node.getParent();
+      return parent != nullptr && matchesFrom(selector, index + 1, *parent);
+    }
+    case StyleSelector::StyleSelectorCombinator::DESCENDANT:
+      for (const NodeObject *ancestor = node.getParent(); ancestor != nullptr; ancestor = ancestor->getParent()) {
+        if (matchesFrom(selector, index + 1, *ancestor))
+          return true;
+      }
+      return false;
+    case StyleSelector::StyleSelectorCombinator::NEXT_SIBLING: {
+      const NodeObject *sibling = getPreviousElementSibling(node);
+      return sibling != nullptr && matchesFrom(selector, index + 1, *sibling);
+    }
+    case StyleSelector::StyleSelectorCombinator::SUBSEQUENT_SIBLING: {
+      const NodeObject *parent = node.getParent();
+      if (parent == nullptr)
+        return false;
+      for (const NodeObject *sibling = parent->getFirstChild(); sibling != &node; sibling = sibling->getNextSibling()) {
+        if (isElement(*sibling) && matchesFrom(selector, index + 1, *sibling))
+          return true;
+      }
+      return false;
+    }
+    default:return false;
+  }
+}
+
+bool CueStyleMatcher::matchesCompound(const CompiledSelector::Compound &compound, const NodeObject &node) const {
+  auto type = node.getNodeType();
+  if (compound.type != NodeObject::NodeType::UNDEFINED && compound.type != type)
+    return false;
+  if (compound.id && (type != NodeObject::NodeType::ROOT || *compound.id != currentCueId))
+    return false;
+
+  const auto &element = static_cast<const InternalNodeObject &>(node);
+  auto classes = element.getClasses();
+  for (Atom className : compound.classNames) {
+    if (std::find(classes.begin(), classes.end(), className) == classes.end())
+      return false;
+  }
+
+  for (const auto &attributeTest : compound.attributeTests) {
+    if (attributeTest.nodeType != type)
+      return false;
+    Atom value = type == NodeObject::NodeType::VOICE
+                 ? static_cast<const VoiceObject &>(node).getVoiceName()
+                 : element.getLanguage();
+    if (!attributeTest.exactValue.empty() ? value != attributeTest.exactValue
+                                          : !attributeTest.selector->isValueMatch(value.getString()))
+      return false;
+  }
+  return true;
+}
+
+bool CueStyleMatcher::isElement(const NodeObject &node) {
+  auto type = node.getNodeType();
+  return type != NodeObject::NodeType::TEXT && type != NodeObject::NodeType::TIME_STAMP;
+}
+
+const NodeObject *CueStyleMatcher::getPreviousElementSibling(const NodeObject &node) {
+  const NodeObject *parent = node.getParent();
+  if (parent == nullptr)
+    return nullptr;
+  //Nodes link only to next sibling, so previous one is found from first child of parent
+  const NodeObject *previous = nullptr;
+  for (const NodeObject *sibling = parent->getFirstChild(); sibling != &node; sibling = sibling->getNextSibling()) {
+    if (isElement(*sibling))
+      previous = sibling;
+  }
+  return previous;
+}
+
+} // namespace webvtt
@@ -9,7 +9,7 @@ ClassSelector::getSelectorType() const {
 void ClassSelector::accept(IStyleSelectorVisitor &visitor) const {
   visitor.visit(*this);
 }
-std::u32string_view ClassSelector::getClassName() const {
+Atom ClassSelector::getClassName() const {
   return className;
 }
 
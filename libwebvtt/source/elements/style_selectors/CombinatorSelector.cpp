@@ -10,4 +10,8 @@ StyleSelector::SelectorType CombinatorSelector::getSelectorType() const {
 void CombinatorSelector::accept(IStyleSelectorVisitor &visitor) const {
   visitor.visit(*this);
 }
+
+const std::list<std::unique_ptr<StyleSelector>> &CombinatorSelector::getStyleSelectors() const {
+  return styleSelectors;
+}
 } // namespace webvtt
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace webvtt
     void CompoundSelector::accept(IStyleSelectorVisitor &visitor) const {
       visitor.visit(*this);
     }
+    const std::list<std::unique_ptr<StyleSelector>> &CompoundSelector::getStyleSelectors() const {
+      return styleSelectors;
+    }
 
 
 } // namespace webvtt
@@ -3,6 +3,7 @@
 #include "elements/style_selectors/attribute_selectors/VoiceSelector.hpp"
 #include "parser/CSSConstants.hpp"
 #include "parser/ParserUtil.hpp"
+#include <algorithm>
 
 namespace webvtt {
 void AttributeSelector::setStringMatchingType(StringMatchType newStringMatchType) {
@@ -38,35 +39,31 @@ bool AttributeSelector::isValueMatch(std::u32string_view valueToMatch) const {
       break;
     case StringMatchType::EXACT_MATCHING:retValue = (valueToMatch == this->attributeValue);
       break;
-    case StringMatchType::STARTS_WITH:retValue = this->attributeValue.starts_with(valueToMatch);
+    //Value given in selector is searched in value of node, empty value never matches
+    case StringMatchType::STARTS_WITH:
+      retValue = !this->attributeValue.empty() && valueToMatch.starts_with(this->attributeValue);
       break;
-    case StringMatchType::ENDS_WITH: retValue = this->attributeValue.ends_with(valueToMatch);
+    case StringMatchType::ENDS_WITH:
+      retValue = !this->attributeValue.empty() && valueToMatch.ends_with(this->attributeValue);
       break;
     case StringMatchType::CONTAINS_SUBSTR:
-      retValue = (this->attributeValue.find(valueToMatch) != std::u32string_view::npos);
+      retValue = !this->attributeValue.empty() && valueToMatch.find(this->attributeValue) != std::u32string_view::npos;
       break;
     case StringMatchType::WHITE_SPACE_SEPERATED_WORDS: {
-      std::u32string_view tempView = this->attributeValue;
-      auto position = tempView.begin();
-      std::u32string characters = {ParserUtil::SPACE_C, ParserUtil::TAB_C, ParserUtil::LF_C, ParserUtil::CR_C};
       retValue = false;
-      while (position != tempView.end()) {
-        auto temp = ParserUtil::parseUntilAnyOfGivenCharacters(tempView, characters, position);
-        if (temp.empty()) break;
-        if (temp == valueToMatch) {
-          retValue = true;
-          break;
-        }
+      auto position = valueToMatch.begin();
+      while (position != valueToMatch.end() && !retValue) {
+        auto wordEnd = std::find_if(position, valueToMatch.end(), ParserUtil::IS_WHITE_SPACE);
+        retValue = !this->attributeValue.empty() && std::u32string_view(position, wordEnd) == this->attributeValue;
+        position = wordEnd == valueToMatch.end() ? wordEnd : wordEnd + 1;
       }
       break;
     }
-    case StringMatchType::EXACT_OR_FOLLOWED_BY_MINUS: {
-      std::u32string_view tempView = this->attributeValue;
-      auto position = tempView.begin();
-      auto temp = ParserUtil::parseUntilCharacter(tempView, ParserUtil::HYPHEN_MINUS, position);
-      retValue = (temp == valueToMatch);
+    case StringMatchType::EXACT_OR_FOLLOWED_BY_MINUS:
+      retValue = valueToMatch.starts_with(this->attributeValue) &&
+          (valueToMatch.size() == this->attributeValue.size() ||
+              valueToMatch[this->attributeValue.size()] == ParserUtil::HYPHEN_MINUS);
       break;
-    }
   }
 
   return retValue;
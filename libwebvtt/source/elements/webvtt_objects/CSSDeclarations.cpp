@@ -0,0 +1,31 @@
+#include "elements/webvtt_objects/CSSDeclarations.hpp"
+#include <algorithm>
+
+namespace webvtt {
+
+void CSSDeclarations::set(CSSProperty property, std::string_view value) {
+  size_t position = getPosition(property);
+  if (!contains(property)) {
+    mask |= getBit(property);
+    declarations.insert(declarations.begin() + position, Declaration{property, 0, 0});
+  }
+
+  Declaration &declaration = declarations[position];
+  //Shorter value is written over old one, longer one is appended
+  if (value.size() > declaration.length) {
+    declaration.offset = values.size();
+    values.append(value.size(), '\0');
+  }
+  std::copy(value.begin(), value.end(), values.begin() + declaration.offset);
+  declaration.length = value.size();
+}
+
+bool CSSDeclarations::operator==(const CSSDeclarations &other) const {
+  return mask == other.mask && std::equal(begin(), end(), other.begin(), other.end());
+}
+
+bool CSSDeclarations::operator<(const CSSDeclarations &other) const {
+  return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+}
+
+} // namespace webvtt
@@ -8,18 +8,64 @@ namespace webvtt
     void Cue::setText(std::u32string newText)
     {
         this->text = std::move(newText);
+        this->sourceText = std::u8string_view();
+        this->isTextDecoded = true;
+    }
+
+    void Cue::setText(std::u8string_view newText)
+    {
+        this->text.clear();
+        this->sourceText = newText;
+        this->isTextDecoded = newText.empty();
+    }
+
+    void Cue::setIdentifier(std::u8string_view newIdentifier)
+    {
+        this->identifier.clear();
+        this->sourceIdentifier = newIdentifier;
+        this->isIdentifierDecoded = newIdentifier.empty();
     }
 
     void Cue::setStartTime(double newTime)
+    {
+        this->startTime = fromSeconds(newTime);
+    }
+
+    void Cue::setStartTime(TimeStamp newTime)
     {
         this->startTime = newTime;
     }
 
     void Cue::setEndTime(double newTime)
+    {
+        this->endTime = fromSeconds(newTime);
+    }
+
+    void Cue::setEndTime(TimeStamp newTime)
     {
         this->endTime = newTime;
     }
 
+    double Cue::getStartTime() const
+    {
+        return toSeconds(startTime);
+    }
+
+    double Cue::getEndTime() const
+    {
+        return toSeconds(endTime);
+    }
+
+    TimeStamp Cue::getStartTimeStamp() const
+    {
+        return startTime;
+    }
+
+    TimeStamp Cue::getEndTimeStamp() const
+    {
+        return endTime;
+    }
+
     void Cue::setWritingDirection(WritingDirection newWritingDirection)
     {
         if (writingDirection != Cue::WritingDirection::HORIZONTAL)
@@ -73,18 +119,54 @@ namespace webvtt
         this->snapToLines = newSnapToLines;
     }
 
-    std::u32string_view Cue::getText()
+    std::u32string_view Cue::getText() const
     {
+        decodeOnce(this->text, this->isTextDecoded, this->sourceText);
         return text;
     }
 
-    void Cue::setTextTreeRoot(std::shared_ptr<NodeObject> treeRoot)
+    std::u8string_view Cue::getSourceText() const
+    {
+        return sourceText;
+    }
+
+    std::u32string_view Cue::getIdentifier() const
+    {
+        decodeOnce(this->identifier, this->isIdentifierDecoded, this->sourceIdentifier);
+        return identifier;
+    }
+
+    void Cue::decodeOnce(std::u32string &decoded, std::atomic<bool> &isDecoded, std::u8string_view source) const
+    {
+        if (isDecoded.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(this->decodingMutex);
+        if (isDecoded.load(std::memory_order_relaxed))
+            return;
+        decoded = ParserUtil::utf8to32(source);
+        isDecoded.store(true, std::memory_order_release);
+    }
+
+    NodeArena &Cue::clearTextTree()
+    {
+        this->textTreeRoot = nullptr;
+        this->textTreeArena.reset();
+        return textTreeArena;
+    }
+
+    void Cue::setTextTreeRoot(NodeObject *treeRoot)
     {
         this->textTreeRoot = treeRoot;
     }
 
-    const NodeObject &Cue::getTextTreeRoot()
+    bool Cue::hasTextTreeRoot() const
+    {
+        return this->textTreeRoot != nullptr;
+    }
+
+    const NodeObject &Cue::getTextTreeRoot() const
     {
-        return *this->textTreeRoot.get();
+        return *this->textTreeRoot;
     }
 }
@@ -1,7 +1,7 @@
 #include "elements/webvtt_objects/CueStyleSheet.hpp"
 
 namespace webvtt {
-StyleSheet::StyleSheetType CueStyleSheet::getStyleSheetType() {
+StyleSheet::StyleSheetType CueStyleSheet::getStyleSheetType() const {
   return StyleSheet::StyleSheetType::CUE;
 }
 bool CueStyleSheet::isSelectorAllowed(StyleSelector::SelectorType selectorType) const {
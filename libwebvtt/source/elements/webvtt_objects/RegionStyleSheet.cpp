@@ -1,7 +1,7 @@
 #include "elements/webvtt_objects/RegionStyleSheet.hpp"
 
 namespace webvtt {
-StyleSheet::StyleSheetType RegionStyleSheet::getStyleSheetType() {
+StyleSheet::StyleSheetType RegionStyleSheet::getStyleSheetType() const {
   return StyleSheet::StyleSheetType::REGION;
 }
 bool RegionStyleSheet::isSelectorAllowed(StyleSelector::SelectorType selectorType) const {
@@ -7,9 +7,8 @@ void StyleSheet::setSelector(std::unique_ptr<StyleSelector> newSelector) {
   this->styleSelector = std::move(newSelector);
 }
 
-void StyleSheet::addCSSRule(std::string_view name, std::string_view newValue) {
-  auto temp = std::string(name);
-  cssRules[temp] = newValue;
+void StyleSheet::addCSSRule(CSSProperty property, std::string_view newValue) {
+  cssRules.set(property, newValue);
 }
 
 std::unique_ptr<StyleSheet> StyleSheet::makeNewStyleSheet(StyleSheetType styleSheetType) {
@@ -23,7 +22,7 @@ std::unique_ptr<StyleSheet> StyleSheet::makeNewStyleSheet(StyleSheetType styleSh
   }
 }
 
-const std::map<std::string, std::string> &StyleSheet::getCSSRules() {
+const CSSDeclarations &StyleSheet::getCSSRules() const {
   return cssRules;
 }
 
@@ -31,4 +30,8 @@ const StyleSelector &StyleSheet::getSelector() const {
   return *styleSelector;
 }
 
+bool StyleSheet::hasSelector() const {
+  return styleSelector != nullptr;
+}
+
 } // namespace webvtt
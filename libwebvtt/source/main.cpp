@@ -1,6 +1,9 @@
 #include "parser/Parser.hpp"
 #include "parser/ParserUtil.hpp"
 #include "buffer/StringSyncBuffer.hpp"
+#include "buffer/MappedFileBuffer.hpp"
+#include "exceptions/FileMappingError.hpp"
+#include "parser/BatchParser.hpp"
 //#include "buffer/NonSyncStringBuffer.hpp"
 #include "decoder/UTF8ToUTF32StreamDecoder.hpp"
 #include <string>
@@ -12,9 +15,15 @@
 #include <chrono>
 #include <iostream>
 #include <filesystem>
+#include <vector>
+#include <cstdlib>
 
 using namespace std::chrono_literals;
 
+constexpr std::string_view MMAP_FLAG = "--mmap";
+constexpr std::string_view BATCH_FLAG = "--batch";
+constexpr std::string_view THREADS_FLAG = "--threads";
+
 void writeToBuffer(const std::shared_ptr<webvtt::StringSyncBuffer<char8_t>> &buffer, const std::string &input) {
   for (auto oneChar : input) {
     buffer->writeNext(oneChar);
@@ -23,18 +32,72 @@ void writeToBuffer(const std::shared_ptr<webvtt::StringSyncBuffer<char8_t>> &buf
   buffer->setInputEnded();
 }
 
+int parseMappedFile(const std::string &path) {
+  try {
+    //Mapped file need to outlive parser, parsed cues keep views into it
+    webvtt::MappedFileBuffer file(path);
+    webvtt::Parser parser;
+    parser.parseAll(file.getContent());
+  }
+  catch (const webvtt::FileMappingError &error) {
+    DILOGE(error.what());
+    return -1;
+  }
+  return 0;
+}
+
+int parseBatch(int argc, char *argv[]) {
+  size_t threadNumber = 0;
+  std::vector<std::filesystem::path> paths;
+
+  for (int i = 2; i < argc; i++) {
+    if (argv[i] == THREADS_FLAG && i + 1 < argc)
+      threadNumber = std::strtoul(argv[++i], nullptr, 10);
+    else
+      paths.emplace_back(argv[i]);
+  }
+  if (paths.empty()) {
+    DILOGE("Usage: webvtt --batch [--threads number] file_or_directory...");
+    return -1;
+  }
+
+  //Logging every block would serialize parsing threads, only errors are reported
+  CPlusPlusLogging::Logger::getLogger()->disableLog();
+
+  webvtt::BatchParser batchParser(threadNumber);
+  auto statistics = batchParser.parse(paths);
+
+  double megabytes = static_cast<double>(statistics.byteNumber) / 1e6;
+  std::cout << "files: " << statistics.fileNumber << " (failed " << statistics.failedFileNumber << ")\n"
+            << "size: " << megabytes << " MB\n"
+            << "cues: " << statistics.cueNumber << "\n"
+            << "time: " << statistics.seconds << " s\n"
+            << "files/s: " << static_cast<double>(statistics.fileNumber) / statistics.seconds << "\n"
+            << "MB/s: " << megabytes / statistics.seconds << "\n"
+            << "cues/s: " << static_cast<double>(statistics.cueNumber) / statistics.seconds << std::endl;
+  return statistics.failedFileNumber == 0 ? 0 : -1;
+}
+
 int main(int argc, char *argv[]) {
-  if (argc != 2) {
-    DILOGE("Accept only one argument");
+  if (argc >= 2 && std::string_view(argv[1]) == BATCH_FLAG)
+    return parseBatch(argc, argv);
+
+  bool useMapping = argc == 3 && std::string_view(argv[1]) == MMAP_FLAG;
+  if (argc != 2 && !useMapping) {
+    DILOGE("Usage: webvtt [--mmap] file | webvtt --batch [--threads number] file_or_directory...");
     return -1;
   }
+  const char *path = argv[argc - 1];
 
-  if (!std::filesystem::exists(argv[1])) {
+  if (!std::filesystem::exists(path)) {
     DILOGE("Given file doesn't exist");
     return -1;
   }
 
-  std::ifstream t(argv[1], std::ios_base::in);
+  if (useMapping)
+    return parseMappedFile(path);
+
+  std::ifstream t(path, std::ios_base::in);
 
   if (!t.is_open()) {
     DILOGE("Error in file opening");
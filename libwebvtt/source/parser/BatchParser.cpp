@@ -0,0 +1,126 @@
+#include "parser/BatchParser.hpp"
+#include "buffer/MappedFileBuffer.hpp"
+#include "exceptions/FileMappingError.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+
+namespace webvtt {
+
+BatchParser::BatchParser(size_t threadNumber) : threadNumber(threadNumber) {
+  if (this->threadNumber == 0)
+    this->threadNumber = std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+std::vector<std::filesystem::path> BatchParser::collectFiles(const std::vector<std::filesystem::path> &paths) {
+  std::vector<std::filesystem::path> files;
+
+  for (const auto &path : paths) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(path, error)) {
+      files.push_back(path);
+      continue;
+    }
+
+    for (std::filesystem::recursive_directory_iterator entry(path, error), end; !error && entry != end;
+         entry.increment(error)) {
+      if (entry->is_regular_file(error) && entry->path().extension() == FILE_EXTENSION)
+        files.push_back(entry->path());
+    }
+    if (error)
+      DILOGE("Error while reading directory " + path.string() + ": " + error.message());
+  }
+  return files;
+}
+
+BatchParser::Statistics BatchParser::parse(const std::vector<std::filesystem::path> &paths,
+                                           const FileCallback &callback) {
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::filesystem::path> files = collectFiles(paths);
+  size_t usedThreadNumber = std::max<size_t>(std::min(threadNumber, files.size()), 1);
+
+  std::vector<WorkQueue> queues(usedThreadNumber);
+  for (size_t fileIndex = 0; fileIndex < files.size(); fileIndex++)
+    queues[fileIndex % usedThreadNumber].fileIndices.push_back(fileIndex);
+
+  std::vector<Statistics> threadStatistics(usedThreadNumber);
+  std::vector<std::thread> threads;
+  for (size_t queue = 0; queue < usedThreadNumber; queue++)
+    threads.emplace_back(&BatchParser::parsingLoop, std::cref(files), std::ref(queues), queue, std::cref(callback),
+                         std::ref(threadStatistics[queue]));
+  for (auto &thread : threads)
+    thread.join();
+
+  Statistics statistics;
+  for (const auto &oneThreadStatistics : threadStatistics) {
+    statistics.fileNumber += oneThreadStatistics.fileNumber;
+    statistics.failedFileNumber += oneThreadStatistics.failedFileNumber;
+    statistics.byteNumber += oneThreadStatistics.byteNumber;
+    statistics.cueNumber += oneThreadStatistics.cueNumber;
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  statistics.seconds = elapsed.count();
+  return statistics;
+}
+
+std::optional<size_t> BatchParser::takeFile(std::vector<WorkQueue> &queues, size_t ownQueue) {
+  {
+    std::lock_guard<std::mutex> lock(queues[ownQueue].mutex);
+    auto &fileIndices = queues[ownQueue].fileIndices;
+    if (!fileIndices.empty()) {
+      size_t fileIndex = fileIndices.back();
+      fileIndices.pop_back();
+      return fileIndex;
+    }
+  }
+
+  //Steal from opposite end, so owner and thief rarely want same file
+  for (size_t offset = 1; offset < queues.size(); offset++) {
+    auto &victim = queues[(ownQueue + offset) % queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.fileIndices.empty()) {
+      size_t fileIndex = victim.fileIndices.front();
+      victim.fileIndices.pop_front();
+      return fileIndex;
+    }
+  }
+  //Files are never added while parsing, so all work is done
+  return std::nullopt;
+}
+
+void BatchParser::parsingLoop(const std::vector<std::filesystem::path> &files,
+                              std::vector<WorkQueue> &queues,
+                              size_t ownQueue,
+                              const FileCallback &callback,
+                              Statistics &statistics) {
+  Parser parser;
+
+  while (auto fileIndex = takeFile(queues, ownQueue)) {
+    const auto &path = files[fileIndex.value()];
+    statistics.fileNumber++;
+
+    try {
+      MappedFileBuffer file(path.string());
+      parser.reset();
+      parser.parseAll(file.getContent());
+
+      statistics.byteNumber += file.getContent().size();
+      statistics.cueNumber += parser.getCueBuffer()->size();
+      if (callback)
+        callback(path, parser);
+    }
+    catch (const FileMappingError &error) {
+      DILOGE(error.what() + (": " + path.string()));
+      statistics.failedFileNumber++;
+    }
+    catch (const std::bad_alloc &error) {
+      DILOGE(error.what());
+      statistics.failedFileNumber++;
+    }
+  }
+  //Parsed objects keep views into last file, which is already unmapped
+  parser.reset();
+}
+}
@@ -0,0 +1,99 @@
+#include "parser/CueParsingPool.hpp"
+#include "parser/object_parser/CueParser.hpp"
+#include "logger/LoggingUtility.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace webvtt {
+
+CueParsingPool::CueParsingPool(size_t workerNumber,
+                               std::shared_ptr<UniquePtrSyncBuffer<Region>> regions,
+                               std::shared_ptr<UniquePtrSyncBuffer<Cue>> cues,
+                               std::u32string_view defaultLanguage)
+    : regions(std::move(regions)),
+      cues(std::move(cues)),
+      defaultLanguage(defaultLanguage),
+      maxPendingBlocks(std::max<size_t>(workerNumber, 1) * MAX_PENDING_BLOCKS_PER_WORKER) {
+  for (size_t i = 0; i < std::max<size_t>(workerNumber, 1); i++)
+    workers.emplace_back(&CueParsingPool::workerLoop, this);
+}
+
+CueParsingPool::~CueParsingPool() {
+  finish();
+}
+
+std::unique_ptr<Cue> CueParsingPool::parseCueBlock(CueParserBase &cueParser,
+                                                   CueBlock &block,
+                                                   std::u32string_view defaultLanguage) {
+  bool success = cueParser.setNewObjectForParsing(std::make_unique<Cue>(std::move(block.identifier)));
+  if (success) {
+    cueParser.buildObjectFromString(block.timingLine);
+  }
+  cueParser.setTextToObject(std::move(block.text));
+  cueParser.parseTextStyleAndMakeStyleTree(defaultLanguage);
+  return cueParser.collectCurrentObject();
+}
+
+void CueParsingPool::submit(CueBlock block) {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (submittedNumber - publishedNumber >= maxPendingBlocks)
+    publishedCV.wait(lock);
+
+  jobs.push_back({submittedNumber++, std::move(block)});
+  jobsCV.notify_one();
+}
+
+void CueParsingPool::finish() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finishing = true;
+    jobsCV.notify_all();
+  }
+  for (auto &worker : workers)
+    worker.join();
+  workers.clear();
+}
+
+void CueParsingPool::workerLoop() {
+  CueParser cueParser(regions);
+
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (jobs.empty() && !finishing)
+        jobsCV.wait(lock);
+
+      if (jobs.empty())
+        return;
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+
+    std::unique_ptr<Cue> cue;
+    try {
+      cue = parseCueBlock(cueParser, job.block, defaultLanguage);
+    }
+    catch (const std::exception &error) {
+      //Cue is skipped, but following cues must still be published
+      DILOGE(error.what());
+      cueParser.collectCurrentObject();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    publish(job.sequenceNumber, std::move(cue));
+  }
+}
+
+void CueParsingPool::publish(size_t sequenceNumber, std::unique_ptr<Cue> cue) {
+  parsedCues.emplace(sequenceNumber, std::move(cue));
+
+  while (!parsedCues.empty() && parsedCues.begin()->first == publishedNumber) {
+    if (parsedCues.begin()->second)
+      cues->writeOne(std::move(parsedCues.begin()->second));
+    parsedCues.erase(parsedCues.begin());
+    publishedNumber++;
+  }
+  publishedCV.notify_all();
+}
+}
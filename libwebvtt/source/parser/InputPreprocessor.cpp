@@ -0,0 +1,80 @@
+#include "parser/InputPreprocessor.hpp"
+#include "parser/ParserUtil.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace webvtt {
+
+size_t InputPreprocessor::processScalar(std::u32string_view input, char32_t *output) {
+  char32_t *outputBegin = output;
+
+  for (char32_t current : input) {
+    if (current == ParserUtil::LF_C && lastReadCR) {
+      lastReadCR = false;
+      continue;
+    }
+    lastReadCR = current == ParserUtil::CR_C;
+
+    if (lastReadCR)
+      current = ParserUtil::LF_C;
+    else if (current == ParserUtil::NULL_C || current == ParserUtil::FFFF_C)
+      current = ParserUtil::REPLACEMENT_C;
+    *output++ = current;
+  }
+  return output - outputBegin;
+}
+
+#ifdef __SSE2__
+
+size_t InputPreprocessor::process(std::u32string_view input, char32_t *output) {
+  constexpr size_t BLOCK_SIZE = 8;
+  const __m128i cr = _mm_set1_epi32(ParserUtil::CR_C);
+  const __m128i null = _mm_set1_epi32(ParserUtil::NULL_C);
+  const __m128i ffff = _mm_set1_epi32(ParserUtil::FFFF_C);
+
+  size_t position = 0;
+  size_t written = 0;
+
+  while (input.size() - position >= BLOCK_SIZE) {
+    std::u32string_view block = input.substr(position, BLOCK_SIZE);
+
+    //LF after CR from previous block is dropped, so only block without it can be copied as is
+    if (!lastReadCR) {
+      __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data()));
+      __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block.data() + 4));
+      __m128i special = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi32(low, cr), _mm_cmpeq_epi32(high, cr)),
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(low, null), _mm_cmpeq_epi32(high, null)),
+                       _mm_or_si128(_mm_cmpeq_epi32(low, ffff), _mm_cmpeq_epi32(high, ffff))));
+
+      if (_mm_movemask_epi8(special) == 0) {
+        //While nothing is dropped, in place output is already correct
+        if (output + written != block.data()) {
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written), low);
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written + 4), high);
+        }
+        position += BLOCK_SIZE;
+        written += BLOCK_SIZE;
+        continue;
+      }
+    }
+    written += processScalar(block, output + written);
+    position += BLOCK_SIZE;
+  }
+  return written + processScalar(input.substr(position), output + written);
+}
+
+#else
+
+size_t InputPreprocessor::process(std::u32string_view input, char32_t *output) {
+  return processScalar(input, output);
+}
+
+#endif
+
+void InputPreprocessor::reset() {
+  lastReadCR = false;
+}
+}
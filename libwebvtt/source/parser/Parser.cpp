@@ -16,7 +16,7 @@
 
 namespace webvtt {
 
-std::shared_ptr<UniquePtrSyncBuffer<Cue>> Parser::getCueBuffer() {
+std::shared_ptr<CueSyncBuffer> Parser::getCueBuffer() {
   return cues;
 }
 std::shared_ptr<UniquePtrSyncBuffer<Region>> Parser::getRegionBuffer() {
@@ -26,11 +26,11 @@ std::shared_ptr<UniquePtrSyncBuffer<StyleSheet>> Parser::getStyleSheetBuffer() {
   return styleSheets;
 }
 
-Parser::Parser(std::shared_ptr<StringBuffer<char32_t>> inputStream) : inputStream(std::move(
-    inputStream)) {
-  preprocessedStream = std::make_unique<StringSyncBuffer<char32_t >>();
+Parser::Parser(std::shared_ptr<StringBuffer<char32_t>> inputStream, StringBufferType preprocessedBufferType)
+    : inputStream(std::move(inputStream)) {
+  preprocessedStream = makeStringBuffer<char32_t>(preprocessedBufferType);
 
-  cues = std::make_shared<UniquePtrSyncBuffer<Cue >>();
+  cues = std::make_shared<CueSyncBuffer>();
   regions = std::make_shared<UniquePtrSyncBuffer<Region >>();
   styleSheets = std::make_shared<UniquePtrSyncBuffer<StyleSheet >>();
 
@@ -40,6 +40,9 @@ Parser::Parser(std::shared_ptr<StringBuffer<char32_t>> inputStream) : inputStrea
 
 };
 
+Parser::Parser() : Parser(nullptr) {
+}
+
 Parser::~Parser() {
   if (not parsingThread)
     return;
@@ -48,55 +51,24 @@ Parser::~Parser() {
   DILOGI("end of parsing");
 };
 
-void Parser::cleanDecodedData(std::u32string &input) {
-  if (input.empty())
-    return;
-
-  uint32_t firstC = input.front();
-  if (lastReadCR && firstC == ParserUtil::LF_C) {
-    input.erase(input.begin());
-    lastReadCR = false;
-  }
-  if (input.back() == ParserUtil::CR_C) {
-    lastReadCR = true;
-  }
-
-  for (auto current = input.begin(); current != input.end();) {
-    uint32_t current_c = *current;
-    bool haveNext = std::next(current) != input.end();
-    uint32_t next_c = haveNext ? *current : 0;
-
-    if (current_c == ParserUtil::NULL_C || current_c == ParserUtil::FFFF_C) {
-      *current = ParserUtil::REPLACEMENT_C;
-    }
-
-    if (current_c == ParserUtil::CR_C && haveNext && next_c == ParserUtil::LF_C) {
-      current = input.erase(current);
-    } else {
-      std::advance(current, 1);
-    }
-
-    if (current_c == ParserUtil::CR_C) {
-      *current = ParserUtil::LF_C;
-    }
-
-  }
-}
-
 void Parser::preProcessDecodedStreamLoop() {
-  std::string buffer;
   std::u32string decodedData;
   try {
     while (true) {
-      decodedData = inputStream->readMultiple(DEFAULT_READ_NUMBER);
+      decodedData.resize(DEFAULT_READ_NUMBER);
+      size_t readNumber = inputStream->readChunk(decodedData);
 
-      if (decodedData.length() == 0) {
+      if (readNumber == 0) {
         break;
       }
-      cleanDecodedData(decodedData);
+      decodedData.resize(preprocessor.process(std::u32string_view(decodedData.data(), readNumber),
+                                              decodedData.data()));
 
-      preprocessedStream->writeMultiple(decodedData);
-      if (preprocessedStream->isInputEnded()) break;
+      if (!preprocessedStream->writeChunk(decodedData)) {
+        //Parsing stopped, decoder must not stay blocked on full buffer
+        inputStream->setInputEnded();
+        break;
+      }
     };
     preprocessedStream->setInputEnded();
     inputStream->clearBufferUntilReadPosition();
@@ -114,12 +86,14 @@ bool Parser::collectBlock(bool inHeader) {
   auto previousPosition = preprocessedStream->getReadPosition();
   std::u32string line;
   std::u32string buffer;
+  CueParsingPool::CueBlock cueBlock;
 
   bool seenEOF = false, seenArrow = false;
   bool isNewCue = false, isNewRegion = false, isNewStyleSheet = false;
 
   while (true) {
-    line = preprocessedStream->readUntilSpecificData(ParserUtil::LF_C);
+    line.clear();
+    preprocessedStream->readUntilSpecificData(line, ParserUtil::LF_C);
 
     lineCount++;
 
@@ -142,17 +116,17 @@ bool Parser::collectBlock(bool inHeader) {
         DILOGI("FOUND CUE");
         isNewCue = true;
 
-        bool success = cueParser->setNewObjectForParsing(std::make_unique<Cue>(buffer));
-        if (success) {
-          cueParser->buildObjectFromString(line);
-        }
+        cueBlock.identifier = buffer;
+        cueBlock.timingLine = line;
 
         buffer.clear();
         if (!seenCue) seenFirstCue = true;
         seenCue = true;
 
       } else {
-        preprocessedStream->setReadPosition(previousPosition);
+        //Line starts next block, so it is read again by next call
+        if (!preprocessedStream->setReadPosition(previousPosition))
+          DILOGE("Read position can't be set back, line with timing is lost");
         break;
       }
     } else if (line.length() == 0)
@@ -160,7 +134,7 @@ bool Parser::collectBlock(bool inHeader) {
     else {
       if (!inHeader and lineCount == 2) {
         std::u32string_view temp = buffer;
-        ParserUtil::strip(temp, ParserUtil::isASCIIWhiteSpaceCharacter);
+        ParserUtil::strip(temp, ParserUtil::IS_WHITE_SPACE);
         auto tempStyleSheet = temp.substr(0, STYLE_NAME.length());
         auto tempRegion = temp.substr(0, REGION_NAME.length());
         if (!seenCue && tempStyleSheet == STYLE_NAME) {
@@ -193,9 +167,11 @@ bool Parser::collectBlock(bool inHeader) {
     seenFirstCue = false;
   }
   if (isNewCue) {
-    cueParser->setTextToObject(buffer);
-    cueParser->parseTextStyleAndMakeStyleTree(predefinedLanguage);
-    cues->writeOne(cueParser->collectCurrentObject());
+    cueBlock.text = std::move(buffer);
+    if (cueParsingPool)
+      cueParsingPool->submit(std::move(cueBlock));
+    else
+      cues->writeOne(CueParsingPool::parseCueBlock(*cueParser, cueBlock, predefinedLanguage));
     return true;
   }
   if (isNewStyleSheet) {
@@ -215,14 +191,225 @@ bool Parser::collectBlock(bool inHeader) {
 }
 
 bool Parser::startParsing() {
-  if (parsingStarted)
+  if (parsingStarted || !inputStream)
     return false;
   parsingStarted = true;
+  if (cueParsingThreadNumber > 1)
+    cueParsingPool = std::make_unique<CueParsingPool>(cueParsingThreadNumber, regions, cues, predefinedLanguage);
   preProcessingThread = std::make_unique<std::thread>(&Parser::preProcessDecodedStreamLoop, this);
   parsingThread = std::make_unique<std::thread>(&Parser::parsingLoop, this);
   return true;
 }
 
+bool Parser::parseAll(std::u8string_view input) {
+  if (parsingStarted)
+    return false;
+  parsingStarted = true;
+
+  //Same as stream decoder, data after first invalid utf8 sequence is not used
+  parsingLoopUTF8(input.substr(0, ParserUtil::find_invalid(input)));
+  return true;
+}
+
+bool Parser::reset() {
+  if (preProcessingThread || parsingThread)
+    return false;
+
+  cues->clearBuffer();
+  regions->clearBuffer();
+  styleSheets->clearBuffer();
+  seenCue = false;
+  seenFirstCue = false;
+  parsingStarted = false;
+  return true;
+}
+
+std::pair<std::u8string_view, bool> Parser::readLine(std::u8string_view input, size_t &position) {
+  size_t lineEnd = input.find_first_of(LINE_END_CHARACTERS, position);
+  if (lineEnd == std::u8string_view::npos) {
+    auto line = input.substr(position);
+    position = input.length();
+    return {line, false};
+  }
+
+  auto line = input.substr(position, lineEnd - position);
+  position = lineEnd + 1;
+  if (input[lineEnd] == ParserUtil::CR_C && position < input.length() && input[position] == ParserUtil::LF_C)
+    position++;
+  return {line, true};
+}
+
+void Parser::skipLineEnds(std::u8string_view input, size_t &position) {
+  position = std::min(input.find_first_not_of(LINE_END_CHARACTERS, position), input.length());
+}
+
+void Parser::parsingLoopUTF8(std::u8string_view input) {
+  try {
+    size_t position = 0;
+
+    //Read webvtt at the beginning of file
+    if (input.substr(0, EXTENSION_NAME_LENGTH) != EXTENSION_NAME_UTF8) {
+      DILOGE("File need to start with WEBVTT");
+      throw FileFormatError();
+    }
+    position = EXTENSION_NAME_LENGTH;
+
+    if (position == input.length()) {
+      DILOGE("Need additional character after WEBVTT");
+      throw FileFormatError();
+    }
+
+    char8_t readOne = input[position];
+    if (readOne != ParserUtil::SPACE_C && readOne != ParserUtil::LF_C && readOne != ParserUtil::CR_C
+        && readOne != ParserUtil::TAB_C) {
+      DILOGE("Need additional character after WEBVTT(Space, line feed or tab");
+      throw FileFormatError();
+    }
+    //Line end after WEBVTT is read as one character, rest of the line after it is skipped
+    if (readOne == ParserUtil::SPACE_C || readOne == ParserUtil::TAB_C)
+      position++;
+    else
+      readLine(input, position);
+
+    if (!readLine(input, position).second) {
+      DILOGI("Parsing done but no useful data");
+      return;
+    }
+
+    if (position == input.length()) {
+      DILOGI("Parsing done but no useful data");
+      return;
+    }
+
+    if (input[position] != ParserUtil::LF_C && input[position] != ParserUtil::CR_C) {
+      DILOGI("Collecting block in header");
+      collectBlockUTF8(input, position, true);
+    }
+
+    skipLineEnds(input, position);
+
+    while (position < input.length()) {
+      DILOGI("Collecting block not in header");
+      collectBlockUTF8(input, position, false);
+
+      skipLineEnds(input, position);
+    }
+  }
+  catch (const FileFormatError &error) {
+    DILOGE(error.what());
+  }
+  catch (const std::bad_alloc &error) {
+    DILOGE(error.what());
+  }
+  regions->setInputEnded();
+  styleSheets->setInputEnded();
+  cues->setInputEnded();
+}
+
+bool Parser::collectBlockUTF8(std::u8string_view input, size_t &position, bool inHeader) {
+
+  uint32_t lineCount = 0;
+
+  //Collected lines are always continuous part of input
+  size_t bufferStart = position;
+  size_t bufferEnd = position;
+
+  bool seenEOF = false, seenArrow = false;
+  bool isNewCue = false, isNewRegion = false, isNewStyleSheet = false;
+
+  while (true) {
+    size_t lineStart = position;
+    auto[line, haveLineEnd] = readLine(input, position);
+
+    lineCount++;
+    seenEOF = !haveLineEnd;
+
+    if (line.find(TIME_STAMP_SEPARATOR_UTF8) != std::u8string_view::npos) {
+
+      if (!inHeader && (lineCount == 1 || (lineCount == 2 && !seenArrow))) {
+        seenArrow = true;
+
+        DILOGI("FOUND CUE");
+        isNewCue = true;
+
+        auto identifier = input.substr(bufferStart, bufferEnd - bufferStart);
+        auto cue = std::make_unique<Cue>();
+        if (ParserUtil::isPreprocessedUTF8(identifier))
+          cue->setIdentifier(identifier);
+        else
+          cue = std::make_unique<Cue>(ParserUtil::decodePreprocessedUTF8(identifier));
+
+        bool success = cueParser->setNewObjectForParsing(std::move(cue));
+        if (success) {
+          cueParser->buildObjectFromString(ParserUtil::decodePreprocessedUTF8(line));
+        }
+
+        bufferStart = bufferEnd = position;
+        if (!seenCue) seenFirstCue = true;
+        seenCue = true;
+
+      } else {
+        position = lineStart;
+        break;
+      }
+    } else if (line.empty())
+      break;
+    else {
+      if (!inHeader and lineCount == 2) {
+        auto temp = input.substr(bufferStart, bufferEnd - bufferStart);
+        temp.remove_prefix(std::min(temp.find_first_not_of(u8" \t\n\f\r"), temp.length()));
+        if (!seenCue && temp.starts_with(STYLE_NAME_UTF8)) {
+
+          DILOGI("FOUND  STYLESHEET");
+          isNewStyleSheet = true;
+          bufferStart = lineStart;
+        } else if (!seenCue && temp.starts_with(REGION_NAME_UTF8)) {
+
+          DILOGI("FOUND REGION");
+          isNewRegion = true;
+          regionParser->setNewObjectForParsing(std::make_unique<Region>());
+          bufferStart = lineStart;
+        }
+      }
+
+      bufferEnd = lineStart + line.length();
+    }
+    if (seenEOF)
+      break;
+  }
+
+  if (seenFirstCue) {
+    regions->setInputEnded();
+    styleSheets->setInputEnded();
+    seenFirstCue = false;
+  }
+
+  auto buffer = input.substr(bufferStart, bufferEnd - bufferStart);
+  if (isNewCue) {
+    if (ParserUtil::isPreprocessedUTF8(buffer))
+      cueParser->setTextToObject(buffer);
+    else
+      cueParser->setTextToObject(ParserUtil::decodePreprocessedUTF8(buffer));
+    cueParser->parseTextStyleAndMakeStyleTree(predefinedLanguage);
+    cues->writeOne(cueParser->collectCurrentObject());
+    return true;
+  }
+  if (isNewStyleSheet) {
+    styleSheetParser->buildObjectFromString(ParserUtil::decodePreprocessedUTF8(buffer));
+    styleSheets->writeMultiple(styleSheetParser->getStyleSheets());
+
+    return true;
+  }
+
+  if (isNewRegion) {
+    regionParser->buildObjectFromString(ParserUtil::decodePreprocessedUTF8(buffer));
+    regions->writeOne(regionParser->collectCurrentObject());
+    return true;
+  }
+
+  return false;
+}
+
 void Parser::parsingLoop() {
   try {
 
@@ -287,6 +474,12 @@ void Parser::parsingLoop() {
     DILOGE(error.what());
     return;
   }
+  //Unblock preprocessing thread if parsing stopped before all data is read
+  preprocessedStream->setInputEnded();
+  regions->setInputEnded();
+  styleSheets->setInputEnded();
+  if (cueParsingPool)
+    cueParsingPool->finish();
   cues->setInputEnded();
 
 }
@@ -295,4 +488,8 @@ void Parser::setPredefineLanguage(std::u32string_view language) {
   this->predefinedLanguage = language;
 }
 
+void Parser::setCueParsingThreadNumber(size_t threadNumber) {
+  this->cueParsingThreadNumber = threadNumber;
+}
+
 } // namespace webvtt
\ No newline at end of file
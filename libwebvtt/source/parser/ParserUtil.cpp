@@ -8,154 +8,186 @@
 #include "exceptions/parser_util/CollectingCharactersException.hpp"
 #include "exceptions/parser_util/IteratorsNotPointToGivenString.hpp"
 #include "exceptions/parser_util/PercentageFormatNotValid.hpp"
+#include "decoder/UTF8Transcoder.hpp"
+#include "parser/InputPreprocessor.hpp"
+#include "parser/NamedReferenceTrie.hpp"
 #include "utf8.h"
+#include <charconv>
 
 namespace webvtt
 {
 
   std::size_t ParserUtil::find_invalid(std::u8string_view s)
   {
-    std::u8string_view::const_iterator invalid = utf8::find_invalid(s.begin(), s.end());
-    return (invalid == s.end()) ? std::u8string_view::npos : (invalid - s.begin());
+    std::size_t validLength = UTF8Transcoder::validPrefixLength(s);
+    return (validLength == s.size()) ? std::u8string_view::npos : validLength;
   }
 
   std::u32string ParserUtil::utf8to32(std::u8string_view s)
   {
     std::u32string result;
-    utf8::utf8to32(s.begin(), s.end(), std::back_inserter(result));
+    if (UTF8Transcoder::validPrefixLength(s) != s.size())
+    {
+      //utfcpp reports invalid input with exception
+      utf8::utf8to32(s.begin(), s.end(), std::back_inserter(result));
+      return result;
+    }
+    result.resize(s.size());
+    result.resize(UTF8Transcoder::transcodeValid(s, result.data()));
     return result;
   }
 
+  bool ParserUtil::isPreprocessedUTF8(std::u8string_view s)
+  {
+    //U+FFFF is encoded as EF BF BF
+    return s.find_first_of(std::u8string_view(u8"\r\0", 2)) == std::u8string_view::npos &&
+           s.find(u8"\uFFFF") == std::u8string_view::npos;
+  }
+
+  std::u32string ParserUtil::decodePreprocessedUTF8(std::u8string_view s)
+  {
+    std::u32string decoded = ParserUtil::utf8to32(s);
+    InputPreprocessor preprocessor;
+    decoded.resize(preprocessor.process(decoded, decoded.data()));
+    return decoded;
+  }
+
   void ParserUtil::checkIfIteratorPointToInput(std::u32string_view input, const std::u32string_view::iterator &position)
   {
     if (position < input.begin() || position > input.end())
       throw IteratorsNotPointToGivenString();
   }
 
-  bool ParserUtil::isASCIIWhiteSpaceCharacter(uint32_t character)
+  namespace
   {
-    if (character == ParserUtil::SPACE_C ||
-        character == ParserUtil::TAB_C ||
-        character == ParserUtil::LF_C ||
-        character == ParserUtil::FF_C ||
-        character == ParserUtil::CR_C)
+    //Longer numbers are rejected, so they can be converted in buffer on stack
+    constexpr size_t MAX_NUMBER_LENGTH = 64;
+    //Timestamp with more digits of hours does not fit in milliseconds
+    constexpr size_t MAX_HOURS_DIGITS = 12;
+
+    template <typename Number, typename... FormatArguments>
+    ParseResult<Number> convertASCIINumber(std::u32string_view input, FormatArguments... formatArguments)
     {
-      return true;
-    }
+      if (input.empty())
+        return ParseError::EMPTY_INPUT;
+      if (input.length() > MAX_NUMBER_LENGTH)
+        return ParseError::OUT_OF_RANGE;
 
-    return false;
-  }
-  inline bool ParserUtil::isAsciiDecDigit(uint32_t character)
-  {
-    return character >= NUMBER_ZERO_C && character <= NUMBER_NINE_C;
-  }
-  inline bool ParserUtil::isAsciiHexDigit(uint32_t character)
-  {
-    return (character >= NUMBER_ZERO_C && character <= NUMBER_NINE_C) ||
-           (character >= CAPITAL_LETTER_A_C && character <= CAPITAL_LETTER_F_C) ||
-           (character >= SMALL_LETTER_A_C && character <= SMALL_LETTER_F_C);
-  }
-  inline bool ParserUtil::isAsciiAlphaNumeric(uint32_t character)
-  {
-    if (isAsciiDecDigit(character))
-      return true;
-    if ((character >= SMALL_LETTER_A_C && character <= SMALL_LETTER_Z_C) ||
-        (character >= CAPITAL_LETTER_A_C && character <= CAPITAL_LETTER_Z_C))
-      return true;
-    return false;
-  }
+      std::array<char, MAX_NUMBER_LENGTH> narrowed;
+      for (size_t index = 0; index < input.length(); index++)
+      {
+        if (input[index] >= 0x80)
+          return ParseError::INVALID_CHARACTER;
+        narrowed[index] = static_cast<char>(input[index]);
+      }
 
-  std::string
-  ParserUtil::collectCharacters(std::u32string_view input, std::u32string_view::iterator &position,
-                                const std::function<
-                                    bool(uint32_t
-                                             character)> &isLookedCharacter)
-  {
-    checkIfIteratorPointToInput(input, position);
-    std::string collectedCharacters;
-    while (
-        isLookedCharacter(*position) && position != input.end())
+      Number number;
+      const char *end = narrowed.data() + input.length();
+      auto [parsedEnd, error] = std::from_chars(narrowed.data(), end, number, formatArguments...);
+      if (error == std::errc::result_out_of_range)
+        return ParseError::OUT_OF_RANGE;
+      if (error != std::errc())
+        return ParseError::INVALID_FORMAT;
+      if (parsedEnd != end)
+        return ParseError::INVALID_CHARACTER;
+      return number;
+    }
+
+    /**
+     * Collect decimal digits and move position after them
+     * @return number of collected digits
+     */
+    size_t collectDecimalNumber(std::u32string_view input, std::u32string_view::iterator &position, uint64_t &number)
     {
-      utf8::append(*position, collectedCharacters);
-      position++;
+      auto begin = position;
+      number = 0;
+      while (position != input.end() && ParserUtil::isAsciiDecDigit(*position))
+      {
+        number = number * 10 + (*position - U'0');
+        position++;
+      }
+      return position - begin;
     }
-    return collectedCharacters;
   }
 
   double
   ParserUtil::parsePercentage(std::u32string_view input)
   {
-    try
-    {
-      if (input.back() != ParserUtil::PERCENT_C)
-        throw PercentageFormatNotValid();
-      return parseFloatPointingNumber(input.substr(0, input.length() - 1));
-    }
-    catch (const ParsingFloatPointNumber &error)
-    {
-      DILOGE(error.what());
+    auto percentage = tryParsePercentage(input);
+    if (!percentage)
       throw PercentageFormatNotValid();
-    }
+    return *percentage;
   }
 
   double
   ParserUtil::parseFloatPointingNumber(std::u32string_view input)
   {
-    try
-    {
-      std::size_t index = 0;
-      std::string temp = utf8::utf32to8(input);
-      double number = std::stod(temp, &index);
-      if (index < temp.length())
-        throw ParsingFloatPointNumber();
-      return number;
-    }
-    catch (const std::out_of_range &error)
-    {
-      DILOGE(error.what());
+    auto number = tryParseFloatPointingNumber(input);
+    if (!number)
       throw ParsingFloatPointNumber();
-    }
-    catch (const std::invalid_argument &error)
-    {
-      DILOGE(error.what());
-      throw ParsingFloatPointNumber();
-    }
+    return *number;
   }
 
   long
   ParserUtil::parseLongNumber(std::u32string_view input, uint8_t base)
   {
-    std::string temp = utf8::utf32to8(input);
-    return ParserUtil::parseLongNumber(temp, base);
+    auto number = tryParseLongNumber(input, base);
+    if (!number)
+      throw ParsingLongNumberError();
+    return *number;
   }
   long
   ParserUtil::parseLongNumber(std::string_view input, uint8_t base)
   {
-    try
-    {
-      std::size_t index = 0;
-      std::string temp = std::string(input);
-      long number = std::stol(temp, &index, base);
-      if (index < temp.length())
-        throw ParsingLongNumberError();
-      return number;
-    }
-    catch (const std::out_of_range &error)
-    {
-      DILOGE(error.what());
-      throw ParsingLongNumberError();
-    }
-    catch (const std::invalid_argument &error)
-    {
-      DILOGE(error.what());
+    auto number = tryParseLongNumber(input, base);
+    if (!number)
       throw ParsingLongNumberError();
-    }
+    return *number;
+  }
+
+  ParseResult<double>
+  ParserUtil::tryParsePercentage(std::u32string_view input)
+  {
+    if (input.empty())
+      return ParseError::EMPTY_INPUT;
+    if (input.back() != ParserUtil::PERCENT_C)
+      return ParseError::INVALID_FORMAT;
+    return tryParseFloatPointingNumber(input.substr(0, input.length() - 1));
+  }
+
+  ParseResult<double>
+  ParserUtil::tryParseFloatPointingNumber(std::u32string_view input)
+  {
+    return convertASCIINumber<double>(input);
+  }
+
+  ParseResult<long>
+  ParserUtil::tryParseLongNumber(std::u32string_view input, uint8_t base)
+  {
+    return convertASCIINumber<long>(input, static_cast<int>(base));
+  }
+
+  ParseResult<long>
+  ParserUtil::tryParseLongNumber(std::string_view input, uint8_t base)
+  {
+    if (input.empty())
+      return ParseError::EMPTY_INPUT;
+
+    long number;
+    auto [parsedEnd, error] = std::from_chars(input.data(), input.data() + input.length(), number, base);
+    if (error == std::errc::result_out_of_range)
+      return ParseError::OUT_OF_RANGE;
+    if (error != std::errc())
+      return ParseError::INVALID_FORMAT;
+    if (parsedEnd != input.data() + input.length())
+      return ParseError::INVALID_CHARACTER;
+    return number;
   }
 
   void ParserUtil::skipWhiteSpaces(std::u32string_view input, std::u32string_view::iterator &position)
   {
     checkIfIteratorPointToInput(input, position);
-    while (ParserUtil::isASCIIWhiteSpaceCharacter(*position) && position != input.end())
+    while (position != input.end() && ParserUtil::isASCIIWhiteSpaceCharacter(*position))
     {
       std::advance(position, 1);
     }
@@ -230,107 +262,102 @@ namespace webvtt
   std::tuple<double, double>
   ParserUtil::parseCoordinates(std::u32string_view coordinates, uint32_t separator)
   {
-    try
-    {
-      auto splitDataOptional = ParserUtil::splitStringAroundCharacter(coordinates, separator);
-      if (!splitDataOptional.has_value())
-        throw ParsingCoordinatesError();
-
-      auto [xCoordinateString, yCoordinateString] = splitDataOptional.value();
-      if (xCoordinateString.empty() || yCoordinateString.empty())
-        throw ParsingCoordinatesError();
-
-      double xCoord = ParserUtil::parsePercentage(xCoordinateString);
-      double yCoord = ParserUtil::parsePercentage(yCoordinateString);
-
-      return std::make_tuple(xCoord, yCoord);
-    }
-    catch (const PercentageFormatNotValid &error)
-    {
-      DILOGE(error.what());
+    auto parsedCoordinates = tryParseCoordinates(coordinates, separator);
+    if (!parsedCoordinates)
       throw ParsingCoordinatesError();
-    }
+    return *parsedCoordinates;
   }
 
-  double
-  ParserUtil::parseTimeStamp(std::u32string_view input, std::u32string_view::iterator &position)
+  ParseResult<std::tuple<double, double>>
+  ParserUtil::tryParseCoordinates(std::u32string_view coordinates, uint32_t separator)
   {
-    try
-    {
-      checkIfIteratorPointToInput(input, position);
-
-      TimeUnit timeUnit = TimeUnit::MINUTES;
-      uint32_t value1, value2, value3, value4;
-
-      if (position == input.end())
-        throw ParsingTimeStampException();
+    auto splitDataOptional = ParserUtil::splitStringAroundCharacter(coordinates, separator);
+    if (!splitDataOptional.has_value())
+      return ParseError::INVALID_FORMAT;
+
+    auto [xCoordinateString, yCoordinateString] = splitDataOptional.value();
+    if (xCoordinateString.empty() || yCoordinateString.empty())
+      return ParseError::INVALID_FORMAT;
+
+    auto xCoord = ParserUtil::tryParsePercentage(xCoordinateString);
+    if (!xCoord)
+      return xCoord.error();
+    auto yCoord = ParserUtil::tryParsePercentage(yCoordinateString);
+    if (!yCoord)
+      return yCoord.error();
+
+    return std::make_tuple(*xCoord, *yCoord);
+  }
 
-      if (!ParserUtil::isAsciiDecDigit(*position))
-        throw ParsingTimeStampException();
+  TimeStamp
+  ParserUtil::parseTimeStamp(std::u32string_view input, std::u32string_view::iterator &position)
+  {
+    auto time = tryParseTimeStamp(input, position);
+    if (!time)
+      throw ParsingTimeStampException();
+    return *time;
+  }
 
-      std::string collectedTimeString = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiDecDigit);
-      value1 = ParserUtil::parseLongNumber(collectedTimeString, 10);
+  ParseResult<TimeStamp>
+  ParserUtil::tryParseTimeStamp(std::u32string_view input, std::u32string_view::iterator &position)
+  {
+    if (position < input.begin() || position > input.end())
+      return ParseError::INVALID_POSITION;
+    if (position == input.end())
+      return ParseError::EMPTY_INPUT;
+    if (!ParserUtil::isAsciiDecDigit(*position))
+      return ParseError::INVALID_CHARACTER;
 
-      if (collectedTimeString.length() != NUM_OF_DIGITS_FIRST_PART || value1 >= MAX_MINUTES_VALUE)
-      {
-        timeUnit = TimeUnit::HOURS;
-      }
+    TimeUnit timeUnit = TimeUnit::MINUTES;
+    uint64_t value1, value2, value3, value4;
 
-      if (position == input.end() || *position != ParserUtil::COLON_C)
-        throw ParsingTimeStampException();
-      position++;
+    size_t digitNumber = collectDecimalNumber(input, position, value1);
+    if (digitNumber > MAX_HOURS_DIGITS)
+      return ParseError::OUT_OF_RANGE;
 
-      collectedTimeString = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiDecDigit);
-      if (collectedTimeString.length() != NUM_OF_DIGITS_SECOND_PART)
-        throw ParsingTimeStampException();
-      value2 = ParserUtil::parseLongNumber(collectedTimeString, 10);
+    if (digitNumber != NUM_OF_DIGITS_FIRST_PART || value1 >= MAX_MINUTES_VALUE)
+    {
+      timeUnit = TimeUnit::HOURS;
+    }
 
-      //Check if first parsed digit is hours or minutes(does we have three or for parts)
-      if (timeUnit == TimeUnit::HOURS || (position != input.end() && *position == ParserUtil::COLON_C))
-      {
+    if (position == input.end() || *position != ParserUtil::COLON_C)
+      return ParseError::INVALID_FORMAT;
+    position++;
 
-        if (position == input.end() || *position != ParserUtil::COLON_C)
-          throw ParsingTimeStampException();
-        position++;
+    if (collectDecimalNumber(input, position, value2) != NUM_OF_DIGITS_SECOND_PART)
+      return ParseError::INVALID_FORMAT;
 
-        collectedTimeString = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiDecDigit);
-        if (collectedTimeString.length() != NUM_OF_DIGITS_THIRD_PART)
-          throw ParsingTimeStampException();
-        value3 = ParserUtil::parseLongNumber(collectedTimeString, 10);
-      }
-      else
-      {
-        value3 = value2;
-        value2 = value1;
-        value1 = 0;
-      }
+    //Check if first parsed digit is hours or minutes(does we have three or for parts)
+    if (timeUnit == TimeUnit::HOURS || (position != input.end() && *position == ParserUtil::COLON_C))
+    {
 
-      if (position == input.end() || *position != ParserUtil::FULL_STOP)
-        throw ParsingTimeStampException();
+      if (position == input.end() || *position != ParserUtil::COLON_C)
+        return ParseError::INVALID_FORMAT;
       position++;
 
-      //Collect milliseconds
-      collectedTimeString = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiDecDigit);
-      if (collectedTimeString.length() != NUM_OF_DIGITS_FORTH_PART)
-        throw ParsingTimeStampException();
-      value4 = ParserUtil::parseLongNumber(collectedTimeString, 10);
-
-      if (value2 >= MAX_MINUTES_VALUE || value3 >= MAX_SECONDS_VALUE)
-        throw ParsingTimeStampException();
-
-      return value1 * MAX_MINUTES_VALUE * MAX_SECONDS_VALUE + value2 * MAX_SECONDS_VALUE + value3 +
-             ((double)value4) / MAX_MILLISECONDS_VALUE;
+      if (collectDecimalNumber(input, position, value3) != NUM_OF_DIGITS_THIRD_PART)
+        return ParseError::INVALID_FORMAT;
     }
-    catch (const ParsingLongNumberError &error)
-    {
-      DILOGE(error.what());
-      throw ParsingTimeStampException();
-    }
-    catch (const IteratorsNotPointToGivenString &error)
+    else
     {
-      DILOGE(error.what());
-      throw ParsingTimeStampException();
+      value3 = value2;
+      value2 = value1;
+      value1 = 0;
     }
+
+    if (position == input.end() || *position != ParserUtil::FULL_STOP)
+      return ParseError::INVALID_FORMAT;
+    position++;
+
+    //Collect milliseconds
+    if (collectDecimalNumber(input, position, value4) != NUM_OF_DIGITS_FORTH_PART)
+      return ParseError::INVALID_FORMAT;
+
+    if (value2 >= MAX_MINUTES_VALUE || value3 >= MAX_SECONDS_VALUE)
+      return ParseError::OUT_OF_RANGE;
+
+    return TimeStamp(((value1 * MAX_MINUTES_VALUE + value2) * MAX_SECONDS_VALUE + value3) * MAX_MILLISECONDS_VALUE +
+                     value4);
   }
 
   std::u32string
@@ -355,12 +382,12 @@ namespace webvtt
     if (*position == ParserUtil::LATIN_CAPITAL_LETTER_X || *position == ParserUtil::LATIN_SMALL_LETTER_X)
     {
       position++; //Skip X or x
-      result = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiHexDigit);
+      result = ParserUtil::collectCharacters(input, position, ParserUtil::IS_HEX_DIGIT);
       base = 16;
     }
     else
     {
-      result = ParserUtil::collectCharacters(input, position, ParserUtil::isAsciiDecDigit);
+      result = ParserUtil::collectCharacters(input, position, ParserUtil::IS_DEC_DIGIT);
       base = 10;
     }
 
@@ -420,90 +447,44 @@ namespace webvtt
   ParserUtil::parseHTMLNamedReference(std::u32string_view input, std::u32string_view::iterator &currentPosition,
                                       bool isInAttribute, bool &parsingError)
   {
-    try
-    {
-      checkIfIteratorPointToInput(input, currentPosition);
-
-      auto position = currentPosition;
-
-      if (position == input.end())
-        return U"";
-
-      std::string forMatching;
-      std::map<std::string, std::u32string>::const_iterator found;
-
-      uint32_t range = 1;
-
-      while (range <= ParserUtil::MAX_NAMED_HTML_REF_LENGTH &&
-             position != input.end() &&
-             *position != ParserUtil::SEMI_COLON)
-      {
-        utf8::append(*position, forMatching);
-
-        auto iter = namedHTMLREferences.find(forMatching);
-        if (iter != namedHTMLREferences.end())
-          found = iter;
-        position++;
-        range++;
-      }
-      if (*position == ParserUtil::SEMI_COLON)
-      {
-        utf8::append(*position, forMatching);
-        auto iter = namedHTMLREferences.find(forMatching);
-        if (iter != namedHTMLREferences.end())
-          found = iter;
-      }
-
-      if (found == namedHTMLREferences.end())
-      {
-        bool potentialError = true;
-        std::string_view check = forMatching;
-        for (char one : check.substr(0, forMatching.length() - 1))
-        {
-          if (!ParserUtil::isAsciiAlphaNumeric(one))
-            potentialError = false;
-        }
-        if (check.back() != ParserUtil::SEMI_COLON)
-        {
-          potentialError = false;
-        }
-        if (potentialError)
-        {
-          parsingError = true;
-          DILOGE("Parsing HTML named reference, can not found voiceName in table of character references");
-        }
-        return U"";
-      }
+    checkIfIteratorPointToInput(input, currentPosition);
 
-      if (isInAttribute && forMatching.back() != ParserUtil::SEMI_COLON && position != input.end())
-      {
-        if (*position == ParserUtil::EQUAL_C || ParserUtil::isAsciiAlphaNumeric(*position))
-        {
-          parsingError = true;
-          return U"";
-        }
-      }
+    std::u32string_view name(currentPosition, input.end());
+    NamedReferenceTrie::Match match = NamedReferenceTrie::longestMatch(name);
 
-      if (isInAttribute && position != input.end() && *position == '=')
+    if (match.length == 0)
+    {
+      auto nameEnd = std::find_if_not(name.begin(), name.end(), [](char32_t character) {
+        return ParserUtil::isAsciiAlphaNumeric(character);
+      });
+      if (nameEnd != name.begin() && nameEnd != name.end() && *nameEnd == ParserUtil::SEMI_COLON)
       {
         parsingError = true;
-        DILOGE("Parsing HTML named reference, some legacy user agents will misinterpret the markup in those cases");
+        DILOGE("Parsing HTML named reference, can not found name in table of character references");
       }
+      return U"";
+    }
 
-      if (forMatching.back() != ';')
+    bool endsWithSemiColon = name[match.length - 1] == ParserUtil::SEMI_COLON;
+    auto position = currentPosition + match.length;
+
+    if (isInAttribute && !endsWithSemiColon && position != input.end())
+    {
+      if (*position == ParserUtil::EQUAL_C || ParserUtil::isAsciiAlphaNumeric(*position))
       {
         parsingError = true;
-        DILOGE("Parsing HTML named reference, need to end with semi colon");
+        return U"";
       }
-      currentPosition = position;
-      return found->second;
     }
-    catch (const std::out_of_range &error)
+
+    if (!endsWithSemiColon)
     {
-      DILOGE(error.what());
       parsingError = true;
-      return U"";
+      DILOGE("Parsing HTML named reference, need to end with semi colon");
     }
+    //Caller moves past last character of reference
+    currentPosition = position - 1;
+    return std::u32string(match.value);
   }
 
   std::u32string
@@ -541,7 +522,8 @@ namespace webvtt
         break;
       default:
         result = ParserUtil::parseHTMLNamedReference(input, position, isInAttribute, parsingError);
-        currentPosition = position;
+        if (!result.empty())
+          currentPosition = position;
         break;
       }
       return result;
@@ -658,88 +640,10 @@ namespace webvtt
     return false;
   }
 
-  std::u32string_view
-  ParserUtil::parseWhileCondition(std::u32string_view input, std::u32string_view::iterator &position,
-                                  const std::function<bool(uint32_t)> &condition,
-                                  uint8_t maxNumberOfCharacters)
-  {
-
-    checkIfIteratorPointToInput(input, position);
-
-    long startPosition = position - input.begin();
-    size_t length = 0;
-    uint8_t iteration = 0;
-    while (position != input.end() && condition(*position) &&
-           iteration < maxNumberOfCharacters)
-    {
-      length++;
-      iteration++;
-      position++;
-    }
-    return input.substr(startPosition, length);
-  }
-
   void ParserUtil::clearAndSetCharacter(std::u32string &input, uint32_t characterToSet)
   {
     input.clear();
     input.push_back(characterToSet);
   }
 
-  void ParserUtil::strip(std::u32string_view &input, const std::function<bool(uint32_t)> &isAskedCharacter)
-  {
-    if (input.empty())
-      return;
-
-    auto position = input.begin();
-    while (position != input.end() && isAskedCharacter(*position))
-      position++;
-    auto newBegin = position;
-
-    if (newBegin == input.end())
-    {
-      input = ParserUtil::EMPTY_STRING_VIEW;
-      return;
-    }
-
-    position = input.end();
-    position--;
-    while (isAskedCharacter(*position))
-      position--;
-    auto newEnd = position;
-
-    input = input.substr(newBegin - input.begin(), newEnd - newBegin + 1);
-  }
-
-  void ParserUtil::strip(std::u32string &input, const std::function<bool(uint32_t)> &isAskedCharacter)
-  {
-    std::u32string_view temp = input;
-    strip(temp, isAskedCharacter);
-    input = std::u32string(temp);
-  }
-
-  void ParserUtil::replaceAllSequenceOfCharactersWithGivenCharacter(std::u32string &input,
-                                                                    const std::function<bool(uint32_t)> &isAskedCharacter,
-                                                                    uint32_t character)
-  {
-    auto position = input.begin();
-    while (position != input.end())
-    {
-      while (position != input.end() && !isAskedCharacter(*position))
-        position++;
-      if (position == input.end())
-        return;
-
-      auto startPosition = position;
-
-      while (position != input.end() && isAskedCharacter(*position))
-        position++;
-
-      if (startPosition == position - 1)
-        continue;
-
-      position = input.erase(startPosition, position - 1);
-      *position = character;
-    }
-  }
-
 };
@@ -1,13 +1,14 @@
 #include "parser/cue_style_parser/ruleStates/StyleRulesState.hpp"
 #include "parser/object_parser/StyleSheetParser.hpp"
 #include "parser/ParserUtil.hpp"
+#include "parser/CSSProperties.hpp"
 #include "logger/LoggingUtility.hpp"
 #include <tuple>
 
 namespace webvtt {
 
 void StyleRulesState::processRule(StyleSheetParser &parser, std::u32string_view rule) {
-  ParserUtil::strip(rule, ParserUtil::isASCIIWhiteSpaceCharacter);
+  ParserUtil::strip(rule, ParserUtil::IS_WHITE_SPACE);
 
   if (rule.empty())
     return;
@@ -16,10 +17,14 @@ void StyleRulesState::processRule(StyleSheetParser &parser, std::u32string_view
   if (result.has_value()) {
     auto name = std::get<0>(result.value());
     auto value = std::get<1>(result.value());
-    ParserUtil::strip(name, ParserUtil::isASCIIWhiteSpaceCharacter);
-    ParserUtil::strip(value, ParserUtil::isASCIIWhiteSpaceCharacter);
-
-    parser.addCSSRule(utf8::utf32to8(name), utf8::utf32to8(value));
+    ParserUtil::strip(name, ParserUtil::IS_WHITE_SPACE);
+    ParserUtil::strip(value, ParserUtil::IS_WHITE_SPACE);
+
+    auto property = CSSProperties::find(name);
+    if (property.has_value())
+      parser.addCSSRule(*property, utf8::utf32to8(value));
+    else
+      DILOGI("Not supported CSS property: " + utf8::utf32to8(name));
     parser.getBuffer().clear();
   } else {
     parser.setState(StyleState::StyleStateType::ERROR);
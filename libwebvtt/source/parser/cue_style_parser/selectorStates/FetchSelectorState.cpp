@@ -1,7 +1,6 @@
 #include "parser/cue_style_parser/selectorStates/FetchSelectorState.hpp"
 #include "parser/object_parser/StyleSheetParser.hpp"
 #include "parser/ParserUtil.hpp"
-#include "exceptions/NotImplementedError.hpp"
 
 namespace webvtt {
 
@@ -65,6 +64,7 @@ void FetchSelectorState::foundCombinatorCharacter(StyleSheetParser &parser,
                                                   std::unique_ptr<StyleSelector> &&styleSelector) {
   parser.addSelectorToCurrentCompoundSelectorList(std::move(styleSelector));
   parser.addSelectorToCurrentCombinatorSelectorList();
+  parser.setState(StyleState::StyleStateType::COMBINATION);
 }
 
 void FetchSelectorState::foundCompoundCharacter(StyleSheetParser &parser,
@@ -97,25 +97,26 @@ void FetchSelectorState::foundDefaultBehaviour(StyleSheetParser &parser, uint32_
 };
 
 bool FetchSelectorState::additionalBehaviour(StyleSheetParser &parser, uint32_t character) {
+  auto &escapedSequence = parser.getEscapedSequence();
 
-  if (escapedSequence) {
+  if (escapedSequence.inSequence) {
 
     //Escape one css special character, need to be immediately after backslash.
-    if (counterOfEscapedSequence == 0) {
+    if (escapedSequence.characterCounter == 0) {
       if (!ParserUtil::isAsciiHexDigit(character) &&
           ParserUtil::CR_C != character && ParserUtil::LF_C != character && ParserUtil::FF_C != character) {
-        escapedSequence = false;
+        escapedSequence.inSequence = false;
         parser.getBuffer().push_back(character);
         return true;
       }
     }
 
     //Multiple character, all need to be hexadecimal
-    if (counterOfEscapedSequence >= ParserUtil::MAX_NUMBER_OF_CSS_ESCAPED_CHARACTER ||
+    if (escapedSequence.characterCounter >= ParserUtil::MAX_NUMBER_OF_CSS_ESCAPED_CHARACTER ||
         !ParserUtil::isAsciiHexDigit(character) || ParserUtil::isASCIIWhiteSpaceCharacter(character)
         ) {
-      escapedSequence = false;
-      counterOfEscapedSequence = 0;
+      escapedSequence.inSequence = false;
+      escapedSequence.characterCounter = 0;
 
       //First space after escaped sequence need to be skipped
       if (ParserUtil::isASCIIWhiteSpaceCharacter(character)) {
@@ -124,15 +125,15 @@ bool FetchSelectorState::additionalBehaviour(StyleSheetParser &parser, uint32_t
       } else
         return false;
     } else {
-      counterOfEscapedSequence++;
+      escapedSequence.characterCounter++;
       parser.getBuffer().push_back(character);
       return true;
     }
   } else {
 
     if (ParserUtil::BACK_SLASH_C == character) {
-      escapedSequence = true;
-      counterOfEscapedSequence = 0;
+      escapedSequence.inSequence = true;
+      escapedSequence.characterCounter = 0;
       parser.getBuffer().push_back(character);
       return true;
     } else {
@@ -141,19 +142,22 @@ bool FetchSelectorState::additionalBehaviour(StyleSheetParser &parser, uint32_t
   }
 }
 
+bool FetchSelectorState::isBufferAccepted(StyleSheetParser &parser) {
+  preprocessBuffer(parser);
+  return parser.getState() != StyleState::getInstance(StyleState::StyleStateType::ERROR);
+}
+
 void FetchSelectorState::foundCombinatorCharacter(StyleSheetParser &parser,
                                                   StyleSelector::StyleSelectorCombinator styleCombinator) {
-  DILOGI("COMBINATOR SELECTORS MATCHING NOT IMPLEMENTED");
-  throw NotImplementedError();
-  preprocessBuffer(parser);
+  if (!isBufferAccepted(parser))
+    return;
   foundCombinatorCharacter(parser, makeNewStyleSelector(parser));
   parser.setCombinatorToMostRecentSelector(styleCombinator);
 };
 
 void FetchSelectorState::foundCompoundCharacter(StyleSheetParser &parser) {
-  DILOGI("COMPOUND SELECTORS MATCHING NOT IMPLEMENTED");
-  throw NotImplementedError();
-  preprocessBuffer(parser);
+  if (!isBufferAccepted(parser))
+    return;
   foundCompoundCharacter(parser, makeNewStyleSelector(parser));
 };
 
@@ -165,9 +169,8 @@ void FetchSelectorState::foundRightParenthesis(StyleSheetParser &parser) {
 };
 
 void FetchSelectorState::foundCommaCharacter(StyleSheetParser &parser) {
-  DILOGI("MULTIPLE SELECTORS MATCHING NOT IMPLEMENTED");
-  throw NotImplementedError();
-  preprocessBuffer(parser);
+  if (!isBufferAccepted(parser))
+    return;
   foundCommaCharacter(parser, makeNewStyleSelector(parser));
   parser.setCombinatorToMostRecentSelector(StyleSelector::StyleSelectorCombinator::MULTIPLE);
 }
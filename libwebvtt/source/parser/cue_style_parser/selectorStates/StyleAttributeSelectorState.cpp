@@ -46,8 +46,9 @@ StyleAttributeSelectorState::makeNewAttributeSelector(StyleSheetParser &parser,
     attributeName = std::get<0>(split.value());
     attributeValue = std::get<1>(split.value());
 
-    ParserUtil::strip(attributeName, ParserUtil::isASCIIWhiteSpaceCharacter);
-    ParserUtil::strip(attributeValue, ParserUtil::isASCIIWhiteSpaceCharacter);
+    ParserUtil::strip(attributeName, ParserUtil::IS_WHITE_SPACE);
+    ParserUtil::strip(attributeValue, ParserUtil::IS_WHITE_SPACE);
+    stripQuotes(attributeValue);
 
     if (attributeName.empty())
       parser.setState(StyleState::StyleStateType::ERROR);
@@ -89,6 +90,37 @@ StyleAttributeSelectorState::checkIfValueGivenAsString(StyleSheetParser &parser)
 
 }
 
+bool StyleAttributeSelectorState::isAttributeClosed(std::u32string_view attribute) {
+  uint32_t quote = 0;
+  for (auto character : attribute) {
+    if (quote != 0) {
+      if (character == quote)
+        quote = 0;
+    } else if (character == ParserUtil::DOUBLE_QUOTE || character == ParserUtil::SINGLE_QUOTE) {
+      quote = character;
+    }
+  }
+  return quote == 0 && !attribute.empty() && attribute.back() == ParserUtil::RIGHT_SQUARE_BRACKET_C;
+}
+
+void StyleAttributeSelectorState::stripQuotes(std::u32string_view &value) {
+  if (value.size() < 2 || value.front() != value.back())
+    return;
+  if (value.front() == ParserUtil::DOUBLE_QUOTE || value.front() == ParserUtil::SINGLE_QUOTE) {
+    value.remove_prefix(1);
+    value.remove_suffix(1);
+  }
+}
+
+bool StyleAttributeSelectorState::additionalBehaviour(StyleSheetParser &parser, uint32_t character) {
+  if (isAttributeClosed(parser.getAdditionalBuffer()))
+    return FetchSelectorState::additionalBehaviour(parser, character);
+  if (character == StyleSheetParser::STOP_PARSER)
+    return false;
+  parser.getAdditionalBuffer().push_back(character);
+  return true;
+}
+
 void
 StyleAttributeSelectorState::preprocessBuffer(StyleSheetParser &parser) {
   if (parser.getAdditionalBuffer().size() < 2) {
@@ -102,7 +134,7 @@ StyleAttributeSelectorState::preprocessBuffer(StyleSheetParser &parser) {
 
   parser.getAdditionalBuffer().pop_back();
 
-  ParserUtil::strip(parser.getAdditionalBuffer(), ParserUtil::isASCIIWhiteSpaceCharacter);
+  ParserUtil::strip(parser.getAdditionalBuffer(), ParserUtil::IS_WHITE_SPACE);
 
 }
 
@@ -114,7 +146,10 @@ StyleAttributeSelectorState::foundDefaultBehaviour(StyleSheetParser &parser, uin
 std::unique_ptr<StyleSelector>
 StyleAttributeSelectorState::makeNewStyleSelector(StyleSheetParser &parser) {
 
-  return makeNewAttributeSelector(parser, parser.getBuffer(), parser.getAdditionalBuffer());
+  auto help = makeNewAttributeSelector(parser, parser.getBuffer(), parser.getAdditionalBuffer());
+  parser.getBuffer().clear();
+  parser.getAdditionalBuffer().clear();
+  return help;
 }
 
 } // namespace webvtt
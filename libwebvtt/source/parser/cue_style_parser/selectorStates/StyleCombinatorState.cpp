@@ -0,0 +1,54 @@
+#include "parser/cue_style_parser/selectorStates/StyleCombinatorState.hpp"
+#include "parser/object_parser/StyleSheetParser.hpp"
+#include "parser/ParserUtil.hpp"
+
+namespace webvtt {
+
+void StyleCombinatorState::processState(StyleSheetParser &parser) {
+  uint32_t character = getNextCharacter(parser);
+
+  if (ParserUtil::isASCIIWhiteSpaceCharacter(character))
+    return;
+
+  StyleSelector::StyleSelectorCombinator combinator = StyleSelector::StyleSelectorCombinator::UNDEFINED;
+
+  switch (character) {
+    case ParserUtil::SOLIDUS_C:parser.saveStateBeforeComment();
+      parser.setState(StyleState::StyleStateType::START_COMMENT_STATE);
+      return;
+    case ParserUtil::PLUS_SIGN_C:combinator = StyleSelector::StyleSelectorCombinator::NEXT_SIBLING;
+      break;
+    case ParserUtil::HYPHEN_GREATER:combinator = StyleSelector::StyleSelectorCombinator::CHILD;
+      break;
+    case ParserUtil::TILDE_C:combinator = StyleSelector::StyleSelectorCombinator::SUBSEQUENT_SIBLING;
+      break;
+
+    case ParserUtil::COMMA_C:parser.setCombinatorToMostRecentSelector(StyleSelector::StyleSelectorCombinator::MULTIPLE);
+      parser.setState(StyleState::StyleStateType::START_SELECTOR);
+      return;
+
+    case ParserUtil::RIGHT_PARENTHESIS_C:parser.setCombinatorToMostRecentSelector(StyleSelector::StyleSelectorCombinator::NONE);
+      parser.addSelectorToCurrentObject();
+      parser.addCurrentObjectToStyleSheetList();
+      parser.setState(StyleState::StyleStateType::END_SELECTOR);
+      parser.getCurrentPosition()--;
+      return;
+
+    case StyleSheetParser::STOP_PARSER:parser.setState(StyleState::StyleStateType::ERROR);
+      return;
+
+    default:parser.setState(StyleState::StyleStateType::START_SELECTOR);
+      parser.getCurrentPosition()--;
+      return;
+  }
+
+  //Only one explicit combinator can stand between two selectors
+  if (parser.getCombinatorOfMostRecentSelector() != StyleSelector::StyleSelectorCombinator::DESCENDANT) {
+    DILOGE("Two combinators found between selectors");
+    parser.setState(StyleState::StyleStateType::ERROR);
+    return;
+  }
+  parser.setCombinatorToMostRecentSelector(combinator);
+}
+
+} // namespace webvtt
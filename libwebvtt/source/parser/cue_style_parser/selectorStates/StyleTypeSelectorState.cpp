@@ -31,7 +31,7 @@ StyleTypeSelectorState::preprocessBuffer(StyleSheetParser &parser) {
   if (parser.getBuffer().empty())
     parser.setState(StyleState::StyleStateType::ERROR);
 
-  if (!checkIfTypeAllowed(std::u32string_view()))
+  if (!checkIfTypeAllowed(parser.getBuffer()))
     parser.setState(StyleState::StyleStateType::ERROR);
 }
 
@@ -21,7 +21,7 @@ StyleSheet::StyleSheetType StyleStartState::decideStyleSheetType(std::u32string_
 }
 
 void StyleStartState::makeNewStyleSheetForParsing(StyleSheetParser &parser) {
-  ParserUtil::strip(parser.getBuffer(), ParserUtil::isASCIIWhiteSpaceCharacter);
+  ParserUtil::strip(parser.getBuffer(), ParserUtil::IS_WHITE_SPACE);
   auto type = decideStyleSheetType(parser.getBuffer());
   auto styleSheet = StyleSheet::makeNewStyleSheet(type);
   if (styleSheet == nullptr) {
@@ -54,6 +54,8 @@ void StyleStartState::processState(StyleSheetParser &parser) {
         makeNewStyleSheetForParsing(parser);
         parser.addSelectorToCurrentCompoundSelectorList(std::make_unique<MatchAllSelector>());
         parser.addSelectorToCurrentCombinatorSelectorList();
+        parser.addSelectorToCurrentObject();
+        parser.addCurrentObjectToStyleSheetList();
         parser.getCurrentPosition()--;
         parser.setState(StyleState::StyleStateType::BEFORE_RULE_STATE);
       } catch (const StyleSheetFormatError &error) {
@@ -62,7 +64,7 @@ void StyleStartState::processState(StyleSheetParser &parser) {
       }
       break;
     }
-    case StyleSheetParser::STOP_PARSER:ParserUtil::strip(parser.getBuffer(), ParserUtil::isASCIIWhiteSpaceCharacter);
+    case StyleSheetParser::STOP_PARSER:ParserUtil::strip(parser.getBuffer(), ParserUtil::IS_WHITE_SPACE);
       if (!parser.getBuffer().empty())
         parser.setState(StyleState::StyleStateType::ERROR);
       else
@@ -4,6 +4,7 @@
 #include "parser/cue_style_parser/states/StyleStartState.hpp"
 #include "parser/cue_style_parser/selectorStates/StyleAttributeSelectorState.hpp"
 #include "parser/cue_style_parser/selectorStates/StyleClassSelectorState.hpp"
+#include "parser/cue_style_parser/selectorStates/StyleCombinatorState.hpp"
 #include "parser/cue_style_parser/selectorStates/StyleEndSelectorState.hpp"
 #include "parser/cue_style_parser/selectorStates/StyleIdSelectorState.hpp"
 #include "parser/cue_style_parser/selectorStates/StylePseudoClassSelectorState.hpp"
@@ -23,7 +24,59 @@
 
 namespace webvtt {
 
-std::map<StyleState::StyleStateType, std::unique_ptr<StyleState>> StyleState::statesInstance;
+namespace {
+//States have no data, so they are constant-initialized and shared by parsers on all threads
+constinit StyleStartState startState;
+constinit StyleStartSelectorState startSelectorState;
+constinit StyleIdSelectorState idSelectorState;
+constinit StyleClassSelectorState classSelectorState;
+constinit StyleTypeSelectorState typeSelectorState;
+constinit StyleAttributeSelectorState attributeSelectorState;
+constinit StyleStartPseudoState pseudoStartState;
+constinit StylePseudoClassSelectorState pseudoClassSelectorState;
+constinit StylePseudoElementSelectorState pseudoElementSelectorState;
+constinit StylePseudoClassWithArgumentEndState pseudoClassArgumentEndState;
+constinit StylePseudoElementWithArgumentEndState pseudoElementArgumentEndState;
+constinit BeforeRuleStartState beforeRuleState;
+constinit StyleCombinatorState combinatorState;
+constinit StyleEndSelectorState endSelectorState;
+constinit StyleRulesState rulesState;
+constinit EndStyleState endState;
+constinit ErrorStyleState errorState;
+constinit StyleStartCommentState startCommentState;
+constinit StyleCommentState commentState;
+constinit StyleEndCommentState endCommentState;
+}
+
+constexpr StyleState::StatesArray StyleState::makeAllStates() {
+  StatesArray states{};
+  auto setState = [&states](StyleStateType styleStateType, StyleState &state) {
+    states[static_cast<size_t>(styleStateType)] = &state;
+  };
+  setState(StyleStateType::START, startState);
+  setState(StyleStateType::START_SELECTOR, startSelectorState);
+  setState(StyleStateType::ID_SELECTOR, idSelectorState);
+  setState(StyleStateType::CLASS_SELECTOR, classSelectorState);
+  setState(StyleStateType::TYPE_SELECTOR, typeSelectorState);
+  setState(StyleStateType::ATTRIBUTE_SELECTOR, attributeSelectorState);
+  setState(StyleStateType::PSEUDO_START, pseudoStartState);
+  setState(StyleStateType::PSEUDO_CLASS_SELECTOR, pseudoClassSelectorState);
+  setState(StyleStateType::PSEUDO_ELEMENT_SELECTOR, pseudoElementSelectorState);
+  setState(StyleStateType::PSEUDO_CLASS_ARGUMENT_END, pseudoClassArgumentEndState);
+  setState(StyleStateType::PSEUDO_ELEMENT_ARGUMENT_END, pseudoElementArgumentEndState);
+  setState(StyleStateType::BEFORE_RULE_STATE, beforeRuleState);
+  setState(StyleStateType::COMBINATION, combinatorState);
+  setState(StyleStateType::END_SELECTOR, endSelectorState);
+  setState(StyleStateType::RULES, rulesState);
+  setState(StyleStateType::END_STATE, endState);
+  setState(StyleStateType::ERROR, errorState);
+  setState(StyleStateType::START_COMMENT_STATE, startCommentState);
+  setState(StyleStateType::COMMENT_STATE, commentState);
+  setState(StyleStateType::END_COMMENT_STATE, endCommentState);
+  return states;
+}
+
+constinit const StyleState::StatesArray StyleState::statesInstance = StyleState::makeAllStates();
 
 uint32_t StyleState::getNextCharacter(StyleSheetParser &parser) {
   uint32_t character;
@@ -35,58 +88,4 @@ uint32_t StyleState::getNextCharacter(StyleSheetParser &parser) {
   return character;
 }
 
-std::unique_ptr<StyleState>
-StyleState::makeNewState(StyleStateType styleStateType) {
-  switch (styleStateType) {
-    case StyleStateType::ATTRIBUTE_SELECTOR:return std::make_unique<StyleAttributeSelectorState>();
-      break;
-    case StyleStateType::CLASS_SELECTOR:return std::make_unique<StyleClassSelectorState>();
-      break;
-    case StyleStateType::START_SELECTOR:return std::make_unique<StyleStartSelectorState>();
-      break;
-    case StyleStateType::END_SELECTOR:return std::make_unique<StyleEndSelectorState>();
-      break;
-    case StyleStateType::PSEUDO_CLASS_SELECTOR:return std::make_unique<StylePseudoClassSelectorState>();
-      break;
-    case StyleStateType::PSEUDO_ELEMENT_SELECTOR:return std::make_unique<StylePseudoElementSelectorState>();
-      break;
-    case StyleStateType::PSEUDO_START:return std::make_unique<StyleStartPseudoState>();
-      break;
-    case StyleStateType::PSEUDO_CLASS_ARGUMENT_END:return std::make_unique<StylePseudoClassWithArgumentEndState>();
-      break;
-    case StyleStateType::PSEUDO_ELEMENT_ARGUMENT_END:return std::make_unique<StylePseudoElementWithArgumentEndState>();
-      break;
-    case StyleStateType::BEFORE_RULE_STATE:return std::make_unique<BeforeRuleStartState>();
-    case StyleStateType::RULES:return std::make_unique<StyleRulesState>();
-      break;
-    case StyleStateType::START:return std::make_unique<StyleStartState>();
-      break;
-    case StyleStateType::TYPE_SELECTOR:return std::make_unique<StyleTypeSelectorState>();
-      break;
-    case StyleStateType::ID_SELECTOR:return std::make_unique<StyleIdSelectorState>();
-      break;
-    case StyleStateType::END_STATE:return std::make_unique<EndStyleState>();
-      break;
-    case StyleStateType::ERROR:return std::make_unique<ErrorStyleState>();
-      break;
-    case StyleStateType::START_COMMENT_STATE:return std::make_unique<StyleStartCommentState>();
-      break;
-    case StyleStateType::COMMENT_STATE:return std::make_unique<StyleCommentState>();
-      break;
-    case StyleStateType::END_COMMENT_STATE:return std::make_unique<StyleEndCommentState>();
-      break;
-    default:return nullptr;
-      break;
-  }
-}
-
-StyleState *StyleState::getInstance(StyleStateType newState) {
-  auto found = statesInstance.find(newState);
-  if (found == statesInstance.end()) {
-    return (statesInstance[newState] = StyleState::makeNewState(newState)).get();
-  } else {
-    return found->second.get();
-  }
-}
-
 } // namespace webvtt
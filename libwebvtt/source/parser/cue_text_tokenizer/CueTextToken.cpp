@@ -0,0 +1,61 @@
+#include "parser/cue_text_tokenizer/CueTextToken.hpp"
+#include "elements/cue_nodes/InternalNodeObject.hpp"
+#include "elements/cue_nodes/leaf_node_objects/TextObject.hpp"
+#include "elements/cue_nodes/leaf_node_objects/TimeStampObject.hpp"
+#include "parser/ParserUtil.hpp"
+#include "logger/LoggingUtility.hpp"
+
+namespace webvtt {
+
+void CueTextToken::process(NodeObject *&nodeObject, std::stack<Atom> &languages, NodeArena &arena) const {
+  switch (type) {
+    case TokenType::STRING:nodeObject->appendChild(arena.make<TextObject>(arena.copyString(value)));
+      break;
+    case TokenType::START_TAG:processStartTag(nodeObject, languages, arena);
+      break;
+    case TokenType::END_TAG:
+      nodeObject->processEndToken(nodeObject, languages, InternalNodeObject::convertToInternalNodeType(value));
+      break;
+    case TokenType::TIME_STAMP_TAG:processTimeStampTag(nodeObject, arena);
+      break;
+  }
+}
+
+void CueTextToken::processStartTag(NodeObject *&nodeObject,
+                                   std::stack<Atom> &languages,
+                                   NodeArena &arena) const {
+  NodeObject::NodeType nodeType = InternalNodeObject::convertToInternalNodeType(value);
+  if (nodeType == NodeObject::NodeType::UNDEFINED)
+    return;
+
+  if (nodeType == NodeObject::NodeType::RUBY_TEXT &&
+      nodeObject->getNodeType() != NodeObject::NodeType::RUBY)
+    return;
+  InternalNodeObject *newObject = InternalNodeObject::makeInternalNode(arena, nodeType);
+
+  newObject->setClasses(arena, classes);
+  newObject->processAnnotationString(arena, languages, annotation);
+
+  if (!languages.empty())
+    newObject->setLanguage(languages.top());
+
+  nodeObject->appendChild(newObject);
+  nodeObject = newObject;
+}
+
+void CueTextToken::processTimeStampTag(NodeObject *&nodeObject, NodeArena &arena) const {
+  auto position = value.begin();
+  auto time = ParserUtil::tryParseTimeStamp(value, position);
+  if (!time) {
+    DILOGE(getParseErrorMessage(time.error()));
+    return;
+  }
+
+  if (position != value.end()) {
+    DILOGE("Timestamp contains extra characters" + utf8::utf32to8(value));
+    return;
+  }
+  nodeObject->appendChild(arena.make<TimeStampObject>(*time));
+}
+
+} // namespace webvtt
@@ -1,22 +1,244 @@
 #include "parser/cue_text_tokenizer/CueTextTokenizer.hpp"
-#include "parser/cue_text_tokenizer/tokens/Token.hpp"
 #include "parser/ParserUtil.hpp"
-#include <memory>
+#include <algorithm>
 
 namespace webvtt {
 
-std::unique_ptr<Token> CueTextTokenizer::getNextToken() {
+void CueTextTokenizer::TokenText::clear() {
+  begin = end = {};
+  isCopied = false;
   buffer.clear();
+}
+
+void CueTextTokenizer::TokenText::push(std::u32string_view::iterator character) {
+  append(character, character + 1);
+}
+
+void CueTextTokenizer::TokenText::append(std::u32string_view::iterator first, std::u32string_view::iterator last) {
+  if (first == last)
+    return;
+  if (!isCopied) {
+    if (begin == end) {
+      begin = first;
+      end = last;
+      return;
+    }
+    if (first == end) {
+      end = last;
+      return;
+    }
+    copyToBuffer();
+  }
+  buffer.append(first, last);
+}
+
+void CueTextTokenizer::TokenText::append(std::u32string_view text) {
+  if (!isCopied)
+    copyToBuffer();
+  buffer.append(text);
+}
+
+std::u32string_view CueTextTokenizer::TokenText::view() const {
+  if (isCopied)
+    return buffer;
+  return {begin, end};
+}
+
+void CueTextTokenizer::TokenText::copyToBuffer() {
+  buffer.assign(begin, end);
+  isCopied = true;
+}
+
+void CueTextTokenizer::setText(std::u32string_view newInput) {
+  input = newInput;
+  currentPosition = input.begin();
+}
+
+CueTextToken CueTextTokenizer::getNextToken() {
   result.clear();
+  annotationText.clear();
+  annotation = {};
   classes.clear();
-  setState(CueTextTokenizerState::TokenizerState::DATA);
 
-  while (true) {
-    std::unique_ptr<Token> token = currentState->process(*this);
-    if (token != nullptr)
-      return token;
-    if (currentPosition != input.end()) currentPosition++;
+  TokenizerState state = TokenizerState::DATA;
+  for (;; advance()) {
+    uint32_t character = currentPosition == input.end() ? STOP_TOKENIZER : *currentPosition;
+
+    switch (state) {
+      case TokenizerState::DATA:
+        switch (character) {
+          case ParserUtil::AMPERSAND_C:appendHTMLCharacter(currentPosition, std::nullopt, false);
+            break;
+          case ParserUtil::HYPHEN_LESS:
+            if (!result.empty())
+              return CueTextToken::makeToken(CueTextToken::TokenType::STRING, result.view());
+            state = TokenizerState::START_TAG;
+            break;
+          case STOP_TOKENIZER:return CueTextToken::makeToken(CueTextToken::TokenType::STRING, result.view());
+          default: {
+            //Plain text is taken at once up to next markup, loop moves past its last character
+            auto textEnd = std::find_if(currentPosition, input.end(), [](char32_t textCharacter) {
+              return textCharacter == ParserUtil::AMPERSAND_C || textCharacter == ParserUtil::HYPHEN_LESS;
+            });
+            result.append(currentPosition, textEnd);
+            currentPosition = textEnd - 1;
+            break;
+          }
+        }
+        break;
+
+      case TokenizerState::TAG:
+        if (ParserUtil::isAsciiDecDigit(character)) {
+          result.push(currentPosition);
+          state = TokenizerState::TIME_STAMP_TAG;
+          break;
+        }
+        switch (character) {
+          case ParserUtil::TAB_C:
+          case ParserUtil::LF_C:
+          case ParserUtil::FF_C:
+          case ParserUtil::SPACE_C:state = TokenizerState::START_TAG_ANNOTATION;
+            break;
+          case ParserUtil::FULL_STOP:classStart = currentPosition + 1;
+            state = TokenizerState::START_TAG_CLASS;
+            break;
+          case ParserUtil::SOLIDUS_C:state = TokenizerState::END_TAG;
+            break;
+          case ParserUtil::HYPHEN_GREATER:currentPosition++;
+            [[fallthrough]];
+          case STOP_TOKENIZER:return makeStartTagToken();
+          default:result.push(currentPosition);
+            state = TokenizerState::START_TAG;
+            break;
+        }
+        break;
+
+      case TokenizerState::START_TAG:
+        switch (character) {
+          case ParserUtil::TAB_C:
+          case ParserUtil::LF_C:
+          case ParserUtil::FF_C:
+          case ParserUtil::SPACE_C:state = TokenizerState::START_TAG_ANNOTATION;
+            break;
+          case ParserUtil::FULL_STOP:classStart = currentPosition + 1;
+            state = TokenizerState::START_TAG_CLASS;
+            break;
+          case ParserUtil::HYPHEN_GREATER:currentPosition++;
+            [[fallthrough]];
+          case STOP_TOKENIZER:return makeStartTagToken();
+          default:result.push(currentPosition);
+            break;
+        }
+        break;
+
+      case TokenizerState::START_TAG_CLASS:
+        switch (character) {
+          case ParserUtil::TAB_C:
+          case ParserUtil::LF_C:
+          case ParserUtil::FF_C:
+          case ParserUtil::SPACE_C:addClass(currentPosition);
+            state = TokenizerState::START_TAG_ANNOTATION;
+            break;
+          case ParserUtil::FULL_STOP:addClass(currentPosition);
+            classStart = currentPosition + 1;
+            break;
+          case ParserUtil::HYPHEN_GREATER:addClass(currentPosition++);
+            return makeStartTagToken();
+          case STOP_TOKENIZER:addClass(currentPosition);
+            return makeStartTagToken();
+          default:break;
+        }
+        break;
+
+      case TokenizerState::START_TAG_ANNOTATION:
+        switch (character) {
+          case ParserUtil::AMPERSAND_C: {
+            auto ampersand = currentPosition++;
+            if (currentPosition == input.end())
+              result.push(ampersand);
+            else
+              appendHTMLCharacter(ampersand, ParserUtil::HYPHEN_LESS, true);
+            break;
+          }
+          case ParserUtil::HYPHEN_GREATER:currentPosition++;
+            [[fallthrough]];
+          case STOP_TOKENIZER:collapseAnnotation();
+            return makeStartTagToken();
+          default:annotationText.push(currentPosition);
+            break;
+        }
+        break;
+
+      case TokenizerState::END_TAG:
+        switch (character) {
+          case ParserUtil::HYPHEN_GREATER:currentPosition++;
+            [[fallthrough]];
+          case STOP_TOKENIZER:return CueTextToken::makeToken(CueTextToken::TokenType::END_TAG, result.view());
+          default:result.push(currentPosition);
+            break;
+        }
+        break;
+
+      case TokenizerState::TIME_STAMP_TAG:
+        switch (character) {
+          case ParserUtil::HYPHEN_GREATER:currentPosition++;
+            [[fallthrough]];
+          case STOP_TOKENIZER:return CueTextToken::makeToken(CueTextToken::TokenType::TIME_STAMP_TAG, result.view());
+          default:result.push(currentPosition);
+            break;
+        }
+        break;
+    }
   }
 }
 
+void CueTextTokenizer::advance() {
+  if (currentPosition != input.end())
+    currentPosition++;
+}
+
+void CueTextTokenizer::appendHTMLCharacter(std::u32string_view::iterator ampersand,
+                                           std::optional<uint32_t> additionalCharacter,
+                                           bool isInAttribute) {
+  bool parsingError = false;
+  std::u32string reference = ParserUtil::consumeHTMLCharacter(input, currentPosition,
+                                                              additionalCharacter, isInAttribute, parsingError);
+  if (reference.empty())
+    result.push(ampersand);
+  else
+    result.append(reference);
+}
+
+void CueTextTokenizer::addClass(std::u32string_view::iterator classEnd) {
+  if (classStart != classEnd)
+    classes.emplace_back(classStart, classEnd);
 }
+
+CueTextToken CueTextTokenizer::makeStartTagToken() {
+  return {.type = CueTextToken::TokenType::START_TAG,
+      .value = result.view(),
+      .classes = classes,
+      .annotation = annotation};
+}
+
+void CueTextTokenizer::collapseAnnotation() {
+  annotation = annotationText.view();
+  ParserUtil::strip(annotation, ParserUtil::IS_WHITE_SPACE);
+
+  //Most annotations are separated by single spaces and stay view into input
+  bool isCollapsed = true;
+  for (size_t index = 0; index < annotation.size() && isCollapsed; index++) {
+    if (ParserUtil::isASCIIWhiteSpaceCharacter(annotation[index]))
+      isCollapsed = annotation[index] == ParserUtil::SPACE_C
+          && !ParserUtil::isASCIIWhiteSpaceCharacter(annotation[index + 1]);
+  }
+  if (isCollapsed)
+    return;
+
+  collapsedAnnotation.assign(annotation);
+  ParserUtil::replaceAllSequenceOfCharactersWithGivenCharacter(collapsedAnnotation, ParserUtil::IS_WHITE_SPACE,
+                                                               ParserUtil::SPACE_C);
+  annotation = collapsedAnnotation;
+}
+
+} // namespace webvtt
@@ -1,6 +0,0 @@
-#include "parser/cue_text_tokenizer/tokens/Token.hpp"
-
-namespace webvtt
-{
-
-}
\ No newline at end of file
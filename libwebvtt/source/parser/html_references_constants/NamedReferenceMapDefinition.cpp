@@ -1,2239 +0,0 @@
-#include "parser/ParserUtil.hpp"
-
-namespace webvtt
-{
-    const std::map<std::string, std::u32string> ParserUtil::namedHTMLREferences{
-        {"Aacute;", {0x000C1}},                           //Á
-        {"Aacute", {0x000C1}},                            //Á
-        {"aacute;", {0x000E1}},                           //á
-        {"aacute", {0x000E1}},                            //á
-        {"Abreve;", {0x00102}},                           //Ă
-        {"abreve;", {0x00103}},                           //ă
-        {"ac;", {0x0223E}},                               //∾
-        {"acd;", {0x0223F}},                              //∿
-        {"acE;", {0x0223E, 0x00333}},                     //acE;
-        {"Acirc;", {0x000C2}},                            //Â
-        {"Acirc", {0x000C2}},                             //Â
-        {"acirc;", {0x000E2}},                            //â
-        {"acirc", {0x000E2}},                             //â
-        {"acute;", {0x000B4}},                            //´
-        {"acute", {0x000B4}},                             //´
-        {"Acy;", {0x00410}},                              //А
-        {"acy;", {0x00430}},                              //а
-        {"AElig;", {0x000C6}},                            //Æ
-        {"AElig", {0x000C6}},                             //Æ
-        {"aelig;", {0x000E6}},                            //æ
-        {"aelig", {0x000E6}},                             //æ
-        {"af;", {0x02061}},                               //⁡
-        {"Afr;", {0x1D504}},                              //𝔄
-        {"afr;", {0x1D51E}},                              //𝔞
-        {"Agrave;", {0x000C0}},                           //À
-        {"Agrave", {0x000C0}},                            //À
-        {"agrave;", {0x000E0}},                           //à
-        {"agrave", {0x000E0}},                            //à
-        {"alefsym;", {0x02135}},                          //ℵ
-        {"aleph;", {0x02135}},                            //ℵ
-        {"Alpha;", {0x00391}},                            //Α
-        {"alpha;", {0x003B1}},                            //α
-        {"Amacr;", {0x00100}},                            //Ā
-        {"amacr;", {0x00101}},                            //ā
-        {"amalg;", {0x02A3F}},                            //⨿
-        {"AMP;", {0x00026}},                              //&
-        {"AMP", {0x00026}},                               //&
-        {"amp;", {0x00026}},                              //&
-        {"amp", {0x00026}},                               //&
-        {"And;", {0x02A53}},                              //⩓
-        {"and;", {0x02227}},                              //∧
-        {"andand;", {0x02A55}},                           //⩕
-        {"andd;", {0x02A5C}},                             //⩜
-        {"andslope;", {0x02A58}},                         //⩘
-        {"andv;", {0x02A5A}},                             //⩚
-        {"ang;", {0x02220}},                              //∠
-        {"ange;", {0x029A4}},                             //⦤
-        {"angle;", {0x02220}},                            //∠
-        {"angmsd;", {0x02221}},                           //∡
-        {"angmsdaa;", {0x029A8}},                         //⦨
-        {"angmsdab;", {0x029A9}},                         //⦩
-        {"angmsdac;", {0x029AA}},                         //⦪
-        {"angmsdad;", {0x029AB}},                         //⦫
-        {"angmsdae;", {0x029AC}},                         //⦬
-        {"angmsdaf;", {0x029AD}},                         //⦭
-        {"angmsdag;", {0x029AE}},                         //⦮
-        {"angmsdah;", {0x029AF}},                         //⦯
-        {"angrt;", {0x0221F}},                            //∟
-        {"angrtvb;", {0x022BE}},                          //⊾
-        {"angrtvbd;", {0x0299D}},                         //⦝
-        {"angsph;", {0x02222}},                           //∢
-        {"angst;", {0x000C5}},                            //Å
-        {"angzarr;", {0x0237C}},                          //⍼
-        {"Aogon;", {0x00104}},                            //Ą
-        {"aogon;", {0x00105}},                            //ą
-        {"Aopf;", {0x1D538}},                             //𝔸
-        {"aopf;", {0x1D552}},                             //𝕒
-        {"ap;", {0x02248}},                               //≈
-        {"apacir;", {0x02A6F}},                           //⩯
-        {"apE;", {0x02A70}},                              //⩰
-        {"ape;", {0x0224A}},                              //≊
-        {"apid;", {0x0224B}},                             //≋
-        {"apos;", {0x00027}},                             //'
-        {"ApplyFunction;", {0x02061}},                    //⁡
-        {"approx;", {0x02248}},                           //≈
-        {"approxeq;", {0x0224A}},                         //≊
-        {"Aring;", {0x000C5}},                            //Å
-        {"Aring", {0x000C5}},                             //Å
-        {"aring;", {0x000E5}},                            //å
-        {"aring", {0x000E5}},                             //å
-        {"Ascr;", {0x1D49C}},                             //𝒜
-        {"ascr;", {0x1D4B6}},                             //𝒶
-        {"Assign;", {0x02254}},                           //≔
-        {"ast;", {0x0002A}},                              //*
-        {"asymp;", {0x02248}},                            //≈
-        {"asympeq;", {0x0224D}},                          //≍
-        {"Atilde;", {0x000C3}},                           //Ã
-        {"Atilde", {0x000C3}},                            //Ã
-        {"atilde;", {0x000E3}},                           //ã
-        {"atilde", {0x000E3}},                            //ã
-        {"Auml;", {0x000C4}},                             //Ä
-        {"Auml", {0x000C4}},                              //Ä
-        {"auml;", {0x000E4}},                             //ä
-        {"auml", {0x000E4}},                              //ä
-        {"awconint;", {0x02233}},                         //∳
-        {"awint;", {0x02A11}},                            //⨑
-        {"backcong;", {0x0224C}},                         //≌
-        {"backepsilon;", {0x003F6}},                      //϶
-        {"backprime;", {0x02035}},                        //‵
-        {"backsim;", {0x0223D}},                          //∽
-        {"backsimeq;", {0x022CD}},                        //⋍
-        {"Backslash;", {0x02216}},                        //∖
-        {"Barv;", {0x02AE7}},                             //⫧
-        {"barvee;", {0x022BD}},                           //⊽
-        {"Barwed;", {0x02306}},                           //⌆
-        {"barwed;", {0x02305}},                           //⌅
-        {"barwedge;", {0x02305}},                         //⌅
-        {"bbrk;", {0x023B5}},                             //⎵
-        {"bbrktbrk;", {0x023B6}},                         //⎶
-        {"bcong;", {0x0224C}},                            //≌
-        {"Bcy;", {0x00411}},                              //Б
-        {"bcy;", {0x00431}},                              //б
-        {"bdquo;", {0x0201E}},                            //„
-        {"becaus;", {0x02235}},                           //∵
-        {"Because;", {0x02235}},                          //∵
-        {"because;", {0x02235}},                          //∵
-        {"bemptyv;", {0x029B0}},                          //⦰
-        {"bepsi;", {0x003F6}},                            //϶
-        {"bernou;", {0x0212C}},                           //ℬ
-        {"Bernoullis;", {0x0212C}},                       //ℬ
-        {"Beta;", {0x00392}},                             //Β
-        {"beta;", {0x003B2}},                             //β
-        {"beth;", {0x02136}},                             //ℶ
-        {"between;", {0x0226C}},                          //≬
-        {"Bfr;", {0x1D505}},                              //𝔅
-        {"bfr;", {0x1D51F}},                              //𝔟
-        {"bigcap;", {0x022C2}},                           //⋂
-        {"bigcirc;", {0x025EF}},                          //◯
-        {"bigcup;", {0x022C3}},                           //⋃
-        {"bigodot;", {0x02A00}},                          //⨀
-        {"bigoplus;", {0x02A01}},                         //⨁
-        {"bigotimes;", {0x02A02}},                        //⨂
-        {"bigsqcup;", {0x02A06}},                         //⨆
-        {"bigstar;", {0x02605}},                          //★
-        {"bigtriangledown;", {0x025BD}},                  //▽
-        {"bigtriangleup;", {0x025B3}},                    //△
-        {"biguplus;", {0x02A04}},                         //⨄
-        {"bigvee;", {0x022C1}},                           //⋁
-        {"bigwedge;", {0x022C0}},                         //⋀
-        {"bkarow;", {0x0290D}},                           //⤍
-        {"blacklozenge;", {0x029EB}},                     //⧫
-        {"blacksquare;", {0x025AA}},                      //▪
-        {"blacktriangle;", {0x025B4}},                    //▴
-        {"blacktriangledown;", {0x025BE}},                //▾
-        {"blacktriangleleft;", {0x025C2}},                //◂
-        {"blacktriangleright;", {0x025B8}},               //▸
-        {"blank;", {0x02423}},                            //␣
-        {"blk12;", {0x02592}},                            //▒
-        {"blk14;", {0x02591}},                            //░
-        {"blk34;", {0x02593}},                            //▓
-        {"block;", {0x02588}},                            //█
-        {"bne;", {0x0003D, 0x020E5}},                     //bne;
-        {"bnequiv;", {0x02261, 0x020E5}},                 //bnequiv;
-        {"bNot;", {0x02AED}},                             //⫭
-        {"bnot;", {0x02310}},                             //⌐
-        {"Bopf;", {0x1D539}},                             //𝔹
-        {"bopf;", {0x1D553}},                             //𝕓
-        {"bot;", {0x022A5}},                              //⊥
-        {"bottom;", {0x022A5}},                           //⊥
-        {"bowtie;", {0x022C8}},                           //⋈
-        {"boxbox;", {0x029C9}},                           //⧉
-        {"boxDL;", {0x02557}},                            //╗
-        {"boxDl;", {0x02556}},                            //╖
-        {"boxdL;", {0x02555}},                            //╕
-        {"boxdl;", {0x02510}},                            //┐
-        {"boxDR;", {0x02554}},                            //╔
-        {"boxDr;", {0x02553}},                            //╓
-        {"boxdR;", {0x02552}},                            //╒
-        {"boxdr;", {0x0250C}},                            //┌
-        {"boxH;", {0x02550}},                             //═
-        {"boxh;", {0x02500}},                             //─
-        {"boxHD;", {0x02566}},                            //╦
-        {"boxHd;", {0x02564}},                            //╤
-        {"boxhD;", {0x02565}},                            //╥
-        {"boxhd;", {0x0252C}},                            //┬
-        {"boxHU;", {0x02569}},                            //╩
-        {"boxHu;", {0x02567}},                            //╧
-        {"boxhU;", {0x02568}},                            //╨
-        {"boxhu;", {0x02534}},                            //┴
-        {"boxminus;", {0x0229F}},                         //⊟
-        {"boxplus;", {0x0229E}},                          //⊞
-        {"boxtimes;", {0x022A0}},                         //⊠
-        {"boxUL;", {0x0255D}},                            //╝
-        {"boxUl;", {0x0255C}},                            //╜
-        {"boxuL;", {0x0255B}},                            //╛
-        {"boxul;", {0x02518}},                            //┘
-        {"boxUR;", {0x0255A}},                            //╚
-        {"boxUr;", {0x02559}},                            //╙
-        {"boxuR;", {0x02558}},                            //╘
-        {"boxur;", {0x02514}},                            //└
-        {"boxV;", {0x02551}},                             //║
-        {"boxv;", {0x02502}},                             //│
-        {"boxVH;", {0x0256C}},                            //╬
-        {"boxVh;", {0x0256B}},                            //╫
-        {"boxvH;", {0x0256A}},                            //╪
-        {"boxvh;", {0x0253C}},                            //┼
-        {"boxVL;", {0x02563}},                            //╣
-        {"boxVl;", {0x02562}},                            //╢
-        {"boxvL;", {0x02561}},                            //╡
-        {"boxvl;", {0x02524}},                            //┤
-        {"boxVR;", {0x02560}},                            //╠
-        {"boxVr;", {0x0255F}},                            //╟
-        {"boxvR;", {0x0255E}},                            //╞
-        {"boxvr;", {0x0251C}},                            //├
-        {"bprime;", {0x02035}},                           //‵
-        {"Breve;", {0x002D8}},                            //˘
-        {"breve;", {0x002D8}},                            //˘
-        {"brvbar;", {0x000A6}},                           //¦
-        {"brvbar", {0x000A6}},                            //¦
-        {"Bscr;", {0x0212C}},                             //ℬ
-        {"bscr;", {0x1D4B7}},                             //𝒷
-        {"bsemi;", {0x0204F}},                            //⁏
-        {"bsim;", {0x0223D}},                             //∽
-        {"bsime;", {0x022CD}},                            //⋍
-        {"bsol;", {0x0005C}},                             // new line
-        {"bsolb;", {0x029C5}},                            //⧅
-        {"bsolhsub;", {0x027C8}},                         //⟈
-        {"bull;", {0x02022}},                             //•
-        {"bullet;", {0x02022}},                           //•
-        {"bump;", {0x0224E}},                             //≎
-        {"bumpE;", {0x02AAE}},                            //⪮
-        {"bumpe;", {0x0224F}},                            //≏
-        {"Bumpeq;", {0x0224E}},                           //≎
-        {"bumpeq;", {0x0224F}},                           //≏
-        {"Cacute;", {0x00106}},                           //Ć
-        {"cacute;", {0x00107}},                           //ć
-        {"Cap;", {0x022D2}},                              //⋒
-        {"cap;", {0x02229}},                              //∩
-        {"capand;", {0x02A44}},                           //⩄
-        {"capbrcup;", {0x02A49}},                         //⩉
-        {"capcap;", {0x02A4B}},                           //⩋
-        {"capcup;", {0x02A47}},                           //⩇
-        {"capdot;", {0x02A40}},                           //⩀
-        {"CapitalDifferentialD;", {0x02145}},             //ⅅ
-        {"caps;", {0x02229, 0x0FE00}},                    //caps;
-        {"caret;", {0x02041}},                            //⁁
-        {"caron;", {0x002C7}},                            //ˇ
-        {"Cayleys;", {0x0212D}},                          //ℭ
-        {"ccaps;", {0x02A4D}},                            //⩍
-        {"Ccaron;", {0x0010C}},                           //Č
-        {"ccaron;", {0x0010D}},                           //č
-        {"Ccedil;", {0x000C7}},                           //Ç
-        {"Ccedil", {0x000C7}},                            //Ç
-        {"ccedil;", {0x000E7}},                           //ç
-        {"ccedil", {0x000E7}},                            //ç
-        {"Ccirc;", {0x00108}},                            //Ĉ
-        {"ccirc;", {0x00109}},                            //ĉ
-        {"Cconint;", {0x02230}},                          //∰
-        {"ccups;", {0x02A4C}},                            //⩌
-        {"ccupssm;", {0x02A50}},                          //⩐
-        {"Cdot;", {0x0010A}},                             //Ċ
-        {"cdot;", {0x0010B}},                             //ċ
-        {"cedil;", {0x000B8}},                            //¸
-        {"cedil", {0x000B8}},                             //¸
-        {"Cedilla;", {0x000B8}},                          //¸
-        {"cemptyv;", {0x029B2}},                          //⦲
-        {"cent;", {0x000A2}},                             //¢
-        {"cent", {0x000A2}},                              //¢
-        {"CenterDot;", {0x000B7}},                        //·
-        {"centerdot;", {0x000B7}},                        //·
-        {"Cfr;", {0x0212D}},                              //ℭ
-        {"cfr;", {0x1D520}},                              //𝔠
-        {"CHcy;", {0x00427}},                             //Ч
-        {"chcy;", {0x00447}},                             //ч
-        {"check;", {0x02713}},                            //✓
-        {"checkmark;", {0x02713}},                        //✓
-        {"Chi;", {0x003A7}},                              //Χ
-        {"chi;", {0x003C7}},                              //χ
-        {"cir;", {0x025CB}},                              //○
-        {"circ;", {0x002C6}},                             //ˆ
-        {"circeq;", {0x02257}},                           //≗
-        {"circlearrowleft;", {0x021BA}},                  //↺
-        {"circlearrowright;", {0x021BB}},                 //↻
-        {"circledast;", {0x0229B}},                       //⊛
-        {"circledcirc;", {0x0229A}},                      //⊚
-        {"circleddash;", {0x0229D}},                      //⊝
-        {"CircleDot;", {0x02299}},                        //⊙
-        {"circledR;", {0x000AE}},                         //®
-        {"circledS;", {0x024C8}},                         //Ⓢ
-        {"CircleMinus;", {0x02296}},                      //⊖
-        {"CirclePlus;", {0x02295}},                       //⊕
-        {"CircleTimes;", {0x02297}},                      //⊗
-        {"cirE;", {0x029C3}},                             //⧃
-        {"cire;", {0x02257}},                             //≗
-        {"cirfnint;", {0x02A10}},                         //⨐
-        {"cirmid;", {0x02AEF}},                           //⫯
-        {"cirscir;", {0x029C2}},                          //⧂
-        {"ClockwiseContourIntegral;", {0x02232}},         //∲
-        {"CloseCurlyDoubleQuote;", {0x0201D}},            //”
-        {"CloseCurlyQuote;", {0x02019}},                  //’
-        {"clubs;", {0x02663}},                            //♣
-        {"clubsuit;", {0x02663}},                         //♣
-        {"Colon;", {0x02237}},                            //∷
-        {"colon;", {0x0003A}},                            //:
-        {"Colone;", {0x02A74}},                           //⩴
-        {"colone;", {0x02254}},                           //≔
-        {"coloneq;", {0x02254}},                          //≔
-        {"comma;", {0x0002C}},                            //,
-        {"commat;", {0x00040}},                           //@
-        {"comp;", {0x02201}},                             //∁
-        {"compfn;", {0x02218}},                           //∘
-        {"complement;", {0x02201}},                       //∁
-        {"complexes;", {0x02102}},                        //ℂ
-        {"cong;", {0x02245}},                             //≅
-        {"congdot;", {0x02A6D}},                          //⩭
-        {"Congruent;", {0x02261}},                        //≡
-        {"Conint;", {0x0222F}},                           //∯
-        {"conint;", {0x0222E}},                           //∮
-        {"ContourIntegral;", {0x0222E}},                  //∮
-        {"Copf;", {0x02102}},                             //ℂ
-        {"copf;", {0x1D554}},                             //𝕔
-        {"coprod;", {0x02210}},                           //∐
-        {"Coproduct;", {0x02210}},                        //∐
-        {"COPY;", {0x000A9}},                             //©
-        {"COPY", {0x000A9}},                              //©
-        {"copy;", {0x000A9}},                             //©
-        {"copy", {0x000A9}},                              //©
-        {"copysr;", {0x02117}},                           //℗
-        {"CounterClockwiseContourIntegral;", {0x02233}},  //∳
-        {"crarr;", {0x021B5}},                            //↵
-        {"Cross;", {0x02A2F}},                            //⨯
-        {"cross;", {0x02717}},                            //✗
-        {"Cscr;", {0x1D49E}},                             //𝒞
-        {"cscr;", {0x1D4B8}},                             //𝒸
-        {"csub;", {0x02ACF}},                             //⫏
-        {"csube;", {0x02AD1}},                            //⫑
-        {"csup;", {0x02AD0}},                             //⫐
-        {"csupe;", {0x02AD2}},                            //⫒
-        {"ctdot;", {0x022EF}},                            //⋯
-        {"cudarrl;", {0x02938}},                          //⤸
-        {"cudarrr;", {0x02935}},                          //⤵
-        {"cuepr;", {0x022DE}},                            //⋞
-        {"cuesc;", {0x022DF}},                            //⋟
-        {"cularr;", {0x021B6}},                           //↶
-        {"cularrp;", {0x0293D}},                          //⤽
-        {"Cup;", {0x022D3}},                              //⋓
-        {"cup;", {0x0222A}},                              //∪
-        {"cupbrcap;", {0x02A48}},                         //⩈
-        {"CupCap;", {0x0224D}},                           //≍
-        {"cupcap;", {0x02A46}},                           //⩆
-        {"cupcup;", {0x02A4A}},                           //⩊
-        {"cupdot;", {0x0228D}},                           //⊍
-        {"cupor;", {0x02A45}},                            //⩅
-        {"cups;", {0x0222A, 0x0FE00}},                    //cups;
-        {"curarr;", {0x021B7}},                           //↷
-        {"curarrm;", {0x0293C}},                          //⤼
-        {"curlyeqprec;", {0x022DE}},                      //⋞
-        {"curlyeqsucc;", {0x022DF}},                      //⋟
-        {"curlyvee;", {0x022CE}},                         //⋎
-        {"curlywedge;", {0x022CF}},                       //⋏
-        {"curren;", {0x000A4}},                           //¤
-        {"curren", {0x000A4}},                            //¤
-        {"curvearrowleft;", {0x021B6}},                   //↶
-        {"curvearrowright;", {0x021B7}},                  //↷
-        {"cuvee;", {0x022CE}},                            //⋎
-        {"cuwed;", {0x022CF}},                            //⋏
-        {"cwconint;", {0x02232}},                         //∲
-        {"cwint;", {0x02231}},                            //∱
-        {"cylcty;", {0x0232D}},                           //⌭
-        {"Dagger;", {0x02021}},                           //‡
-        {"dagger;", {0x02020}},                           //†
-        {"daleth;", {0x02138}},                           //ℸ
-        {"Darr;", {0x021A1}},                             //↡
-        {"dArr;", {0x021D3}},                             //⇓
-        {"darr;", {0x02193}},                             //↓
-        {"dash;", {0x02010}},                             //‐
-        {"Dashv;", {0x02AE4}},                            //⫤
-        {"dashv;", {0x022A3}},                            //⊣
-        {"dbkarow;", {0x0290F}},                          //⤏
-        {"dblac;", {0x002DD}},                            //˝
-        {"Dcaron;", {0x0010E}},                           //Ď
-        {"dcaron;", {0x0010F}},                           //ď
-        {"Dcy;", {0x00414}},                              //Д
-        {"dcy;", {0x00434}},                              //д
-        {"DD;", {0x02145}},                               //ⅅ
-        {"dd;", {0x02146}},                               //ⅆ
-        {"ddagger;", {0x02021}},                          //‡
-        {"ddarr;", {0x021CA}},                            //⇊
-        {"DDotrahd;", {0x02911}},                         //⤑
-        {"ddotseq;", {0x02A77}},                          //⩷
-        {"deg;", {0x000B0}},                              //°
-        {"deg", {0x000B0}},                               //°
-        {"Del;", {0x02207}},                              //∇
-        {"Delta;", {0x00394}},                            //Δ
-        {"delta;", {0x003B4}},                            //δ
-        {"demptyv;", {0x029B1}},                          //⦱
-        {"dfisht;", {0x0297F}},                           //⥿
-        {"Dfr;", {0x1D507}},                              //𝔇
-        {"dfr;", {0x1D521}},                              //𝔡
-        {"dHar;", {0x02965}},                             //⥥
-        {"dharl;", {0x021C3}},                            //⇃
-        {"dharr;", {0x021C2}},                            //⇂
-        {"DiacriticalAcute;", {0x000B4}},                 //´
-        {"DiacriticalDot;", {0x002D9}},                   //˙
-        {"DiacriticalDoubleAcute;", {0x002DD}},           //˝
-        {"DiacriticalGrave;", {0x00060}},                 //`
-        {"DiacriticalTilde;", {0x002DC}},                 //˜
-        {"diam;", {0x022C4}},                             //⋄
-        {"Diamond;", {0x022C4}},                          //⋄
-        {"diamond;", {0x022C4}},                          //⋄
-        {"diamondsuit;", {0x02666}},                      //♦
-        {"diams;", {0x02666}},                            //♦
-        {"die;", {0x000A8}},                              //¨
-        {"DifferentialD;", {0x02146}},                    //ⅆ
-        {"digamma;", {0x003DD}},                          //ϝ
-        {"disin;", {0x022F2}},                            //⋲
-        {"div;", {0x000F7}},                              //÷
-        {"divide;", {0x000F7}},                           //÷
-        {"divide", {0x000F7}},                            //÷
-        {"divideontimes;", {0x022C7}},                    //⋇
-        {"divonx;", {0x022C7}},                           //⋇
-        {"DJcy;", {0x00402}},                             //Ђ
-        {"djcy;", {0x00452}},                             //ђ
-        {"dlcorn;", {0x0231E}},                           //⌞
-        {"dlcrop;", {0x0230D}},                           //⌍
-        {"dollar;", {0x00024}},                           //$
-        {"Dopf;", {0x1D53B}},                             //𝔻
-        {"dopf;", {0x1D555}},                             //𝕕
-        {"Dot;", {0x000A8}},                              //¨
-        {"dot;", {0x002D9}},                              //˙
-        {"DotDot;", {0x020DC}},                           //◌⃜
-        {"doteq;", {0x02250}},                            //≐
-        {"doteqdot;", {0x02251}},                         //≑
-        {"DotEqual;", {0x02250}},                         //≐
-        {"dotminus;", {0x02238}},                         //∸
-        {"dotplus;", {0x02214}},                          //∔
-        {"dotsquare;", {0x022A1}},                        //⊡
-        {"doublebarwedge;", {0x02306}},                   //⌆
-        {"DoubleContourIntegral;", {0x0222F}},            //∯
-        {"DoubleDot;", {0x000A8}},                        //¨
-        {"DoubleDownArrow;", {0x021D3}},                  //⇓
-        {"DoubleLeftArrow;", {0x021D0}},                  //⇐
-        {"DoubleLeftRightArrow;", {0x021D4}},             //⇔
-        {"DoubleLeftTee;", {0x02AE4}},                    //⫤
-        {"DoubleLongLeftArrow;", {0x027F8}},              //⟸
-        {"DoubleLongLeftRightArrow;", {0x027FA}},         //⟺
-        {"DoubleLongRightArrow;", {0x027F9}},             //⟹
-        {"DoubleRightArrow;", {0x021D2}},                 //⇒
-        {"DoubleRightTee;", {0x022A8}},                   //⊨
-        {"DoubleUpArrow;", {0x021D1}},                    //⇑
-        {"DoubleUpDownArrow;", {0x021D5}},                //⇕
-        {"DoubleVerticalBar;", {0x02225}},                //∥
-        {"DownArrow;", {0x02193}},                        //↓
-        {"Downarrow;", {0x021D3}},                        //⇓
-        {"downarrow;", {0x02193}},                        //↓
-        {"DownArrowBar;", {0x02913}},                     //⤓
-        {"DownArrowUpArrow;", {0x021F5}},                 //⇵
-        {"DownBreve;", {0x00311}},                        //◌̑
-        {"downdownarrows;", {0x021CA}},                   //⇊
-        {"downharpoonleft;", {0x021C3}},                  //⇃
-        {"downharpoonright;", {0x021C2}},                 //⇂
-        {"DownLeftRightVector;", {0x02950}},              //⥐
-        {"DownLeftTeeVector;", {0x0295E}},                //⥞
-        {"DownLeftVector;", {0x021BD}},                   //↽
-        {"DownLeftVectorBar;", {0x02956}},                //⥖
-        {"DownRightTeeVector;", {0x0295F}},               //⥟
-        {"DownRightVector;", {0x021C1}},                  //⇁
-        {"DownRightVectorBar;", {0x02957}},               //⥗
-        {"DownTee;", {0x022A4}},                          //⊤
-        {"DownTeeArrow;", {0x021A7}},                     //↧
-        {"drbkarow;", {0x02910}},                         //⤐
-        {"drcorn;", {0x0231F}},                           //⌟
-        {"drcrop;", {0x0230C}},                           //⌌
-        {"Dscr;", {0x1D49F}},                             //𝒟
-        {"dscr;", {0x1D4B9}},                             //𝒹
-        {"DScy;", {0x00405}},                             //Ѕ
-        {"dscy;", {0x00455}},                             //ѕ
-        {"dsol;", {0x029F6}},                             //⧶
-        {"Dstrok;", {0x00110}},                           //Đ
-        {"dstrok;", {0x00111}},                           //đ
-        {"dtdot;", {0x022F1}},                            //⋱
-        {"dtri;", {0x025BF}},                             //▿
-        {"dtrif;", {0x025BE}},                            //▾
-        {"duarr;", {0x021F5}},                            //⇵
-        {"duhar;", {0x0296F}},                            //⥯
-        {"dwangle;", {0x029A6}},                          //⦦
-        {"DZcy;", {0x0040F}},                             //Џ
-        {"dzcy;", {0x0045F}},                             //џ
-        {"dzigrarr;", {0x027FF}},                         //⟿
-        {"Eacute;", {0x000C9}},                           //É
-        {"Eacute", {0x000C9}},                            //É
-        {"eacute;", {0x000E9}},                           //é
-        {"eacute", {0x000E9}},                            //é
-        {"easter;", {0x02A6E}},                           //⩮
-        {"Ecaron;", {0x0011A}},                           //Ě
-        {"ecaron;", {0x0011B}},                           //ě
-        {"ecir;", {0x02256}},                             //≖
-        {"Ecirc;", {0x000CA}},                            //Ê
-        {"Ecirc", {0x000CA}},                             //Ê
-        {"ecirc;", {0x000EA}},                            //ê
-        {"ecirc", {0x000EA}},                             //ê
-        {"ecolon;", {0x02255}},                           //≕
-        {"Ecy;", {0x0042D}},                              //Э
-        {"ecy;", {0x0044D}},                              //э
-        {"eDDot;", {0x02A77}},                            //⩷
-        {"Edot;", {0x00116}},                             //Ė
-        {"eDot;", {0x02251}},                             //≑
-        {"edot;", {0x00117}},                             //ė
-        {"ee;", {0x02147}},                               //ⅇ
-        {"efDot;", {0x02252}},                            //≒
-        {"Efr;", {0x1D508}},                              //𝔈
-        {"efr;", {0x1D522}},                              //𝔢
-        {"eg;", {0x02A9A}},                               //⪚
-        {"Egrave;", {0x000C8}},                           //È
-        {"Egrave", {0x000C8}},                            //È
-        {"egrave;", {0x000E8}},                           //è
-        {"egrave", {0x000E8}},                            //è
-        {"egs;", {0x02A96}},                              //⪖
-        {"egsdot;", {0x02A98}},                           //⪘
-        {"el;", {0x02A99}},                               //⪙
-        {"Element;", {0x02208}},                          //∈
-        {"elinters;", {0x023E7}},                         //⏧
-        {"ell;", {0x02113}},                              //ℓ
-        {"els;", {0x02A95}},                              //⪕
-        {"elsdot;", {0x02A97}},                           //⪗
-        {"Emacr;", {0x00112}},                            //Ē
-        {"emacr;", {0x00113}},                            //ē
-        {"empty;", {0x02205}},                            //∅
-        {"emptyset;", {0x02205}},                         //∅
-        {"EmptySmallSquare;", {0x025FB}},                 //◻
-        {"emptyv;", {0x02205}},                           //∅
-        {"EmptyVerySmallSquare;", {0x025AB}},             //▫
-        {"emsp;", {0x02003}},                             //emsp
-        {"emsp13;", {0x02004}},                           //emsp13
-        {"emsp14;", {0x02005}},                           //emsp14
-        {"ENG;", {0x0014A}},                              //Ŋ
-        {"eng;", {0x0014B}},                              //ŋ
-        {"ensp;", {0x02002}},                             //ensp
-        {"Eogon;", {0x00118}},                            //Ę
-        {"eogon;", {0x00119}},                            //ę
-        {"Eopf;", {0x1D53C}},                             //𝔼
-        {"eopf;", {0x1D556}},                             //𝕖
-        {"epar;", {0x022D5}},                             //⋕
-        {"eparsl;", {0x029E3}},                           //⧣
-        {"eplus;", {0x02A71}},                            //⩱
-        {"epsi;", {0x003B5}},                             //ε
-        {"Epsilon;", {0x00395}},                          //Ε
-        {"epsilon;", {0x003B5}},                          //ε
-        {"epsiv;", {0x003F5}},                            //ϵ
-        {"eqcirc;", {0x02256}},                           //≖
-        {"eqcolon;", {0x02255}},                          //≕
-        {"eqsim;", {0x02242}},                            //≂
-        {"eqslantgtr;", {0x02A96}},                       //⪖
-        {"eqslantless;", {0x02A95}},                      //⪕
-        {"Equal;", {0x02A75}},                            //⩵
-        {"equals;", {0x0003D}},                           //=
-        {"EqualTilde;", {0x02242}},                       //≂
-        {"equest;", {0x0225F}},                           //≟
-        {"Equilibrium;", {0x021CC}},                      //⇌
-        {"equiv;", {0x02261}},                            //≡
-        {"equivDD;", {0x02A78}},                          //⩸
-        {"eqvparsl;", {0x029E5}},                         //⧥
-        {"erarr;", {0x02971}},                            //⥱
-        {"erDot;", {0x02253}},                            //≓
-        {"Escr;", {0x02130}},                             //ℰ
-        {"escr;", {0x0212F}},                             //ℯ
-        {"esdot;", {0x02250}},                            //≐
-        {"Esim;", {0x02A73}},                             //⩳
-        {"esim;", {0x02242}},                             //≂
-        {"Eta;", {0x00397}},                              //Η
-        {"eta;", {0x003B7}},                              //η
-        {"ETH;", {0x000D0}},                              //Ð
-        {"ETH", {0x000D0}},                               //Ð
-        {"eth;", {0x000F0}},                              //ð
-        {"eth", {0x000F0}},                               //ð
-        {"Euml;", {0x000CB}},                             //Ë
-        {"Euml", {0x000CB}},                              //Ë
-        {"euml;", {0x000EB}},                             //ë
-        {"euml", {0x000EB}},                              //ë
-        {"euro;", {0x020AC}},                             //€
-        {"excl;", {0x00021}},                             //!
-        {"exist;", {0x02203}},                            //∃
-        {"Exists;", {0x02203}},                           //∃
-        {"expectation;", {0x02130}},                      //ℰ
-        {"ExponentialE;", {0x02147}},                     //ⅇ
-        {"exponentiale;", {0x02147}},                     //ⅇ
-        {"fallingdotseq;", {0x02252}},                    //≒
-        {"Fcy;", {0x00424}},                              //Ф
-        {"fcy;", {0x00444}},                              //ф
-        {"female;", {0x02640}},                           //♀
-        {"ffilig;", {0x0FB03}},                           //ﬃ
-        {"fflig;", {0x0FB00}},                            //ﬀ
-        {"ffllig;", {0x0FB04}},                           //ﬄ
-        {"Ffr;", {0x1D509}},                              //𝔉
-        {"ffr;", {0x1D523}},                              //𝔣
-        {"filig;", {0x0FB01}},                            //ﬁ
-        {"FilledSmallSquare;", {0x025FC}},                //◼
-        {"FilledVerySmallSquare;", {0x025AA}},            //▪
-        {"fjlig;", {0x00066, 0x0006A}},                   //fjlig;
-        {"flat;", {0x0266D}},                             //♭
-        {"fllig;", {0x0FB02}},                            //ﬂ
-        {"fltns;", {0x025B1}},                            //▱
-        {"fnof;", {0x00192}},                             //ƒ
-        {"Fopf;", {0x1D53D}},                             //𝔽
-        {"fopf;", {0x1D557}},                             //𝕗
-        {"ForAll;", {0x02200}},                           //∀
-        {"forall;", {0x02200}},                           //∀
-        {"fork;", {0x022D4}},                             //⋔
-        {"forkv;", {0x02AD9}},                            //⫙
-        {"Fouriertrf;", {0x02131}},                       //ℱ
-        {"fpartint;", {0x02A0D}},                         //⨍
-        {"frac12;", {0x000BD}},                           //½
-        {"frac12", {0x000BD}},                            //½
-        {"frac13;", {0x02153}},                           //⅓
-        {"frac14;", {0x000BC}},                           //¼
-        {"frac14", {0x000BC}},                            //¼
-        {"frac15;", {0x02155}},                           //⅕
-        {"frac16;", {0x02159}},                           //⅙
-        {"frac18;", {0x0215B}},                           //⅛
-        {"frac23;", {0x02154}},                           //⅔
-        {"frac25;", {0x02156}},                           //⅖
-        {"frac34;", {0x000BE}},                           //¾
-        {"frac34", {0x000BE}},                            //¾
-        {"frac35;", {0x02157}},                           //⅗
-        {"frac38;", {0x0215C}},                           //⅜
-        {"frac45;", {0x02158}},                           //⅘
-        {"frac56;", {0x0215A}},                           //⅚
-        {"frac58;", {0x0215D}},                           //⅝
-        {"frac78;", {0x0215E}},                           //⅞
-        {"frasl;", {0x02044}},                            //⁄
-        {"frown;", {0x02322}},                            //⌢
-        {"Fscr;", {0x02131}},                             //ℱ
-        {"fscr;", {0x1D4BB}},                             //𝒻
-        {"gacute;", {0x001F5}},                           //ǵ
-        {"Gamma;", {0x00393}},                            //Γ
-        {"gamma;", {0x003B3}},                            //γ
-        {"Gammad;", {0x003DC}},                           //Ϝ
-        {"gammad;", {0x003DD}},                           //ϝ
-        {"gap;", {0x02A86}},                              //⪆
-        {"Gbreve;", {0x0011E}},                           //Ğ
-        {"gbreve;", {0x0011F}},                           //ğ
-        {"Gcedil;", {0x00122}},                           //Ģ
-        {"Gcirc;", {0x0011C}},                            //Ĝ
-        {"gcirc;", {0x0011D}},                            //ĝ
-        {"Gcy;", {0x00413}},                              //Г
-        {"gcy;", {0x00433}},                              //г
-        {"Gdot;", {0x00120}},                             //Ġ
-        {"gdot;", {0x00121}},                             //ġ
-        {"gE;", {0x02267}},                               //≧
-        {"ge;", {0x02265}},                               //≥
-        {"gEl;", {0x02A8C}},                              //⪌
-        {"gel;", {0x022DB}},                              //⋛
-        {"geq;", {0x02265}},                              //≥
-        {"geqq;", {0x02267}},                             //≧
-        {"geqslant;", {0x02A7E}},                         //⩾
-        {"ges;", {0x02A7E}},                              //⩾
-        {"gescc;", {0x02AA9}},                            //⪩
-        {"gesdot;", {0x02A80}},                           //⪀
-        {"gesdoto;", {0x02A82}},                          //⪂
-        {"gesdotol;", {0x02A84}},                         //⪄
-        {"gesl;", {0x022DB, 0x0FE00}},                    //gesl;
-        {"gesles;", {0x02A94}},                           //⪔
-        {"Gfr;", {0x1D50A}},                              //𝔊
-        {"gfr;", {0x1D524}},                              //𝔤
-        {"Gg;", {0x022D9}},                               //⋙
-        {"gg;", {0x0226B}},                               //≫
-        {"ggg;", {0x022D9}},                              //⋙
-        {"gimel;", {0x02137}},                            //ℷ
-        {"GJcy;", {0x00403}},                             //Ѓ
-        {"gjcy;", {0x00453}},                             //ѓ
-        {"gl;", {0x02277}},                               //≷
-        {"gla;", {0x02AA5}},                              //⪥
-        {"glE;", {0x02A92}},                              //⪒
-        {"glj;", {0x02AA4}},                              //⪤
-        {"gnap;", {0x02A8A}},                             //⪊
-        {"gnapprox;", {0x02A8A}},                         //⪊
-        {"gnE;", {0x02269}},                              //≩
-        {"gne;", {0x02A88}},                              //⪈
-        {"gneq;", {0x02A88}},                             //⪈
-        {"gneqq;", {0x02269}},                            //≩
-        {"gnsim;", {0x022E7}},                            //⋧
-        {"Gopf;", {0x1D53E}},                             //𝔾
-        {"gopf;", {0x1D558}},                             //𝕘
-        {"grave;", {0x00060}},                            //`
-        {"GreaterEqual;", {0x02265}},                     //≥
-        {"GreaterEqualLess;", {0x022DB}},                 //⋛
-        {"GreaterFullEqual;", {0x02267}},                 //≧
-        {"GreaterGreater;", {0x02AA2}},                   //⪢
-        {"GreaterLess;", {0x02277}},                      //≷
-        {"GreaterSlantEqual;", {0x02A7E}},                //⩾
-        {"GreaterTilde;", {0x02273}},                     //≳
-        {"Gscr;", {0x1D4A2}},                             //𝒢
-        {"gscr;", {0x0210A}},                             //ℊ
-        {"gsim;", {0x02273}},                             //≳
-        {"gsime;", {0x02A8E}},                            //⪎
-        {"gsiml;", {0x02A90}},                            //⪐
-        {"GT;", {0x0003E}},                               //>
-        {"GT", {0x0003E}},                                //>
-        {"Gt;", {0x0226B}},                               //≫
-        {"gt;", {0x0003E}},                               //>
-        {"gt", {0x0003E}},                                //>
-        {"gtcc;", {0x02AA7}},                             //⪧
-        {"gtcir;", {0x02A7A}},                            //⩺
-        {"gtdot;", {0x022D7}},                            //⋗
-        {"gtlPar;", {0x02995}},                           //⦕
-        {"gtquest;", {0x02A7C}},                          //⩼
-        {"gtrapprox;", {0x02A86}},                        //⪆
-        {"gtrarr;", {0x02978}},                           //⥸
-        {"gtrdot;", {0x022D7}},                           //⋗
-        {"gtreqless;", {0x022DB}},                        //⋛
-        {"gtreqqless;", {0x02A8C}},                       //⪌
-        {"gtrless;", {0x02277}},                          //≷
-        {"gtrsim;", {0x02273}},                           //≳
-        {"gvertneqq;", {0x02269, 0x0FE00}},               //gvertneqq;
-        {"gvnE;", {0x02269, 0x0FE00}},                    //gvnE;
-        {"Hacek;", {0x002C7}},                            //ˇ
-        {"hairsp;", {}},                                  //hairsp;
-        {"half;", {0x000BD}},                             //½
-        {"hamilt;", {0x0210B}},                           //ℋ
-        {"HARDcy;", {0x0042A}},                           //Ъ
-        {"hardcy;", {0x0044A}},                           //ъ
-        {"hArr;", {0x021D4}},                             //⇔
-        {"harr;", {0x02194}},                             //↔
-        {"harrcir;", {0x02948}},                          //⥈
-        {"harrw;", {0x021AD}},                            //↭
-        {"Hat;", {0x0005E}},                              //^
-        {"hbar;", {0x0210F}},                             //ℏ
-        {"Hcirc;", {0x00124}},                            //Ĥ
-        {"hcirc;", {0x00125}},                            //ĥ
-        {"hearts;", {0x02665}},                           //♥
-        {"heartsuit;", {0x02665}},                        //♥
-        {"hellip;", {0x02026}},                           //…
-        {"hercon;", {0x022B9}},                           //⊹
-        {"Hfr;", {0x0210C}},                              //ℌ
-        {"hfr;", {0x1D525}},                              //𝔥
-        {"HilbertSpace;", {0x0210B}},                     //ℋ
-        {"hksearow;", {0x02925}},                         //⤥
-        {"hkswarow;", {0x02926}},                         //⤦
-        {"hoarr;", {0x021FF}},                            //⇿
-        {"homtht;", {0x0223B}},                           //∻
-        {"hookleftarrow;", {0x021A9}},                    //↩
-        {"hookrightarrow;", {0x021AA}},                   //↪
-        {"Hopf;", {0x0210D}},                             //ℍ
-        {"hopf;", {0x1D559}},                             //𝕙
-        {"horbar;", {0x02015}},                           //―
-        {"HorizontalLine;", {0x02500}},                   //─
-        {"Hscr;", {0x0210B}},                             //ℋ
-        {"hscr;", {0x1D4BD}},                             //𝒽
-        {"hslash;", {0x0210F}},                           //ℏ
-        {"Hstrok;", {0x00126}},                           //Ħ
-        {"hstrok;", {0x00127}},                           //ħ
-        {"HumpDownHump;", {0x0224E}},                     //≎
-        {"HumpEqual;", {0x0224F}},                        //≏
-        {"hybull;", {0x02043}},                           //⁃
-        {"hyphen;", {0x02010}},                           //‐
-        {"Iacute;", {0x000CD}},                           //Í
-        {"Iacute", {0x000CD}},                            //Í
-        {"iacute;", {0x000ED}},                           //í
-        {"iacute", {0x000ED}},                            //í
-        {"ic;", {0x02063}},                               //⁣
-        {"Icirc;", {0x000CE}},                            //Î
-        {"Icirc", {0x000CE}},                             //Î
-        {"icirc;", {0x000EE}},                            //î
-        {"icirc", {0x000EE}},                             //î
-        {"Icy;", {0x00418}},                              //И
-        {"icy;", {0x00438}},                              //и
-        {"Idot;", {0x00130}},                             //İ
-        {"IEcy;", {0x00415}},                             //Е
-        {"iecy;", {0x00435}},                             //е
-        {"iexcl;", {0x000A1}},                            //¡
-        {"iexcl", {0x000A1}},                             //¡
-        {"iff;", {0x021D4}},                              //⇔
-        {"Ifr;", {0x02111}},                              //ℑ
-        {"ifr;", {0x1D526}},                              //𝔦
-        {"Igrave;", {0x000CC}},                           //Ì
-        {"Igrave", {0x000CC}},                            //Ì
-        {"igrave;", {0x000EC}},                           //ì
-        {"igrave", {0x000EC}},                            //ì
-        {"ii;", {0x02148}},                               //ⅈ
-        {"iiiint;", {0x02A0C}},                           //⨌
-        {"iiint;", {0x0222D}},                            //∭
-        {"iinfin;", {0x029DC}},                           //⧜
-        {"iiota;", {0x02129}},                            //℩
-        {"IJlig;", {0x00132}},                            //Ĳ
-        {"ijlig;", {0x00133}},                            //ĳ
-        {"Im;", {0x02111}},                               //ℑ
-        {"Imacr;", {0x0012A}},                            //Ī
-        {"imacr;", {0x0012B}},                            //ī
-        {"image;", {0x02111}},                            //ℑ
-        {"ImaginaryI;", {0x02148}},                       //ⅈ
-        {"imagline;", {0x02110}},                         //ℐ
-        {"imagpart;", {0x02111}},                         //ℑ
-        {"imath;", {0x00131}},                            //ı
-        {"imof;", {0x022B7}},                             //⊷
-        {"imped;", {0x001B5}},                            //Ƶ
-        {"Implies;", {0x021D2}},                          //⇒
-        {"in;", {0x02208}},                               //∈
-        {"incare;", {0x02105}},                           //℅
-        {"infin;", {0x0221E}},                            //∞
-        {"infintie;", {0x029DD}},                         //⧝
-        {"inodot;", {0x00131}},                           //ı
-        {"Int;", {0x0222C}},                              //∬
-        {"int;", {0x0222B}},                              //∫
-        {"intcal;", {0x022BA}},                           //⊺
-        {"integers;", {0x02124}},                         //ℤ
-        {"Integral;", {0x0222B}},                         //∫
-        {"intercal;", {0x022BA}},                         //⊺
-        {"Intersection;", {0x022C2}},                     //⋂
-        {"intlarhk;", {0x02A17}},                         //⨗
-        {"intprod;", {0x02A3C}},                          //⨼
-        {"InvisibleComma;", {0x02063}},                   //⁣
-        {"InvisibleTimes;", {0x02062}},                   //⁢
-        {"IOcy;", {0x00401}},                             //Ё
-        {"iocy;", {0x00451}},                             //ё
-        {"Iogon;", {0x0012E}},                            //Į
-        {"iogon;", {0x0012F}},                            //į
-        {"Iopf;", {0x1D540}},                             //𝕀
-        {"iopf;", {0x1D55A}},                             //𝕚
-        {"Iota;", {0x00399}},                             //Ι
-        {"iota;", {0x003B9}},                             //ι
-        {"iprod;", {0x02A3C}},                            //⨼
-        {"iquest;", {0x000BF}},                           //¿
-        {"iquest", {0x000BF}},                            //¿
-        {"Iscr;", {0x02110}},                             //ℐ
-        {"iscr;", {0x1D4BE}},                             //𝒾
-        {"isin;", {0x02208}},                             //∈
-        {"isindot;", {0x022F5}},                          //⋵
-        {"isinE;", {0x022F9}},                            //⋹
-        {"isins;", {0x022F4}},                            //⋴
-        {"isinsv;", {0x022F3}},                           //⋳
-        {"isinv;", {0x02208}},                            //∈
-        {"it;", {0x02062}},                               //⁢
-        {"Itilde;", {0x00128}},                           //Ĩ
-        {"itilde;", {0x00129}},                           //ĩ
-        {"Iukcy;", {0x00406}},                            //І
-        {"iukcy;", {0x00456}},                            //і
-        {"Iuml;", {0x000CF}},                             //Ï
-        {"Iuml", {0x000CF}},                              //Ï
-        {"iuml;", {0x000EF}},                             //ï
-        {"iuml", {0x000EF}},                              //ï
-        {"Jcirc;", {0x00134}},                            //Ĵ
-        {"jcirc;", {0x00135}},                            //ĵ
-        {"Jcy;", {0x00419}},                              //Й
-        {"jcy;", {0x00439}},                              //й
-        {"Jfr;", {0x1D50D}},                              //𝔍
-        {"jfr;", {0x1D527}},                              //𝔧
-        {"jmath;", {0x00237}},                            //ȷ
-        {"Jopf;", {0x1D541}},                             //𝕁
-        {"jopf;", {0x1D55B}},                             //𝕛
-        {"Jscr;", {0x1D4A5}},                             //𝒥
-        {"jscr;", {0x1D4BF}},                             //𝒿
-        {"Jsercy;", {0x00408}},                           //Ј
-        {"jsercy;", {0x00458}},                           //ј
-        {"Jukcy;", {0x00404}},                            //Є
-        {"jukcy;", {0x00454}},                            //є
-        {"Kappa;", {0x0039A}},                            //Κ
-        {"kappa;", {0x003BA}},                            //κ
-        {"kappav;", {0x003F0}},                           //ϰ
-        {"Kcedil;", {0x00136}},                           //Ķ
-        {"kcedil;", {0x00137}},                           //ķ
-        {"Kcy;", {0x0041A}},                              //К
-        {"kcy;", {0x0043A}},                              //к
-        {"Kfr;", {0x1D50E}},                              //𝔎
-        {"kfr;", {0x1D528}},                              //𝔨
-        {"kgreen;", {0x00138}},                           //ĸ
-        {"KHcy;", {0x00425}},                             //Х
-        {"khcy;", {0x00445}},                             //х
-        {"KJcy;", {0x0040C}},                             //Ќ
-        {"kjcy;", {0x0045C}},                             //ќ
-        {"Kopf;", {0x1D542}},                             //𝕂
-        {"kopf;", {0x1D55C}},                             //𝕜
-        {"Kscr;", {0x1D4A6}},                             //𝒦
-        {"kscr;", {0x1D4C0}},                             //𝓀
-        {"lAarr;", {0x021DA}},                            //⇚
-        {"Lacute;", {0x00139}},                           //Ĺ
-        {"lacute;", {0x0013A}},                           //ĺ
-        {"laemptyv;", {0x029B4}},                         //⦴
-        {"lagran;", {0x02112}},                           //ℒ
-        {"Lambda;", {0x0039B}},                           //Λ
-        {"lambda;", {0x003BB}},                           //λ
-        {"Lang;", {0x027EA}},                             //⟪
-        {"lang;", {0x027E8}},                             //⟨
-        {"langd;", {0x02991}},                            //⦑
-        {"langle;", {0x027E8}},                           //〈
-        {"lap;", {0x02A85}},                              //⪅
-        {"Laplacetrf;", {0x02112}},                       //ℒ
-        {"laquo;", {0x000AB}},                            //«
-        {"laquo", {0x000AB}},                             //«
-        {"Larr;", {0x0219E}},                             //↞
-        {"lArr;", {0x021D0}},                             //⇐
-        {"larr;", {0x02190}},                             //←
-        {"larrb;", {0x021E4}},                            //⇤
-        {"larrbfs;", {0x0291F}},                          //⤟
-        {"larrfs;", {0x0291D}},                           //⤝
-        {"larrhk;", {0x021A9}},                           //↩
-        {"larrlp;", {0x021AB}},                           //↫
-        {"larrpl;", {0x02939}},                           //⤹
-        {"larrsim;", {0x02973}},                          //⥳
-        {"larrtl;", {0x021A2}},                           //↢
-        {"lat;", {0x02AAB}},                              //⪫
-        {"lAtail;", {0x0291B}},                           //⤛
-        {"latail;", {0x02919}},                           //⤙
-        {"late;", {0x02AAD}},                             //⪭
-        {"lates;", {0x02AAD, 0x0FE00}},                   //lates;
-        {"lBarr;", {0x0290E}},                            //⤎
-        {"lbarr;", {0x0290C}},                            //⤌
-        {"lbbrk;", {0x02772}},                            //❲
-        {"lbrace;", {0x0007B}},                           //{
-        {"lbrack;", {0x0005B}},                           //[
-        {"lbrke;", {0x0298B}},                            //⦋
-        {"lbrksld;", {0x0298F}},                          //⦏
-        {"lbrkslu;", {0x0298D}},                          //⦍
-        {"Lcaron;", {0x0013D}},                           //Ľ
-        {"lcaron;", {0x0013E}},                           //ľ
-        {"Lcedil;", {0x0013B}},                           //Ļ
-        {"lcedil;", {0x0013C}},                           //ļ
-        {"lceil;", {0x02308}},                            //⌈
-        {"lcub;", {0x0007B}},                             //{
-        {"Lcy;", {0x0041B}},                              //Л
-        {"lcy;", {0x0043B}},                              //л
-        {"ldca;", {0x02936}},                             //⤶
-        {"ldquo;", {0x0201C}},                            //“
-        {"ldquor;", {0x0201E}},                           //„
-        {"ldrdhar;", {0x02967}},                          //⥧
-        {"ldrushar;", {0x0294B}},                         //⥋
-        {"ldsh;", {0x021B2}},                             //↲
-        {"lE;", {0x02266}},                               //≦
-        {"le;", {0x02264}},                               //≤
-        {"LeftAngleBracket;", {0x027E8}},                 //〈
-        {"LeftArrow;", {0x02190}},                        //←
-        {"Leftarrow;", {0x021D0}},                        //⇐
-        {"leftarrow;", {0x02190}},                        //←
-        {"LeftArrowBar;", {0x021E4}},                     //⇤
-        {"LeftArrowRightArrow;", {0x021C6}},              //⇆
-        {"leftarrowtail;", {0x021A2}},                    //↢
-        {"LeftCeiling;", {0x02308}},                      //⌈
-        {"LeftDoubleBracket;", {0x027E6}},                //⟦
-        {"LeftDownTeeVector;", {0x02961}},                //⥡
-        {"LeftDownVector;", {0x021C3}},                   //⇃
-        {"LeftDownVectorBar;", {0x02959}},                //⥙
-        {"LeftFloor;", {0x0230A}},                        //⌊
-        {"leftharpoondown;", {0x021BD}},                  //↽
-        {"leftharpoonup;", {0x021BC}},                    //↼
-        {"leftleftarrows;", {0x021C7}},                   //⇇
-        {"LeftRightArrow;", {0x02194}},                   //↔
-        {"Leftrightarrow;", {0x021D4}},                   //⇔
-        {"leftrightarrow;", {0x02194}},                   //↔
-        {"leftrightarrows;", {0x021C6}},                  //⇆
-        {"leftrightharpoons;", {0x021CB}},                //⇋
-        {"leftrightsquigarrow;", {0x021AD}},              //↭
-        {"LeftRightVector;", {0x0294E}},                  //⥎
-        {"LeftTee;", {0x022A3}},                          //⊣
-        {"LeftTeeArrow;", {0x021A4}},                     //↤
-        {"LeftTeeVector;", {0x0295A}},                    //⥚
-        {"leftthreetimes;", {0x022CB}},                   //⋋
-        {"LeftTriangle;", {0x022B2}},                     //⊲
-        {"LeftTriangleBar;", {0x029CF}},                  //⧏
-        {"LeftTriangleEqual;", {0x022B4}},                //⊴
-        {"LeftUpDownVector;", {0x02951}},                 //⥑
-        {"LeftUpTeeVector;", {0x02960}},                  //⥠
-        {"LeftUpVector;", {0x021BF}},                     //↿
-        {"LeftUpVectorBar;", {0x02958}},                  //⥘
-        {"LeftVector;", {0x021BC}},                       //↼
-        {"LeftVectorBar;", {0x02952}},                    //⥒
-        {"lEg;", {0x02A8B}},                              //⪋
-        {"leg;", {0x022DA}},                              //⋚
-        {"leq;", {0x02264}},                              //≤
-        {"leqq;", {0x02266}},                             //≦
-        {"leqslant;", {0x02A7D}},                         //⩽
-        {"les;", {0x02A7D}},                              //⩽
-        {"lescc;", {0x02AA8}},                            //⪨
-        {"lesdot;", {0x02A7F}},                           //⩿
-        {"lesdoto;", {0x02A81}},                          //⪁
-        {"lesdotor;", {0x02A83}},                         //⪃
-        {"lesg;", {0x022DA, 0x0FE00}},                    //lesg;
-        {"lesges;", {0x02A93}},                           //⪓
-        {"lessapprox;", {0x02A85}},                       //⪅
-        {"lessdot;", {0x022D6}},                          //⋖
-        {"lesseqgtr;", {0x022DA}},                        //⋚
-        {"lesseqqgtr;", {0x02A8B}},                       //⪋
-        {"LessEqualGreater;", {0x022DA}},                 //⋚
-        {"LessFullEqual;", {0x02266}},                    //≦
-        {"LessGreater;", {0x02276}},                      //≶
-        {"lessgtr;", {0x02276}},                          //≶
-        {"LessLess;", {0x02AA1}},                         //⪡
-        {"lesssim;", {0x02272}},                          //≲
-        {"LessSlantEqual;", {0x02A7D}},                   //⩽
-        {"LessTilde;", {0x02272}},                        //≲
-        {"lfisht;", {0x0297C}},                           //⥼
-        {"lfloor;", {0x0230A}},                           //⌊
-        {"Lfr;", {0x1D50F}},                              //𝔏
-        {"lfr;", {0x1D529}},                              //𝔩
-        {"lg;", {0x02276}},                               //≶
-        {"lgE;", {0x02A91}},                              //⪑
-        {"lHar;", {0x02962}},                             //⥢
-        {"lhard;", {0x021BD}},                            //↽
-        {"lharu;", {0x021BC}},                            //↼
-        {"lharul;", {0x0296A}},                           //⥪
-        {"lhblk;", {0x02584}},                            //▄
-        {"LJcy;", {0x00409}},                             //Љ
-        {"ljcy;", {0x00459}},                             //љ
-        {"Ll;", {0x022D8}},                               //⋘
-        {"ll;", {0x0226A}},                               //≪
-        {"llarr;", {0x021C7}},                            //⇇
-        {"llcorner;", {0x0231E}},                         //⌞
-        {"Lleftarrow;", {0x021DA}},                       //⇚
-        {"llhard;", {0x0296B}},                           //⥫
-        {"lltri;", {0x025FA}},                            //◺
-        {"Lmidot;", {0x0013F}},                           //Ŀ
-        {"lmidot;", {0x00140}},                           //ŀ
-        {"lmoust;", {0x023B0}},                           //⎰
-        {"lmoustache;", {0x023B0}},                       //⎰
-        {"lnap;", {0x02A89}},                             //⪉
-        {"lnapprox;", {0x02A89}},                         //⪉
-        {"lnE;", {0x02268}},                              //≨
-        {"lne;", {0x02A87}},                              //⪇
-        {"lneq;", {0x02A87}},                             //⪇
-        {"lneqq;", {0x02268}},                            //≨
-        {"lnsim;", {0x022E6}},                            //⋦
-        {"loang;", {0x027EC}},                            //⟬
-        {"loarr;", {0x021FD}},                            //⇽
-        {"lobrk;", {0x027E6}},                            //⟦
-        {"LongLeftArrow;", {0x027F5}},                    //⟵
-        {"Longleftarrow;", {0x027F8}},                    //⟸
-        {"longleftarrow;", {0x027F5}},                    //⟵
-        {"LongLeftRightArrow;", {0x027F7}},               //⟷
-        {"Longleftrightarrow;", {0x027FA}},               //⟺
-        {"longleftrightarrow;", {0x027F7}},               //⟷
-        {"longmapsto;", {0x027FC}},                       //⟼
-        {"LongRightArrow;", {0x027F6}},                   //⟶
-        {"Longrightarrow;", {0x027F9}},                   //⟹
-        {"longrightarrow;", {0x027F6}},                   //⟶
-        {"looparrowleft;", {0x021AB}},                    //↫
-        {"looparrowright;", {0x021AC}},                   //↬
-        {"lopar;", {0x02985}},                            //⦅
-        {"Lopf;", {0x1D543}},                             //𝕃
-        {"lopf;", {0x1D55D}},                             //𝕝
-        {"loplus;", {0x02A2D}},                           //⨭
-        {"lotimes;", {0x02A34}},                          //⨴
-        {"lowast;", {0x02217}},                           //∗
-        {"lowbar;", {0x0005F}},                           //_
-        {"LowerLeftArrow;", {0x02199}},                   //↙
-        {"LowerRightArrow;", {0x02198}},                  //↘
-        {"loz;", {0x025CA}},                              //◊
-        {"lozenge;", {0x025CA}},                          //◊
-        {"lozf;", {0x029EB}},                             //⧫
-        {"lpar;", {0x00028}},                             //(
-        {"lparlt;", {0x02993}},                           //⦓
-        {"lrarr;", {0x021C6}},                            //⇆
-        {"lrcorner;", {0x0231F}},                         //⌟
-        {"lrhar;", {0x021CB}},                            //⇋
-        {"lrhard;", {0x0296D}},                           //⥭
-        {"lrm;", {0x0200E}},                              //‎
-        {"lrtri;", {0x022BF}},                            //⊿
-        {"lsaquo;", {0x02039}},                           //‹
-        {"Lscr;", {0x02112}},                             //ℒ
-        {"lscr;", {0x1D4C1}},                             //𝓁
-        {"Lsh;", {0x021B0}},                              //↰
-        {"lsh;", {0x021B0}},                              //↰
-        {"lsim;", {0x02272}},                             //≲
-        {"lsime;", {0x02A8D}},                            //⪍
-        {"lsimg;", {0x02A8F}},                            //⪏
-        {"lsqb;", {0x0005B}},                             //[
-        {"lsquo;", {0x02018}},                            //‘
-        {"lsquor;", {0x0201A}},                           //‚
-        {"Lstrok;", {0x00141}},                           //Ł
-        {"lstrok;", {0x00142}},                           //ł
-        {"LT;", {0x0003C}},                               //<
-        {"LT", {0x0003C}},                                //<
-        {"Lt;", {0x0226A}},                               //≪
-        {"lt;", {0x0003C}},                               //<
-        {"lt", {0x0003C}},                                //<
-        {"ltcc;", {0x02AA6}},                             //⪦
-        {"ltcir;", {0x02A79}},                            //⩹
-        {"ltdot;", {0x022D6}},                            //⋖
-        {"lthree;", {0x022CB}},                           //⋋
-        {"ltimes;", {0x022C9}},                           //⋉
-        {"ltlarr;", {0x02976}},                           //⥶
-        {"ltquest;", {0x02A7B}},                          //⩻
-        {"ltri;", {0x025C3}},                             //◃
-        {"ltrie;", {0x022B4}},                            //⊴
-        {"ltrif;", {0x025C2}},                            //◂
-        {"ltrPar;", {0x02996}},                           //⦖
-        {"lurdshar;", {0x0294A}},                         //⥊
-        {"luruhar;", {0x02966}},                          //⥦
-        {"lvertneqq;", {0x02268, 0x0FE00}},               //lvertneqq;
-        {"lvnE;", {0x02268, 0x0FE00}},                    //lvnE;
-        {"macr;", {0x000AF}},                             //¯
-        {"macr", {0x000AF}},                              //¯
-        {"male;", {0x02642}},                             //♂
-        {"malt;", {0x02720}},                             //✠
-        {"maltese;", {0x02720}},                          //✠
-        {"Map;", {0x02905}},                              //⤅
-        {"map;", {0x021A6}},                              //↦
-        {"mapsto;", {0x021A6}},                           //↦
-        {"mapstodown;", {0x021A7}},                       //↧
-        {"mapstoleft;", {0x021A4}},                       //↤
-        {"mapstoup;", {0x021A5}},                         //↥
-        {"marker;", {0x025AE}},                           //▮
-        {"mcomma;", {0x02A29}},                           //⨩
-        {"Mcy;", {0x0041C}},                              //М
-        {"mcy;", {0x0043C}},                              //м
-        {"mdash;", {0x02014}},                            //—
-        {"mDDot;", {0x0223A}},                            //∺
-        {"measuredangle;", {0x02221}},                    //∡
-        {"MediumSpace;", {}},                             //MediumSpace;
-        {"Mellintrf;", {0x02133}},                        //ℳ
-        {"Mfr;", {0x1D510}},                              //𝔐
-        {"mfr;", {0x1D52A}},                              //𝔪
-        {"mho;", {0x02127}},                              //℧
-        {"micro;", {0x000B5}},                            //µ
-        {"micro", {0x000B5}},                             //µ
-        {"mid;", {0x02223}},                              //∣
-        {"midast;", {0x0002A}},                           //*
-        {"midcir;", {0x02AF0}},                           //⫰
-        {"middot;", {0x000B7}},                           //·
-        {"middot", {0x000B7}},                            //·
-        {"minus;", {0x02212}},                            //−
-        {"minusb;", {0x0229F}},                           //⊟
-        {"minusd;", {0x02238}},                           //∸
-        {"minusdu;", {0x02A2A}},                          //⨪
-        {"MinusPlus;", {0x02213}},                        //∓
-        {"mlcp;", {0x02ADB}},                             //⫛
-        {"mldr;", {0x02026}},                             //…
-        {"mnplus;", {0x02213}},                           //∓
-        {"models;", {0x022A7}},                           //⊧
-        {"Mopf;", {0x1D544}},                             //𝕄
-        {"mopf;", {0x1D55E}},                             //𝕞
-        {"mp;", {0x02213}},                               //∓
-        {"Mscr;", {0x02133}},                             //ℳ
-        {"mscr;", {0x1D4C2}},                             //𝓂
-        {"mstpos;", {0x0223E}},                           //∾
-        {"Mu;", {0x0039C}},                               //Μ
-        {"mu;", {0x003BC}},                               //μ
-        {"multimap;", {0x022B8}},                         //⊸
-        {"mumap;", {0x022B8}},                            //⊸
-        {"nabla;", {0x02207}},                            //∇
-        {"Nacute;", {0x00143}},                           //Ń
-        {"nacute;", {0x00144}},                           //ń
-        {"nang;", {0x02220, 0x020D2}},                    //nang;
-        {"nap;", {0x02249}},                              //≉
-        {"napE;", {0x02A70, 0x00338}},                    //napE;
-        {"napid;", {0x0224B, 0x00338}},                   //napid;
-        {"napos;", {0x00149}},                            //ŉ
-        {"napprox;", {0x02249}},                          //≉
-        {"natur;", {0x0266E}},                            //♮
-        {"natural;", {0x0266E}},                          //♮
-        {"naturals;", {0x02115}},                         //ℕ
-        {"nbsp;", {}},                                    //nbsp;
-        {"nbsp", {}},                                     //nbsp
-        {"nbump;", {0x0224E, 0x00338}},                   //nbump;
-        {"nbumpe;", {0x0224F, 0x00338}},                  //nbumpe;
-        {"ncap;", {0x02A43}},                             //⩃
-        {"Ncaron;", {0x00147}},                           //Ň
-        {"ncaron;", {0x00148}},                           //ň
-        {"Ncedil;", {0x00145}},                           //Ņ
-        {"ncedil;", {0x00146}},                           //ņ
-        {"ncong;", {0x02247}},                            //≇
-        {"ncongdot;", {0x02A6D, 0x00338}},                //ncongdot;
-        {"ncup;", {0x02A42}},                             //⩂
-        {"Ncy;", {0x0041D}},                              //Н
-        {"ncy;", {0x0043D}},                              //н
-        {"ndash;", {0x02013}},                            //–
-        {"ne;", {0x02260}},                               //≠
-        {"nearhk;", {0x02924}},                           //⤤
-        {"neArr;", {0x021D7}},                            //⇗
-        {"nearr;", {0x02197}},                            //↗
-        {"nearrow;", {0x02197}},                          //↗
-        {"nedot;", {0x02250, 0x00338}},                   //nedot;
-        {"NegativeMediumSpace;", {0x0200B}},              //​
-        {"NegativeThickSpace;", {0x0200B}},               //​
-        {"NegativeThinSpace;", {0x0200B}},                //​
-        {"NegativeVeryThinSpace;", {0x0200B}},            //​
-        {"nequiv;", {0x02262}},                           //≢
-        {"nesear;", {0x02928}},                           //⤨
-        {"nesim;", {0x02242, 0x00338}},                   //nesim;
-        {"NestedGreaterGreater;", {0x0226B}},             //≫
-        {"NestedLessLess;", {0x0226A}},                   //≪
-        {"NewLine;", {0x0000A}},                          //␊
-        {"nexist;", {0x02204}},                           //∄
-        {"nexists;", {0x02204}},                          //∄
-        {"Nfr;", {0x1D511}},                              //𝔑
-        {"nfr;", {0x1D52B}},                              //𝔫
-        {"ngE;", {0x02267, 0x00338}},                     //ngE;
-        {"nge;", {0x02271}},                              //≱
-        {"ngeq;", {0x02271}},                             //≱
-        {"ngeqq;", {0x02267, 0x00338}},                   //ngeqq;
-        {"ngeqslant;", {0x02A7E, 0x00338}},               //ngeqslant;
-        {"nges;", {0x02A7E, 0x00338}},                    //nges;
-        {"nGg;", {0x022D9, 0x00338}},                     //nGg;
-        {"ngsim;", {0x02275}},                            //≵
-        {"nGt;", {0x0226B, 0x020D2}},                     //nGt;
-        {"ngt;", {0x0226F}},                              //≯
-        {"ngtr;", {0x0226F}},                             //≯
-        {"nGtv;", {0x0226B, 0x00338}},                    //nGtv;
-        {"nhArr;", {0x021CE}},                            //⇎
-        {"nharr;", {0x021AE}},                            //↮
-        {"nhpar;", {0x02AF2}},                            //⫲
-        {"ni;", {0x0220B}},                               //∋
-        {"nis;", {0x022FC}},                              //⋼
-        {"nisd;", {0x022FA}},                             //⋺
-        {"niv;", {0x0220B}},                              //∋
-        {"NJcy;", {0x0040A}},                             //Њ
-        {"njcy;", {0x0045A}},                             //њ
-        {"nlArr;", {0x021CD}},                            //⇍
-        {"nlarr;", {0x0219A}},                            //↚
-        {"nldr;", {0x02025}},                             //‥
-        {"nlE;", {0x02266, 0x00338}},                     //nlE;
-        {"nle;", {0x02270}},                              //≰
-        {"nLeftarrow;", {0x021CD}},                       //⇍
-        {"nleftarrow;", {0x0219A}},                       //↚
-        {"nLeftrightarrow;", {0x021CE}},                  //⇎
-        {"nleftrightarrow;", {0x021AE}},                  //↮
-        {"nleq;", {0x02270}},                             //≰
-        {"nleqq;", {0x02266, 0x00338}},                   //nleqq;
-        {"nleqslant;", {0x02A7D, 0x00338}},               //nleqslant;
-        {"nles;", {0x02A7D, 0x00338}},                    //nles;
-        {"nless;", {0x0226E}},                            //≮
-        {"nLl;", {0x022D8, 0x00338}},                     //nLl;
-        {"nlsim;", {0x02274}},                            //≴
-        {"nLt;", {0x0226A, 0x020D2}},                     //nLt;
-        {"nlt;", {0x0226E}},                              //≮
-        {"nltri;", {0x022EA}},                            //⋪
-        {"nltrie;", {0x022EC}},                           //⋬
-        {"nLtv;", {0x0226A, 0x00338}},                    //nLtv;
-        {"nmid;", {0x02224}},                             //∤
-        {"NoBreak;", {0x02060}},                          //⁠
-        {"NonBreakingSpace;", {}},                        //NonBreakingSpace;
-        {"Nopf;", {0x02115}},                             //ℕ
-        {"nopf;", {0x1D55F}},                             //𝕟
-        {"Not;", {0x02AEC}},                              //⫬
-        {"not;", {0x000AC}},                              //¬
-        {"not", {0x000AC}},                               //¬
-        {"NotCongruent;", {0x02262}},                     //≢
-        {"NotCupCap;", {0x0226D}},                        //≭
-        {"NotDoubleVerticalBar;", {0x02226}},             //∦
-        {"NotElement;", {0x02209}},                       //∉
-        {"NotEqual;", {0x02260}},                         //≠
-        {"NotEqualTilde;", {0x02242, 0x00338}},           //NotEqualTilde;
-        {"NotExists;", {0x02204}},                        //∄
-        {"NotGreater;", {0x0226F}},                       //≯
-        {"NotGreaterEqual;", {0x02271}},                  //≱
-        {"NotGreaterFullEqual;", {0x02267, 0x00338}},     //NotGreaterFullEqual;
-        {"NotGreaterGreater;", {0x0226B, 0x00338}},       //NotGreaterGreater;
-        {"NotGreaterLess;", {0x02279}},                   //≹
-        {"NotGreaterSlantEqual;", {0x02A7E, 0x00338}},    //NotGreaterSlantEqual;
-        {"NotGreaterTilde;", {0x02275}},                  //≵
-        {"NotHumpDownHump;", {0x0224E, 0x00338}},         //NotHumpDownHump;
-        {"NotHumpEqual;", {0x0224F, 0x00338}},            //NotHumpEqual;
-        {"notin;", {0x02209}},                            //∉
-        {"notindot;", {0x022F5, 0x00338}},                //notindot;
-        {"notinE;", {0x022F9, 0x00338}},                  //notinE;
-        {"notinva;", {0x02209}},                          //∉
-        {"notinvb;", {0x022F7}},                          //⋷
-        {"notinvc;", {0x022F6}},                          //⋶
-        {"NotLeftTriangle;", {0x022EA}},                  //⋪
-        {"NotLeftTriangleBar;", {0x029CF, 0x00338}},      //NotLeftTriangleBar;
-        {"NotLeftTriangleEqual;", {0x022EC}},             //⋬
-        {"NotLess;", {0x0226E}},                          //≮
-        {"NotLessEqual;", {0x02270}},                     //≰
-        {"NotLessGreater;", {0x02278}},                   //≸
-        {"NotLessLess;", {0x0226A, 0x00338}},             //NotLessLess;
-        {"NotLessSlantEqual;", {0x02A7D, 0x00338}},       //NotLessSlantEqual;
-        {"NotLessTilde;", {0x02274}},                     //≴
-        {"NotNestedGreaterGreater;", {0x02AA2, 0x00338}}, //NotNestedGreaterGreater;
-        {"NotNestedLessLess;", {0x02AA1, 0x00338}},       //NotNestedLessLess;
-        {"notni;", {0x0220C}},                            //∌
-        {"notniva;", {0x0220C}},                          //∌
-        {"notnivb;", {0x022FE}},                          //⋾
-        {"notnivc;", {0x022FD}},                          //⋽
-        {"NotPrecedes;", {0x02280}},                      //⊀
-        {"NotPrecedesEqual;", {0x02AAF, 0x00338}},        //NotPrecedesEqual;
-        {"NotPrecedesSlantEqual;", {0x022E0}},            //⋠
-        {"NotReverseElement;", {0x0220C}},                //∌
-        {"NotRightTriangle;", {0x022EB}},                 //⋫
-        {"NotRightTriangleBar;", {0x029D0, 0x00338}},     //NotRightTriangleBar;
-        {"NotRightTriangleEqual;", {0x022ED}},            //⋭
-        {"NotSquareSubset;", {0x0228F, 0x00338}},         //NotSquareSubset;
-        {"NotSquareSubsetEqual;", {0x022E2}},             //⋢
-        {"NotSquareSuperset;", {0x02290, 0x00338}},       //NotSquareSuperset;
-        {"NotSquareSupersetEqual;", {0x022E3}},           //⋣
-        {"NotSubset;", {0x02282, 0x020D2}},               //NotSubset;
-        {"NotSubsetEqual;", {0x02288}},                   //⊈
-        {"NotSucceeds;", {0x02281}},                      //⊁
-        {"NotSucceedsEqual;", {0x02AB0, 0x00338}},        //NotSucceedsEqual;
-        {"NotSucceedsSlantEqual;", {0x022E1}},            //⋡
-        {"NotSucceedsTilde;", {0x0227F, 0x00338}},        //NotSucceedsTilde;
-        {"NotSuperset;", {0x02283, 0x020D2}},             //NotSuperset;
-        {"NotSupersetEqual;", {0x02289}},                 //⊉
-        {"NotTilde;", {0x02241}},                         //≁
-        {"NotTildeEqual;", {0x02244}},                    //≄
-        {"NotTildeFullEqual;", {0x02247}},                //≇
-        {"NotTildeTilde;", {0x02249}},                    //≉
-        {"NotVerticalBar;", {0x02224}},                   //∤
-        {"npar;", {0x02226}},                             //∦
-        {"nparallel;", {0x02226}},                        //∦
-        {"nparsl;", {0x02AFD, 0x020E5}},                  //nparsl;
-        {"npart;", {0x02202, 0x00338}},                   //npart;
-        {"npolint;", {0x02A14}},                          //⨔
-        {"npr;", {0x02280}},                              //⊀
-        {"nprcue;", {0x022E0}},                           //⋠
-        {"npre;", {0x02AAF, 0x00338}},                    //npre;
-        {"nprec;", {0x02280}},                            //⊀
-        {"npreceq;", {0x02AAF, 0x00338}},                 //npreceq;
-        {"nrArr;", {0x021CF}},                            //⇏
-        {"nrarr;", {0x0219B}},                            //↛
-        {"nrarrc;", {0x02933, 0x00338}},                  //nrarrc;
-        {"nrarrw;", {0x0219D, 0x00338}},                  //nrarrw;
-        {"nRightarrow;", {0x021CF}},                      //⇏
-        {"nrightarrow;", {0x0219B}},                      //↛
-        {"nrtri;", {0x022EB}},                            //⋫
-        {"nrtrie;", {0x022ED}},                           //⋭
-        {"nsc;", {0x02281}},                              //⊁
-        {"nsccue;", {0x022E1}},                           //⋡
-        {"nsce;", {0x02AB0, 0x00338}},                    //nsce;
-        {"Nscr;", {0x1D4A9}},                             //𝒩
-        {"nscr;", {0x1D4C3}},                             //𝓃
-        {"nshortmid;", {0x02224}},                        //∤
-        {"nshortparallel;", {0x02226}},                   //∦
-        {"nsim;", {0x02241}},                             //≁
-        {"nsime;", {0x02244}},                            //≄
-        {"nsimeq;", {0x02244}},                           //≄
-        {"nsmid;", {0x02224}},                            //∤
-        {"nspar;", {0x02226}},                            //∦
-        {"nsqsube;", {0x022E2}},                          //⋢
-        {"nsqsupe;", {0x022E3}},                          //⋣
-        {"nsub;", {0x02284}},                             //⊄
-        {"nsubE;", {0x02AC5, 0x00338}},                   //nsubE;
-        {"nsube;", {0x02288}},                            //⊈
-        {"nsubset;", {0x02282, 0x020D2}},                 //nsubset;
-        {"nsubseteq;", {0x02288}},                        //⊈
-        {"nsubseteqq;", {0x02AC5, 0x00338}},              //nsubseteqq;
-        {"nsucc;", {0x02281}},                            //⊁
-        {"nsucceq;", {0x02AB0, 0x00338}},                 //nsucceq;
-        {"nsup;", {0x02285}},                             //⊅
-        {"nsupE;", {0x02AC6, 0x00338}},                   //nsupE;
-        {"nsupe;", {0x02289}},                            //⊉
-        {"nsupset;", {0x02283, 0x020D2}},                 //nsupset;
-        {"nsupseteq;", {0x02289}},                        //⊉
-        {"nsupseteqq;", {0x02AC6, 0x00338}},              //nsupseteqq;
-        {"ntgl;", {0x02279}},                             //≹
-        {"Ntilde;", {0x000D1}},                           //Ñ
-        {"Ntilde", {0x000D1}},                            //Ñ
-        {"ntilde;", {0x000F1}},                           //ñ
-        {"ntilde", {0x000F1}},                            //ñ
-        {"ntlg;", {0x02278}},                             //≸
-        {"ntriangleleft;", {0x022EA}},                    //⋪
-        {"ntrianglelefteq;", {0x022EC}},                  //⋬
-        {"ntriangleright;", {0x022EB}},                   //⋫
-        {"ntrianglerighteq;", {0x022ED}},                 //⋭
-        {"Nu;", {0x0039D}},                               //Ν
-        {"nu;", {0x003BD}},                               //ν
-        {"num;", {0x00023}},                              //#
-        {"numero;", {0x02116}},                           //№
-        {"numsp;", {}},                                   //numsp;
-        {"nvap;", {0x0224D, 0x020D2}},                    //nvap;
-        {"nVDash;", {0x022AF}},                           //⊯
-        {"nVdash;", {0x022AE}},                           //⊮
-        {"nvDash;", {0x022AD}},                           //⊭
-        {"nvdash;", {0x022AC}},                           //⊬
-        {"nvge;", {0x02265, 0x020D2}},                    //nvge;
-        {"nvgt;", {0x0003E, 0x020D2}},                    //nvgt;
-        {"nvHarr;", {0x02904}},                           //⤄
-        {"nvinfin;", {0x029DE}},                          //⧞
-        {"nvlArr;", {0x02902}},                           //⤂
-        {"nvle;", {0x02264, 0x020D2}},                    //nvle;
-        {"nvlt;", {0x0003C, 0x020D2}},                    //nvlt;
-        {"nvltrie;", {0x022B4, 0x020D2}},                 //nvltrie;
-        {"nvrArr;", {0x02903}},                           //⤃
-        {"nvrtrie;", {0x022B5, 0x020D2}},                 //nvrtrie;
-        {"nvsim;", {0x0223C, 0x020D2}},                   //nvsim;
-        {"nwarhk;", {0x02923}},                           //⤣
-        {"nwArr;", {0x021D6}},                            //⇖
-        {"nwarr;", {0x02196}},                            //↖
-        {"nwarrow;", {0x02196}},                          //↖
-        {"nwnear;", {0x02927}},                           //⤧
-        {"Oacute;", {0x000D3}},                           //Ó
-        {"Oacute", {0x000D3}},                            //Ó
-        {"oacute;", {0x000F3}},                           //ó
-        {"oacute", {0x000F3}},                            //ó
-        {"oast;", {0x0229B}},                             //⊛
-        {"ocir;", {0x0229A}},                             //⊚
-        {"Ocirc;", {0x000D4}},                            //Ô
-        {"Ocirc", {0x000D4}},                             //Ô
-        {"ocirc;", {0x000F4}},                            //ô
-        {"ocirc", {0x000F4}},                             //ô
-        {"Ocy;", {0x0041E}},                              //О
-        {"ocy;", {0x0043E}},                              //о
-        {"odash;", {0x0229D}},                            //⊝
-        {"Odblac;", {0x00150}},                           //Ő
-        {"odblac;", {0x00151}},                           //ő
-        {"odiv;", {0x02A38}},                             //⨸
-        {"odot;", {0x02299}},                             //⊙
-        {"odsold;", {0x029BC}},                           //⦼
-        {"OElig;", {0x00152}},                            //Œ
-        {"oelig;", {0x00153}},                            //œ
-        {"ofcir;", {0x029BF}},                            //⦿
-        {"Ofr;", {0x1D512}},                              //𝔒
-        {"ofr;", {0x1D52C}},                              //𝔬
-        {"ogon;", {0x002DB}},                             //˛
-        {"Ograve;", {0x000D2}},                           //Ò
-        {"Ograve", {0x000D2}},                            //Ò
-        {"ograve;", {0x000F2}},                           //ò
-        {"ograve", {0x000F2}},                            //ò
-        {"ogt;", {0x029C1}},                              //⧁
-        {"ohbar;", {0x029B5}},                            //⦵
-        {"ohm;", {0x003A9}},                              //Ω
-        {"oint;", {0x0222E}},                             //∮
-        {"olarr;", {0x021BA}},                            //↺
-        {"olcir;", {0x029BE}},                            //⦾
-        {"olcross;", {0x029BB}},                          //⦻
-        {"oline;", {0x0203E}},                            //‾
-        {"olt;", {0x029C0}},                              //⧀
-        {"Omacr;", {0x0014C}},                            //Ō
-        {"omacr;", {0x0014D}},                            //ō
-        {"Omega;", {0x003A9}},                            //Ω
-        {"omega;", {0x003C9}},                            //ω
-        {"Omicron;", {0x0039F}},                          //Ο
-        {"omicron;", {0x003BF}},                          //ο
-        {"omid;", {0x029B6}},                             //⦶
-        {"ominus;", {0x02296}},                           //⊖
-        {"Oopf;", {0x1D546}},                             //𝕆
-        {"oopf;", {0x1D560}},                             //𝕠
-        {"opar;", {0x029B7}},                             //⦷
-        {"OpenCurlyDoubleQuote;", {0x0201C}},             //“
-        {"OpenCurlyQuote;", {0x02018}},                   //‘
-        {"operp;", {0x029B9}},                            //⦹
-        {"oplus;", {0x02295}},                            //⊕
-        {"Or;", {0x02A54}},                               //⩔
-        {"or;", {0x02228}},                               //∨
-        {"orarr;", {0x021BB}},                            //↻
-        {"ord;", {0x02A5D}},                              //⩝
-        {"order;", {0x02134}},                            //ℴ
-        {"orderof;", {0x02134}},                          //ℴ
-        {"ordf;", {0x000AA}},                             //ª
-        {"ordf", {0x000AA}},                              //ª
-        {"ordm;", {0x000BA}},                             //º
-        {"ordm", {0x000BA}},                              //º
-        {"origof;", {0x022B6}},                           //⊶
-        {"oror;", {0x02A56}},                             //⩖
-        {"orslope;", {0x02A57}},                          //⩗
-        {"orv;", {0x02A5B}},                              //⩛
-        {"oS;", {0x024C8}},                               //Ⓢ
-        {"Oscr;", {0x1D4AA}},                             //𝒪
-        {"oscr;", {0x02134}},                             //ℴ
-        {"Oslash;", {0x000D8}},                           //Ø
-        {"Oslash", {0x000D8}},                            //Ø
-        {"oslash;", {0x000F8}},                           //ø
-        {"oslash", {0x000F8}},                            //ø
-        {"osol;", {0x02298}},                             //⊘
-        {"Otilde;", {0x000D5}},                           //Õ
-        {"Otilde", {0x000D5}},                            //Õ
-        {"otilde;", {0x000F5}},                           //õ
-        {"otilde", {0x000F5}},                            //õ
-        {"Otimes;", {0x02A37}},                           //⨷
-        {"otimes;", {0x02297}},                           //⊗
-        {"otimesas;", {0x02A36}},                         //⨶
-        {"Ouml;", {0x000D6}},                             //Ö
-        {"Ouml", {0x000D6}},                              //Ö
-        {"ouml;", {0x000F6}},                             //ö
-        {"ouml", {0x000F6}},                              //ö
-        {"ovbar;", {0x0233D}},                            //⌽
-        {"OverBar;", {0x0203E}},                          //‾
-        {"OverBrace;", {0x023DE}},                        //⏞
-        {"OverBracket;", {0x023B4}},                      //⎴
-        {"OverParenthesis;", {0x023DC}},                  //⏜
-        {"par;", {0x02225}},                              //∥
-        {"para;", {0x000B6}},                             //¶
-        {"para", {0x000B6}},                              //¶
-        {"parallel;", {0x02225}},                         //∥
-        {"parsim;", {0x02AF3}},                           //⫳
-        {"parsl;", {0x02AFD}},                            //⫽
-        {"part;", {0x02202}},                             //∂
-        {"PartialD;", {0x02202}},                         //∂
-        {"Pcy;", {0x0041F}},                              //П
-        {"pcy;", {0x0043F}},                              //п
-        {"percnt;", {0x00025}},                           //%
-        {"period;", {0x0002E}},                           //.
-        {"permil;", {0x02030}},                           //‰
-        {"perp;", {0x022A5}},                             //⊥
-        {"pertenk;", {0x02031}},                          //‱
-        {"Pfr;", {0x1D513}},                              //𝔓
-        {"pfr;", {0x1D52D}},                              //𝔭
-        {"Phi;", {0x003A6}},                              //Φ
-        {"phi;", {0x003C6}},                              //φ
-        {"phiv;", {0x003D5}},                             //ϕ
-        {"phmmat;", {0x02133}},                           //ℳ
-        {"phone;", {0x0260E}},                            //☎
-        {"Pi;", {0x003A0}},                               //Π
-        {"pi;", {0x003C0}},                               //π
-        {"pitchfork;", {0x022D4}},                        //⋔
-        {"piv;", {0x003D6}},                              //ϖ
-        {"planck;", {0x0210F}},                           //ℏ
-        {"planckh;", {0x0210E}},                          //ℎ
-        {"plankv;", {0x0210F}},                           //ℏ
-        {"plus;", {0x0002B}},                             //+
-        {"plusacir;", {0x02A23}},                         //⨣
-        {"plusb;", {0x0229E}},                            //⊞
-        {"pluscir;", {0x02A22}},                          //⨢
-        {"plusdo;", {0x02214}},                           //∔
-        {"plusdu;", {0x02A25}},                           //⨥
-        {"pluse;", {0x02A72}},                            //⩲
-        {"PlusMinus;", {0x000B1}},                        //±
-        {"plusmn;", {0x000B1}},                           //±
-        {"plusmn", {0x000B1}},                            //±
-        {"plussim;", {0x02A26}},                          //⨦
-        {"plustwo;", {0x02A27}},                          //⨧
-        {"pm;", {0x000B1}},                               //±
-        {"Poincareplane;", {0x0210C}},                    //ℌ
-        {"pointint;", {0x02A15}},                         //⨕
-        {"Popf;", {0x02119}},                             //ℙ
-        {"popf;", {0x1D561}},                             //𝕡
-        {"pound;", {0x000A3}},                            //£
-        {"pound", {0x000A3}},                             //£
-        {"Pr;", {0x02ABB}},                               //⪻
-        {"pr;", {0x0227A}},                               //≺
-        {"prap;", {0x02AB7}},                             //⪷
-        {"prcue;", {0x0227C}},                            //≼
-        {"prE;", {0x02AB3}},                              //⪳
-        {"pre;", {0x02AAF}},                              //⪯
-        {"prec;", {0x0227A}},                             //≺
-        {"precapprox;", {0x02AB7}},                       //⪷
-        {"preccurlyeq;", {0x0227C}},                      //≼
-        {"Precedes;", {0x0227A}},                         //≺
-        {"PrecedesEqual;", {0x02AAF}},                    //⪯
-        {"PrecedesSlantEqual;", {0x0227C}},               //≼
-        {"PrecedesTilde;", {0x0227E}},                    //≾
-        {"preceq;", {0x02AAF}},                           //⪯
-        {"precnapprox;", {0x02AB9}},                      //⪹
-        {"precneqq;", {0x02AB5}},                         //⪵
-        {"precnsim;", {0x022E8}},                         //⋨
-        {"precsim;", {0x0227E}},                          //≾
-        {"Prime;", {0x02033}},                            //″
-        {"prime;", {0x02032}},                            //′
-        {"primes;", {0x02119}},                           //ℙ
-        {"prnap;", {0x02AB9}},                            //⪹
-        {"prnE;", {0x02AB5}},                             //⪵
-        {"prnsim;", {0x022E8}},                           //⋨
-        {"prod;", {0x0220F}},                             //∏
-        {"Product;", {0x0220F}},                          //∏
-        {"profalar;", {0x0232E}},                         //⌮
-        {"profline;", {0x02312}},                         //⌒
-        {"profsurf;", {0x02313}},                         //⌓
-        {"prop;", {0x0221D}},                             //∝
-        {"Proportion;", {0x02237}},                       //∷
-        {"Proportional;", {0x0221D}},                     //∝
-        {"propto;", {0x0221D}},                           //∝
-        {"prsim;", {0x0227E}},                            //≾
-        {"prurel;", {0x022B0}},                           //⊰
-        {"Pscr;", {0x1D4AB}},                             //𝒫
-        {"pscr;", {0x1D4C5}},                             //𝓅
-        {"Psi;", {0x003A8}},                              //Ψ
-        {"psi;", {0x003C8}},                              //ψ
-        {"puncsp;", {}},                                  //puncsp;
-        {"Qfr;", {0x1D514}},                              //𝔔
-        {"qfr;", {0x1D52E}},                              //𝔮
-        {"qint;", {0x02A0C}},                             //⨌
-        {"Qopf;", {0x0211A}},                             //ℚ
-        {"qopf;", {0x1D562}},                             //𝕢
-        {"qprime;", {0x02057}},                           //⁗
-        {"Qscr;", {0x1D4AC}},                             //𝒬
-        {"qscr;", {0x1D4C6}},                             //𝓆
-        {"quaternions;", {0x0210D}},                      //ℍ
-        {"quatint;", {0x02A16}},                          //⨖
-        {"quest;", {0x0003F}},                            //?
-        {"questeq;", {0x0225F}},                          //≟
-        {"QUOT;", {0x00022}},                             //"
-        {"QUOT", {0x00022}},                              //"
-        {"quot;", {0x00022}},                             //"
-        {"quot", {0x00022}},                              //"
-        {"rAarr;", {0x021DB}},                            //⇛
-        {"race;", {0x0223D, 0x00331}},                    //race;
-        {"Racute;", {0x00154}},                           //Ŕ
-        {"racute;", {0x00155}},                           //ŕ
-        {"radic;", {0x0221A}},                            //√
-        {"raemptyv;", {0x029B3}},                         //⦳
-        {"Rang;", {0x027EB}},                             //⟫
-        {"rang;", {0x027E9}},                             //⟩
-        {"rangd;", {0x02992}},                            //⦒
-        {"range;", {0x029A5}},                            //⦥
-        {"rangle;", {0x027E9}},                           //〉
-        {"raquo;", {0x000BB}},                            //»
-        {"raquo", {0x000BB}},                             //»
-        {"Rarr;", {0x021A0}},                             //↠
-        {"rArr;", {0x021D2}},                             //⇒
-        {"rarr;", {0x02192}},                             //→
-        {"rarrap;", {0x02975}},                           //⥵
-        {"rarrb;", {0x021E5}},                            //⇥
-        {"rarrbfs;", {0x02920}},                          //⤠
-        {"rarrc;", {0x02933}},                            //⤳
-        {"rarrfs;", {0x0291E}},                           //⤞
-        {"rarrhk;", {0x021AA}},                           //↪
-        {"rarrlp;", {0x021AC}},                           //↬
-        {"rarrpl;", {0x02945}},                           //⥅
-        {"rarrsim;", {0x02974}},                          //⥴
-        {"Rarrtl;", {0x02916}},                           //⤖
-        {"rarrtl;", {0x021A3}},                           //↣
-        {"rarrw;", {0x0219D}},                            //↝
-        {"rAtail;", {0x0291C}},                           //⤜
-        {"ratail;", {0x0291A}},                           //⤚
-        {"ratio;", {0x02236}},                            //∶
-        {"rationals;", {0x0211A}},                        //ℚ
-        {"RBarr;", {0x02910}},                            //⤐
-        {"rBarr;", {0x0290F}},                            //⤏
-        {"rbarr;", {0x0290D}},                            //⤍
-        {"rbbrk;", {0x02773}},                            //❳
-        {"rbrace;", {0x0007D}},                           //}
-        {"rbrack;", {0x0005D}},                           //]
-        {"rbrke;", {0x0298C}},                            //⦌
-        {"rbrksld;", {0x0298E}},                          //⦎
-        {"rbrkslu;", {0x02990}},                          //⦐
-        {"Rcaron;", {0x00158}},                           //Ř
-        {"rcaron;", {0x00159}},                           //ř
-        {"Rcedil;", {0x00156}},                           //Ŗ
-        {"rcedil;", {0x00157}},                           //ŗ
-        {"rceil;", {0x02309}},                            //⌉
-        {"rcub;", {0x0007D}},                             //}
-        {"Rcy;", {0x00420}},                              //Р
-        {"rcy;", {0x00440}},                              //р
-        {"rdca;", {0x02937}},                             //⤷
-        {"rdldhar;", {0x02969}},                          //⥩
-        {"rdquo;", {0x0201D}},                            //”
-        {"rdquor;", {0x0201D}},                           //”
-        {"rdsh;", {0x021B3}},                             //↳
-        {"Re;", {0x0211C}},                               //ℜ
-        {"real;", {0x0211C}},                             //ℜ
-        {"realine;", {0x0211B}},                          //ℛ
-        {"realpart;", {0x0211C}},                         //ℜ
-        {"reals;", {0x0211D}},                            //ℝ
-        {"rect;", {0x025AD}},                             //▭
-        {"REG;", {0x000AE}},                              //®
-        {"REG", {0x000AE}},                               //®
-        {"reg;", {0x000AE}},                              //®
-        {"reg", {0x000AE}},                               //®
-        {"ReverseElement;", {0x0220B}},                   //∋
-        {"ReverseEquilibrium;", {0x021CB}},               //⇋
-        {"ReverseUpEquilibrium;", {0x0296F}},             //⥯
-        {"rfisht;", {0x0297D}},                           //⥽
-        {"rfloor;", {0x0230B}},                           //⌋
-        {"Rfr;", {0x0211C}},                              //ℜ
-        {"rfr;", {0x1D52F}},                              //𝔯
-        {"rHar;", {0x02964}},                             //⥤
-        {"rhard;", {0x021C1}},                            //⇁
-        {"rharu;", {0x021C0}},                            //⇀
-        {"rharul;", {0x0296C}},                           //⥬
-        {"Rho;", {0x003A1}},                              //Ρ
-        {"rho;", {0x003C1}},                              //ρ
-        {"rhov;", {0x003F1}},                             //ϱ
-        {"RightAngleBracket;", {0x027E9}},                //〉
-        {"RightArrow;", {0x02192}},                       //→
-        {"Rightarrow;", {0x021D2}},                       //⇒
-        {"rightarrow;", {0x02192}},                       //→
-        {"RightArrowBar;", {0x021E5}},                    //⇥
-        {"RightArrowLeftArrow;", {0x021C4}},              //⇄
-        {"rightarrowtail;", {0x021A3}},                   //↣
-        {"RightCeiling;", {0x02309}},                     //⌉
-        {"RightDoubleBracket;", {0x027E7}},               //⟧
-        {"RightDownTeeVector;", {0x0295D}},               //⥝
-        {"RightDownVector;", {0x021C2}},                  //⇂
-        {"RightDownVectorBar;", {0x02955}},               //⥕
-        {"RightFloor;", {0x0230B}},                       //⌋
-        {"rightharpoondown;", {0x021C1}},                 //⇁
-        {"rightharpoonup;", {0x021C0}},                   //⇀
-        {"rightleftarrows;", {0x021C4}},                  //⇄
-        {"rightleftharpoons;", {0x021CC}},                //⇌
-        {"rightrightarrows;", {0x021C9}},                 //⇉
-        {"rightsquigarrow;", {0x0219D}},                  //↝
-        {"RightTee;", {0x022A2}},                         //⊢
-        {"RightTeeArrow;", {0x021A6}},                    //↦
-        {"RightTeeVector;", {0x0295B}},                   //⥛
-        {"rightthreetimes;", {0x022CC}},                  //⋌
-        {"RightTriangle;", {0x022B3}},                    //⊳
-        {"RightTriangleBar;", {0x029D0}},                 //⧐
-        {"RightTriangleEqual;", {0x022B5}},               //⊵
-        {"RightUpDownVector;", {0x0294F}},                //⥏
-        {"RightUpTeeVector;", {0x0295C}},                 //⥜
-        {"RightUpVector;", {0x021BE}},                    //↾
-        {"RightUpVectorBar;", {0x02954}},                 //⥔
-        {"RightVector;", {0x021C0}},                      //⇀
-        {"RightVectorBar;", {0x02953}},                   //⥓
-        {"ring;", {0x002DA}},                             //˚
-        {"risingdotseq;", {0x02253}},                     //≓
-        {"rlarr;", {0x021C4}},                            //⇄
-        {"rlhar;", {0x021CC}},                            //⇌
-        {"rlm;", {0x0200F}},                              //‏
-        {"rmoust;", {0x023B1}},                           //⎱
-        {"rmoustache;", {0x023B1}},                       //⎱
-        {"rnmid;", {0x02AEE}},                            //⫮
-        {"roang;", {0x027ED}},                            //⟭
-        {"roarr;", {0x021FE}},                            //⇾
-        {"robrk;", {0x027E7}},                            //⟧
-        {"ropar;", {0x02986}},                            //⦆
-        {"Ropf;", {0x0211D}},                             //ℝ
-        {"ropf;", {0x1D563}},                             //𝕣
-        {"roplus;", {0x02A2E}},                           //⨮
-        {"rotimes;", {0x02A35}},                          //⨵
-        {"RoundImplies;", {0x02970}},                     //⥰
-        {"rpar;", {0x00029}},                             //)
-        {"rpargt;", {0x02994}},                           //⦔
-        {"rppolint;", {0x02A12}},                         //⨒
-        {"rrarr;", {0x021C9}},                            //⇉
-        {"Rrightarrow;", {0x021DB}},                      //⇛
-        {"rsaquo;", {0x0203A}},                           //›
-        {"Rscr;", {0x0211B}},                             //ℛ
-        {"rscr;", {0x1D4C7}},                             //𝓇
-        {"Rsh;", {0x021B1}},                              //↱
-        {"rsh;", {0x021B1}},                              //↱
-        {"rsqb;", {0x0005D}},                             //]
-        {"rsquo;", {0x02019}},                            //’
-        {"rsquor;", {0x02019}},                           //’
-        {"rthree;", {0x022CC}},                           //⋌
-        {"rtimes;", {0x022CA}},                           //⋊
-        {"rtri;", {0x025B9}},                             //▹
-        {"rtrie;", {0x022B5}},                            //⊵
-        {"rtrif;", {0x025B8}},                            //▸
-        {"rtriltri;", {0x029CE}},                         //⧎
-        {"RuleDelayed;", {0x029F4}},                      //⧴
-        {"ruluhar;", {0x02968}},                          //⥨
-        {"rx;", {0x0211E}},                               //℞
-        {"Sacute;", {0x0015A}},                           //Ś
-        {"sacute;", {0x0015B}},                           //ś
-        {"sbquo;", {0x0201A}},                            //‚
-        {"Sc;", {0x02ABC}},                               //⪼
-        {"sc;", {0x0227B}},                               //≻
-        {"scap;", {0x02AB8}},                             //⪸
-        {"Scaron;", {0x00160}},                           //Š
-        {"scaron;", {0x00161}},                           //š
-        {"sccue;", {0x0227D}},                            //≽
-        {"scE;", {0x02AB4}},                              //⪴
-        {"sce;", {0x02AB0}},                              //⪰
-        {"Scedil;", {0x0015E}},                           //Ş
-        {"scedil;", {0x0015F}},                           //ş
-        {"Scirc;", {0x0015C}},                            //Ŝ
-        {"scirc;", {0x0015D}},                            //ŝ
-        {"scnap;", {0x02ABA}},                            //⪺
-        {"scnE;", {0x02AB6}},                             //⪶
-        {"scnsim;", {0x022E9}},                           //⋩
-        {"scpolint;", {0x02A13}},                         //⨓
-        {"scsim;", {0x0227F}},                            //≿
-        {"Scy;", {0x00421}},                              //С
-        {"scy;", {0x00441}},                              //с
-        {"sdot;", {0x022C5}},                             //⋅
-        {"sdotb;", {0x022A1}},                            //⊡
-        {"sdote;", {0x02A66}},                            //⩦
-        {"searhk;", {0x02925}},                           //⤥
-        {"seArr;", {0x021D8}},                            //⇘
-        {"searr;", {0x02198}},                            //↘
-        {"searrow;", {0x02198}},                          //↘
-        {"sect;", {0x000A7}},                             //§
-        {"sect", {0x000A7}},                              //§
-        {"semi;", {0x0003B}},                             //;
-        {"seswar;", {0x02929}},                           //⤩
-        {"setminus;", {0x02216}},                         //∖
-        {"setmn;", {0x02216}},                            //∖
-        {"sext;", {0x02736}},                             //✶
-        {"Sfr;", {0x1D516}},                              //𝔖
-        {"sfr;", {0x1D530}},                              //𝔰
-        {"sfrown;", {0x02322}},                           //⌢
-        {"sharp;", {0x0266F}},                            //♯
-        {"SHCHcy;", {0x00429}},                           //Щ
-        {"shchcy;", {0x00449}},                           //щ
-        {"SHcy;", {0x00428}},                             //Ш
-        {"shcy;", {0x00448}},                             //ш
-        {"ShortDownArrow;", {0x02193}},                   //↓
-        {"ShortLeftArrow;", {0x02190}},                   //←
-        {"shortmid;", {0x02223}},                         //∣
-        {"shortparallel;", {0x02225}},                    //∥
-        {"ShortRightArrow;", {0x02192}},                  //→
-        {"ShortUpArrow;", {0x02191}},                     //↑
-        {"shy;", {}},                                     //shy;
-        {"shy", {}},                                      //shy
-        {"Sigma;", {0x003A3}},                            //Σ
-        {"sigma;", {0x003C3}},                            //σ
-        {"sigmaf;", {0x003C2}},                           //ς
-        {"sigmav;", {0x003C2}},                           //ς
-        {"sim;", {0x0223C}},                              //∼
-        {"simdot;", {0x02A6A}},                           //⩪
-        {"sime;", {0x02243}},                             //≃
-        {"simeq;", {0x02243}},                            //≃
-        {"simg;", {0x02A9E}},                             //⪞
-        {"simgE;", {0x02AA0}},                            //⪠
-        {"siml;", {0x02A9D}},                             //⪝
-        {"simlE;", {0x02A9F}},                            //⪟
-        {"simne;", {0x02246}},                            //≆
-        {"simplus;", {0x02A24}},                          //⨤
-        {"simrarr;", {0x02972}},                          //⥲
-        {"slarr;", {0x02190}},                            //←
-        {"SmallCircle;", {0x02218}},                      //∘
-        {"smallsetminus;", {0x02216}},                    //∖
-        {"smashp;", {0x02A33}},                           //⨳
-        {"smeparsl;", {0x029E4}},                         //⧤
-        {"smid;", {0x02223}},                             //∣
-        {"smile;", {0x02323}},                            //⌣
-        {"smt;", {0x02AAA}},                              //⪪
-        {"smte;", {0x02AAC}},                             //⪬
-        {"smtes;", {0x02AAC, 0x0FE00}},                   //smtes;
-        {"SOFTcy;", {0x0042C}},                           //Ь
-        {"softcy;", {0x0044C}},                           //ь
-        {"sol;", {0x0002F}},                              ///
-        {"solb;", {0x029C4}},                             //⧄
-        {"solbar;", {0x0233F}},                           //⌿
-        {"Sopf;", {0x1D54A}},                             //𝕊
-        {"sopf;", {0x1D564}},                             //𝕤
-        {"spades;", {0x02660}},                           //♠
-        {"spadesuit;", {0x02660}},                        //♠
-        {"spar;", {0x02225}},                             //∥
-        {"sqcap;", {0x02293}},                            //⊓
-        {"sqcaps;", {0x02293, 0x0FE00}},                  //sqcaps;
-        {"sqcup;", {0x02294}},                            //⊔
-        {"sqcups;", {0x02294, 0x0FE00}},                  //sqcups;
-        {"Sqrt;", {0x0221A}},                             //√
-        {"sqsub;", {0x0228F}},                            //⊏
-        {"sqsube;", {0x02291}},                           //⊑
-        {"sqsubset;", {0x0228F}},                         //⊏
-        {"sqsubseteq;", {0x02291}},                       //⊑
-        {"sqsup;", {0x02290}},                            //⊐
-        {"sqsupe;", {0x02292}},                           //⊒
-        {"sqsupset;", {0x02290}},                         //⊐
-        {"sqsupseteq;", {0x02292}},                       //⊒
-        {"squ;", {0x025A1}},                              //□
-        {"Square;", {0x025A1}},                           //□
-        {"square;", {0x025A1}},                           //□
-        {"SquareIntersection;", {0x02293}},               //⊓
-        {"SquareSubset;", {0x0228F}},                     //⊏
-        {"SquareSubsetEqual;", {0x02291}},                //⊑
-        {"SquareSuperset;", {0x02290}},                   //⊐
-        {"SquareSupersetEqual;", {0x02292}},              //⊒
-        {"SquareUnion;", {0x02294}},                      //⊔
-        {"squarf;", {0x025AA}},                           //▪
-        {"squf;", {0x025AA}},                             //▪
-        {"srarr;", {0x02192}},                            //→
-        {"Sscr;", {0x1D4AE}},                             //𝒮
-        {"sscr;", {0x1D4C8}},                             //𝓈
-        {"ssetmn;", {0x02216}},                           //∖
-        {"ssmile;", {0x02323}},                           //⌣
-        {"sstarf;", {0x022C6}},                           //⋆
-        {"Star;", {0x022C6}},                             //⋆
-        {"star;", {0x02606}},                             //☆
-        {"starf;", {0x02605}},                            //★
-        {"straightepsilon;", {0x003F5}},                  //ϵ
-        {"straightphi;", {0x003D5}},                      //ϕ
-        {"strns;", {0x000AF}},                            //¯
-        {"Sub;", {0x022D0}},                              //⋐
-        {"sub;", {0x02282}},                              //⊂
-        {"subdot;", {0x02ABD}},                           //⪽
-        {"subE;", {0x02AC5}},                             //⫅
-        {"sube;", {0x02286}},                             //⊆
-        {"subedot;", {0x02AC3}},                          //⫃
-        {"submult;", {0x02AC1}},                          //⫁
-        {"subnE;", {0x02ACB}},                            //⫋
-        {"subne;", {0x0228A}},                            //⊊
-        {"subplus;", {0x02ABF}},                          //⪿
-        {"subrarr;", {0x02979}},                          //⥹
-        {"Subset;", {0x022D0}},                           //⋐
-        {"subset;", {0x02282}},                           //⊂
-        {"subseteq;", {0x02286}},                         //⊆
-        {"subseteqq;", {0x02AC5}},                        //⫅
-        {"SubsetEqual;", {0x02286}},                      //⊆
-        {"subsetneq;", {0x0228A}},                        //⊊
-        {"subsetneqq;", {0x02ACB}},                       //⫋
-        {"subsim;", {0x02AC7}},                           //⫇
-        {"subsub;", {0x02AD5}},                           //⫕
-        {"subsup;", {0x02AD3}},                           //⫓
-        {"succ;", {0x0227B}},                             //≻
-        {"succapprox;", {0x02AB8}},                       //⪸
-        {"succcurlyeq;", {0x0227D}},                      //≽
-        {"Succeeds;", {0x0227B}},                         //≻
-        {"SucceedsEqual;", {0x02AB0}},                    //⪰
-        {"SucceedsSlantEqual;", {0x0227D}},               //≽
-        {"SucceedsTilde;", {0x0227F}},                    //≿
-        {"succeq;", {0x02AB0}},                           //⪰
-        {"succnapprox;", {0x02ABA}},                      //⪺
-        {"succneqq;", {0x02AB6}},                         //⪶
-        {"succnsim;", {0x022E9}},                         //⋩
-        {"succsim;", {0x0227F}},                          //≿
-        {"SuchThat;", {0x0220B}},                         //∋
-        {"Sum;", {0x02211}},                              //∑
-        {"sum;", {0x02211}},                              //∑
-        {"sung;", {0x0266A}},                             //♪
-        {"Sup;", {0x022D1}},                              //⋑
-        {"sup;", {0x02283}},                              //⊃
-        {"sup1;", {0x000B9}},                             //¹
-        {"sup1", {0x000B9}},                              //¹
-        {"sup2;", {0x000B2}},                             //²
-        {"sup2", {0x000B2}},                              //²
-        {"sup3;", {0x000B3}},                             //³
-        {"sup3", {0x000B3}},                              //³
-        {"supdot;", {0x02ABE}},                           //⪾
-        {"supdsub;", {0x02AD8}},                          //⫘
-        {"supE;", {0x02AC6}},                             //⫆
-        {"supe;", {0x02287}},                             //⊇
-        {"supedot;", {0x02AC4}},                          //⫄
-        {"Superset;", {0x02283}},                         //⊃
-        {"SupersetEqual;", {0x02287}},                    //⊇
-        {"suphsol;", {0x027C9}},                          //⟉
-        {"suphsub;", {0x02AD7}},                          //⫗
-        {"suplarr;", {0x0297B}},                          //⥻
-        {"supmult;", {0x02AC2}},                          //⫂
-        {"supnE;", {0x02ACC}},                            //⫌
-        {"supne;", {0x0228B}},                            //⊋
-        {"supplus;", {0x02AC0}},                          //⫀
-        {"Supset;", {0x022D1}},                           //⋑
-        {"supset;", {0x02283}},                           //⊃
-        {"supseteq;", {0x02287}},                         //⊇
-        {"supseteqq;", {0x02AC6}},                        //⫆
-        {"supsetneq;", {0x0228B}},                        //⊋
-        {"supsetneqq;", {0x02ACC}},                       //⫌
-        {"supsim;", {0x02AC8}},                           //⫈
-        {"supsub;", {0x02AD4}},                           //⫔
-        {"supsup;", {0x02AD6}},                           //⫖
-        {"swarhk;", {0x02926}},                           //⤦
-        {"swArr;", {0x021D9}},                            //⇙
-        {"swarr;", {0x02199}},                            //↙
-        {"swarrow;", {0x02199}},                          //↙
-        {"swnwar;", {0x0292A}},                           //⤪
-        {"szlig;", {0x000DF}},                            //ß
-        {"szlig", {0x000DF}},                             //ß
-        {"Tab;", {0x00009}},                              //␉
-        {"target;", {0x02316}},                           //⌖
-        {"Tau;", {0x003A4}},                              //Τ
-        {"tau;", {0x003C4}},                              //τ
-        {"tbrk;", {0x023B4}},                             //⎴
-        {"Tcaron;", {0x00164}},                           //Ť
-        {"tcaron;", {0x00165}},                           //ť
-        {"Tcedil;", {0x00162}},                           //Ţ
-        {"tcedil;", {0x00163}},                           //ţ
-        {"Tcy;", {0x00422}},                              //Т
-        {"tcy;", {0x00442}},                              //т
-        {"tdot;", {0x020DB}},                             //◌⃛
-        {"telrec;", {0x02315}},                           //⌕
-        {"Tfr;", {0x1D517}},                              //𝔗
-        {"tfr;", {0x1D531}},                              //𝔱
-        {"there4;", {0x02234}},                           //∴
-        {"Therefore;", {0x02234}},                        //∴
-        {"therefore;", {0x02234}},                        //∴
-        {"Theta;", {0x00398}},                            //Θ
-        {"theta;", {0x003B8}},                            //θ
-        {"thetasym;", {0x003D1}},                         //ϑ
-        {"thetav;", {0x003D1}},                           //ϑ
-        {"thickapprox;", {0x02248}},                      //≈
-        {"thicksim;", {0x0223C}},                         //∼
-        {"ThickSpace;", {0x0205F}},                       //U+0200A
-        {"thinsp;", {}},                                  //thinsp;
-        {"ThinSpace;", {}},                               //ThinSpace;
-        {"thkap;", {0x02248}},                            //≈
-        {"thksim;", {0x0223C}},                           //∼
-        {"THORN;", {0x000DE}},                            //Þ
-        {"THORN", {0x000DE}},                             //Þ
-        {"thorn;", {0x000FE}},                            //þ
-        {"thorn", {0x000FE}},                             //þ
-        {"Tilde;", {0x0223C}},                            //∼
-        {"tilde;", {0x002DC}},                            //˜
-        {"TildeEqual;", {0x02243}},                       //≃
-        {"TildeFullEqual;", {0x02245}},                   //≅
-        {"TildeTilde;", {0x02248}},                       //≈
-        {"times;", {0x000D7}},                            //×
-        {"times", {0x000D7}},                             //×
-        {"timesb;", {0x022A0}},                           //⊠
-        {"timesbar;", {0x02A31}},                         //⨱
-        {"timesd;", {0x02A30}},                           //⨰
-        {"tint;", {0x0222D}},                             //∭
-        {"toea;", {0x02928}},                             //⤨
-        {"top;", {0x022A4}},                              //⊤
-        {"topbot;", {0x02336}},                           //⌶
-        {"topcir;", {0x02AF1}},                           //⫱
-        {"Topf;", {0x1D54B}},                             //𝕋
-        {"topf;", {0x1D565}},                             //𝕥
-        {"topfork;", {0x02ADA}},                          //⫚
-        {"tosa;", {0x02929}},                             //⤩
-        {"tprime;", {0x02034}},                           //‴
-        {"TRADE;", {0x02122}},                            //™
-        {"trade;", {0x02122}},                            //™
-        {"triangle;", {0x025B5}},                         //▵
-        {"triangledown;", {0x025BF}},                     //▿
-        {"triangleleft;", {0x025C3}},                     //◃
-        {"trianglelefteq;", {0x022B4}},                   //⊴
-        {"triangleq;", {0x0225C}},                        //≜
-        {"triangleright;", {0x025B9}},                    //▹
-        {"trianglerighteq;", {0x022B5}},                  //⊵
-        {"tridot;", {0x025EC}},                           //◬
-        {"trie;", {0x0225C}},                             //≜
-        {"triminus;", {0x02A3A}},                         //⨺
-        {"TripleDot;", {0x020DB}},                        //◌⃛
-        {"triplus;", {0x02A39}},                          //⨹
-        {"trisb;", {0x029CD}},                            //⧍
-        {"tritime;", {0x02A3B}},                          //⨻
-        {"trpezium;", {0x023E2}},                         //⏢
-        {"Tscr;", {0x1D4AF}},                             //𝒯
-        {"tscr;", {0x1D4C9}},                             //𝓉
-        {"TScy;", {0x00426}},                             //Ц
-        {"tscy;", {0x00446}},                             //ц
-        {"TSHcy;", {0x0040B}},                            //Ћ
-        {"tshcy;", {0x0045B}},                            //ћ
-        {"Tstrok;", {0x00166}},                           //Ŧ
-        {"tstrok;", {0x00167}},                           //ŧ
-        {"twixt;", {0x0226C}},                            //≬
-        {"twoheadleftarrow;", {0x0219E}},                 //↞
-        {"twoheadrightarrow;", {0x021A0}},                //↠
-        {"Uacute;", {0x000DA}},                           //Ú
-        {"Uacute", {0x000DA}},                            //Ú
-        {"uacute;", {0x000FA}},                           //ú
-        {"uacute", {0x000FA}},                            //ú
-        {"Uarr;", {0x0219F}},                             //↟
-        {"uArr;", {0x021D1}},                             //⇑
-        {"uarr;", {0x02191}},                             //↑
-        {"Uarrocir;", {0x02949}},                         //⥉
-        {"Ubrcy;", {0x0040E}},                            //Ў
-        {"ubrcy;", {0x0045E}},                            //ў
-        {"Ubreve;", {0x0016C}},                           //Ŭ
-        {"ubreve;", {0x0016D}},                           //ŭ
-        {"Ucirc;", {0x000DB}},                            //Û
-        {"Ucirc", {0x000DB}},                             //Û
-        {"ucirc;", {0x000FB}},                            //û
-        {"ucirc", {0x000FB}},                             //û
-        {"Ucy;", {0x00423}},                              //У
-        {"ucy;", {0x00443}},                              //у
-        {"udarr;", {0x021C5}},                            //⇅
-        {"Udblac;", {0x00170}},                           //Ű
-        {"udblac;", {0x00171}},                           //ű
-        {"udhar;", {0x0296E}},                            //⥮
-        {"ufisht;", {0x0297E}},                           //⥾
-        {"Ufr;", {0x1D518}},                              //𝔘
-        {"ufr;", {0x1D532}},                              //𝔲
-        {"Ugrave;", {0x000D9}},                           //Ù
-        {"Ugrave", {0x000D9}},                            //Ù
-        {"ugrave;", {0x000F9}},                           //ù
-        {"ugrave", {0x000F9}},                            //ù
-        {"uHar;", {0x02963}},                             //⥣
-        {"uharl;", {0x021BF}},                            //↿
-        {"uharr;", {0x021BE}},                            //↾
-        {"uhblk;", {0x02580}},                            //▀
-        {"ulcorn;", {0x0231C}},                           //⌜
-        {"ulcorner;", {0x0231C}},                         //⌜
-        {"ulcrop;", {0x0230F}},                           //⌏
-        {"ultri;", {0x025F8}},                            //◸
-        {"Umacr;", {0x0016A}},                            //Ū
-        {"umacr;", {0x0016B}},                            //ū
-        {"uml;", {0x000A8}},                              //¨
-        {"uml", {0x000A8}},                               //¨
-        {"UnderBar;", {0x0005F}},                         //_
-        {"UnderBrace;", {0x023DF}},                       //⏟
-        {"UnderBracket;", {0x023B5}},                     //⎵
-        {"UnderParenthesis;", {0x023DD}},                 //⏝
-        {"Union;", {0x022C3}},                            //⋃
-        {"UnionPlus;", {0x0228E}},                        //⊎
-        {"Uogon;", {0x00172}},                            //Ų
-        {"uogon;", {0x00173}},                            //ų
-        {"Uopf;", {0x1D54C}},                             //𝕌
-        {"uopf;", {0x1D566}},                             //𝕦
-        {"UpArrow;", {0x02191}},                          //↑
-        {"Uparrow;", {0x021D1}},                          //⇑
-        {"uparrow;", {0x02191}},                          //↑
-        {"UpArrowBar;", {0x02912}},                       //⤒
-        {"UpArrowDownArrow;", {0x021C5}},                 //⇅
-        {"UpDownArrow;", {0x02195}},                      //↕
-        {"Updownarrow;", {0x021D5}},                      //⇕
-        {"updownarrow;", {0x02195}},                      //↕
-        {"UpEquilibrium;", {0x0296E}},                    //⥮
-        {"upharpoonleft;", {0x021BF}},                    //↿
-        {"upharpoonright;", {0x021BE}},                   //↾
-        {"uplus;", {0x0228E}},                            //⊎
-        {"UpperLeftArrow;", {0x02196}},                   //↖
-        {"UpperRightArrow;", {0x02197}},                  //↗
-        {"Upsi;", {0x003D2}},                             //ϒ
-        {"upsi;", {0x003C5}},                             //υ
-        {"upsih;", {0x003D2}},                            //ϒ
-        {"Upsilon;", {0x003A5}},                          //Υ
-        {"upsilon;", {0x003C5}},                          //υ
-        {"UpTee;", {0x022A5}},                            //⊥
-        {"UpTeeArrow;", {0x021A5}},                       //↥
-        {"upuparrows;", {0x021C8}},                       //⇈
-        {"urcorn;", {0x0231D}},                           //⌝
-        {"urcorner;", {0x0231D}},                         //⌝
-        {"urcrop;", {0x0230E}},                           //⌎
-        {"Uring;", {0x0016E}},                            //Ů
-        {"uring;", {0x0016F}},                            //ů
-        {"urtri;", {0x025F9}},                            //◹
-        {"Uscr;", {0x1D4B0}},                             //𝒰
-        {"uscr;", {0x1D4CA}},                             //𝓊
-        {"utdot;", {0x022F0}},                            //⋰
-        {"Utilde;", {0x00168}},                           //Ũ
-        {"utilde;", {0x00169}},                           //ũ
-        {"utri;", {0x025B5}},                             //▵
-        {"utrif;", {0x025B4}},                            //▴
-        {"uuarr;", {0x021C8}},                            //⇈
-        {"Uuml;", {0x000DC}},                             //Ü
-        {"Uuml", {0x000DC}},                              //Ü
-        {"uuml;", {0x000FC}},                             //ü
-        {"uuml", {0x000FC}},                              //ü
-        {"uwangle;", {0x029A7}},                          //⦧
-        {"vangrt;", {0x0299C}},                           //⦜
-        {"varepsilon;", {0x003F5}},                       //ϵ
-        {"varkappa;", {0x003F0}},                         //ϰ
-        {"varnothing;", {0x02205}},                       //∅
-        {"varphi;", {0x003D5}},                           //ϕ
-        {"varpi;", {0x003D6}},                            //ϖ
-        {"varpropto;", {0x0221D}},                        //∝
-        {"vArr;", {0x021D5}},                             //⇕
-        {"varr;", {0x02195}},                             //↕
-        {"varrho;", {0x003F1}},                           //ϱ
-        {"varsigma;", {0x003C2}},                         //ς
-        {"varsubsetneq;", {0x0228A, 0x0FE00}},            //varsubsetneq;
-        {"varsubsetneqq;", {0x02ACB, 0x0FE00}},           //varsubsetneqq;
-        {"varsupsetneq;", {0x0228B, 0x0FE00}},            //varsupsetneq;
-        {"varsupsetneqq;", {0x02ACC, 0x0FE00}},           //varsupsetneqq;
-        {"vartheta;", {0x003D1}},                         //ϑ
-        {"vartriangleleft;", {0x022B2}},                  //⊲
-        {"vartriangleright;", {0x022B3}},                 //⊳
-        {"Vbar;", {0x02AEB}},                             //⫫
-        {"vBar;", {0x02AE8}},                             //⫨
-        {"vBarv;", {0x02AE9}},                            //⫩
-        {"Vcy;", {0x00412}},                              //В
-        {"vcy;", {0x00432}},                              //в
-        {"VDash;", {0x022AB}},                            //⊫
-        {"Vdash;", {0x022A9}},                            //⊩
-        {"vDash;", {0x022A8}},                            //⊨
-        {"vdash;", {0x022A2}},                            //⊢
-        {"Vdashl;", {0x02AE6}},                           //⫦
-        {"Vee;", {0x022C1}},                              //⋁
-        {"vee;", {0x02228}},                              //∨
-        {"veebar;", {0x022BB}},                           //⊻
-        {"veeeq;", {0x0225A}},                            //≚
-        {"vellip;", {0x022EE}},                           //⋮
-        {"Verbar;", {0x02016}},                           //‖
-        {"verbar;", {0x0007C}},                           //|
-        {"Vert;", {0x02016}},                             //‖
-        {"vert;", {0x0007C}},                             //|
-        {"VerticalBar;", {0x02223}},                      //∣
-        {"VerticalLine;", {0x0007C}},                     //|
-        {"VerticalSeparator;", {0x02758}},                //❘
-        {"VerticalTilde;", {0x02240}},                    //≀
-        {"VeryThinSpace;", {}},                           //VeryThinSpace;
-        {"Vfr;", {0x1D519}},                              //𝔙
-        {"vfr;", {0x1D533}},                              //𝔳
-        {"vltri;", {0x022B2}},                            //⊲
-        {"vnsub;", {0x02282, 0x020D2}},                   //vnsub;
-        {"vnsup;", {0x02283, 0x020D2}},                   //vnsup;
-        {"Vopf;", {0x1D54D}},                             //𝕍
-        {"vopf;", {0x1D567}},                             //𝕧
-        {"vprop;", {0x0221D}},                            //∝
-        {"vrtri;", {0x022B3}},                            //⊳
-        {"Vscr;", {0x1D4B1}},                             //𝒱
-        {"vscr;", {0x1D4CB}},                             //𝓋
-        {"vsubnE;", {0x02ACB, 0x0FE00}},                  //vsubnE;
-        {"vsubne;", {0x0228A, 0x0FE00}},                  //vsubne;
-        {"vsupnE;", {0x02ACC, 0x0FE00}},                  //vsupnE;
-        {"vsupne;", {0x0228B, 0x0FE00}},                  //vsupne;
-        {"Vvdash;", {0x022AA}},                           //⊪
-        {"vzigzag;", {0x0299A}},                          //⦚
-        {"Wcirc;", {0x00174}},                            //Ŵ
-        {"wcirc;", {0x00175}},                            //ŵ
-        {"wedbar;", {0x02A5F}},                           //⩟
-        {"Wedge;", {0x022C0}},                            //⋀
-        {"wedge;", {0x02227}},                            //∧
-        {"wedgeq;", {0x02259}},                           //≙
-        {"weierp;", {0x02118}},                           //℘
-        {"Wfr;", {0x1D51A}},                              //𝔚
-        {"wfr;", {0x1D534}},                              //𝔴
-        {"Wopf;", {0x1D54E}},                             //𝕎
-        {"wopf;", {0x1D568}},                             //𝕨
-        {"wp;", {0x02118}},                               //℘
-        {"wr;", {0x02240}},                               //≀
-        {"wreath;", {0x02240}},                           //≀
-        {"Wscr;", {0x1D4B2}},                             //𝒲
-        {"wscr;", {0x1D4CC}},                             //𝓌
-        {"xcap;", {0x022C2}},                             //⋂
-        {"xcirc;", {0x025EF}},                            //◯
-        {"xcup;", {0x022C3}},                             //⋃
-        {"xdtri;", {0x025BD}},                            //▽
-        {"Xfr;", {0x1D51B}},                              //𝔛
-        {"xfr;", {0x1D535}},                              //𝔵
-        {"xhArr;", {0x027FA}},                            //⟺
-        {"xharr;", {0x027F7}},                            //⟷
-        {"Xi;", {0x0039E}},                               //Ξ
-        {"xi;", {0x003BE}},                               //ξ
-        {"xlArr;", {0x027F8}},                            //⟸
-        {"xlarr;", {0x027F5}},                            //⟵
-        {"xmap;", {0x027FC}},                             //⟼
-        {"xnis;", {0x022FB}},                             //⋻
-        {"xodot;", {0x02A00}},                            //⨀
-        {"Xopf;", {0x1D54F}},                             //𝕏
-        {"xopf;", {0x1D569}},                             //𝕩
-        {"xoplus;", {0x02A01}},                           //⨁
-        {"xotime;", {0x02A02}},                           //⨂
-        {"xrArr;", {0x027F9}},                            //⟹
-        {"xrarr;", {0x027F6}},                            //⟶
-        {"Xscr;", {0x1D4B3}},                             //𝒳
-        {"xscr;", {0x1D4CD}},                             //𝓍
-        {"xsqcup;", {0x02A06}},                           //⨆
-        {"xuplus;", {0x02A04}},                           //⨄
-        {"xutri;", {0x025B3}},                            //△
-        {"xvee;", {0x022C1}},                             //⋁
-        {"xwedge;", {0x022C0}},                           //⋀
-        {"Yacute;", {0x000DD}},                           //Ý
-        {"Yacute", {0x000DD}},                            //Ý
-        {"yacute;", {0x000FD}},                           //ý
-        {"yacute", {0x000FD}},                            //ý
-        {"YAcy;", {0x0042F}},                             //Я
-        {"yacy;", {0x0044F}},                             //я
-        {"Ycirc;", {0x00176}},                            //Ŷ
-        {"ycirc;", {0x00177}},                            //ŷ
-        {"Ycy;", {0x0042B}},                              //Ы
-        {"ycy;", {0x0044B}},                              //ы
-        {"yen;", {0x000A5}},                              //¥
-        {"yen", {0x000A5}},                               //¥
-        {"Yfr;", {0x1D51C}},                              //𝔜
-        {"yfr;", {0x1D536}},                              //𝔶
-        {"YIcy;", {0x00407}},                             //Ї
-        {"yicy;", {0x00457}},                             //ї
-        {"Yopf;", {0x1D550}},                             //𝕐
-        {"yopf;", {0x1D56A}},                             //𝕪
-        {"Yscr;", {0x1D4B4}},                             //𝒴
-        {"yscr;", {0x1D4CE}},                             //𝓎
-        {"YUcy;", {0x0042E}},                             //Ю
-        {"yucy;", {0x0044E}},                             //ю
-        {"Yuml;", {0x00178}},                             //Ÿ
-        {"yuml;", {0x000FF}},                             //ÿ
-        {"yuml", {0x000FF}},                              //ÿ
-        {"Zacute;", {0x00179}},                           //Ź
-        {"zacute;", {0x0017A}},                           //ź
-        {"Zcaron;", {0x0017D}},                           //Ž
-        {"zcaron;", {0x0017E}},                           //ž
-        {"Zcy;", {0x00417}},                              //З
-        {"zcy;", {0x00437}},                              //з
-        {"Zdot;", {0x0017B}},                             //Ż
-        {"zdot;", {0x0017C}},                             //ż
-        {"zeetrf;", {0x02128}},                           //ℨ
-        {"ZeroWidthSpace;", {0x0200B}},                   //​
-        {"Zeta;", {0x00396}},                             //Ζ
-        {"zeta;", {0x003B6}},                             //ζ
-        {"Zfr;", {0x02128}},                              //ℨ
-        {"zfr;", {0x1D537}},                              //𝔷
-        {"ZHcy;", {0x00416}},                             //Ж
-        {"zhcy;", {0x00436}},                             //ж
-        {"zigrarr;", {0x021DD}},                          //⇝
-        {"Zopf;", {0x02124}},                             //ℤ
-        {"zopf;", {0x1D56B}},                             //𝕫
-        {"Zscr;", {0x1D4B5}},                             //𝒵
-        {"zscr;", {0x1D4CF}},                             //𝓏
-        {"zwj;", {0x0200D}},                              //‍
-        {"zwnj;", {0x0200C}},                             //‌
-    };
-
-} // namespace webvtt
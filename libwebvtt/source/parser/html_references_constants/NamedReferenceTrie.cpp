@@ -0,0 +1,2354 @@
+#include "parser/NamedReferenceTrie.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace webvtt {
+
+namespace {
+
+struct NamedReference {
+  std::string_view name;
+  std::u32string_view value;
+};
+
+//https://html.spec.whatwg.org/multipage/named-characters.html
+constexpr NamedReference NAMED_REFERENCES[] = {
+    {"Aacute;", U"\U000000C1"},                             //Á
+    {"Aacute", U"\U000000C1"},                              //Á
+    {"aacute;", U"\U000000E1"},                             //á
+    {"aacute", U"\U000000E1"},                              //á
+    {"Abreve;", U"\U00000102"},                             //Ă
+    {"abreve;", U"\U00000103"},                             //ă
+    {"ac;", U"\U0000223E"},                                 //∾
+    {"acd;", U"\U0000223F"},                                //∿
+    {"acE;", U"\U0000223E\U00000333"},                      //acE;
+    {"Acirc;", U"\U000000C2"},                              //Â
+    {"Acirc", U"\U000000C2"},                               //Â
+    {"acirc;", U"\U000000E2"},                              //â
+    {"acirc", U"\U000000E2"},                               //â
+    {"acute;", U"\U000000B4"},                              //´
+    {"acute", U"\U000000B4"},                               //´
+    {"Acy;", U"\U00000410"},                                //А
+    {"acy;", U"\U00000430"},                                //а
+    {"AElig;", U"\U000000C6"},                              //Æ
+    {"AElig", U"\U000000C6"},                               //Æ
+    {"aelig;", U"\U000000E6"},                              //æ
+    {"aelig", U"\U000000E6"},                               //æ
+    {"af;", U"\U00002061"},                                 //⁡
+    {"Afr;", U"\U0001D504"},                                //𝔄
+    {"afr;", U"\U0001D51E"},                                //𝔞
+    {"Agrave;", U"\U000000C0"},                             //À
+    {"Agrave", U"\U000000C0"},                              //À
+    {"agrave;", U"\U000000E0"},                             //à
+    {"agrave", U"\U000000E0"},                              //à
+    {"alefsym;", U"\U00002135"},                            //ℵ
+    {"aleph;", U"\U00002135"},                              //ℵ
+    {"Alpha;", U"\U00000391"},                              //Α
+    {"alpha;", U"\U000003B1"},                              //α
+    {"Amacr;", U"\U00000100"},                              //Ā
+    {"amacr;", U"\U00000101"},                              //ā
+    {"amalg;", U"\U00002A3F"},                              //⨿
+    {"AMP;", U"\U00000026"},                                //&
+    {"AMP", U"\U00000026"},                                 //&
+    {"amp;", U"\U00000026"},                                //&
+    {"amp", U"\U00000026"},                                 //&
+    {"And;", U"\U00002A53"},                                //⩓
+    {"and;", U"\U00002227"},                                //∧
+    {"andand;", U"\U00002A55"},                             //⩕
+    {"andd;", U"\U00002A5C"},                               //⩜
+    {"andslope;", U"\U00002A58"},                           //⩘
+    {"andv;", U"\U00002A5A"},                               //⩚
+    {"ang;", U"\U00002220"},                                //∠
+    {"ange;", U"\U000029A4"},                               //⦤
+    {"angle;", U"\U00002220"},                              //∠
+    {"angmsd;", U"\U00002221"},                             //∡
+    {"angmsdaa;", U"\U000029A8"},                           //⦨
+    {"angmsdab;", U"\U000029A9"},                           //⦩
+    {"angmsdac;", U"\U000029AA"},                           //⦪
+    {"angmsdad;", U"\U000029AB"},                           //⦫
+    {"angmsdae;", U"\U000029AC"},                           //⦬
+    {"angmsdaf;", U"\U000029AD"},                           //⦭
+    {"angmsdag;", U"\U000029AE"},                           //⦮
+    {"angmsdah;", U"\U000029AF"},                           //⦯
+    {"angrt;", U"\U0000221F"},                              //∟
+    {"angrtvb;", U"\U000022BE"},                            //⊾
+    {"angrtvbd;", U"\U0000299D"},                           //⦝
+    {"angsph;", U"\U00002222"},                             //∢
+    {"angst;", U"\U000000C5"},                              //Å
+    {"angzarr;", U"\U0000237C"},                            //⍼
+    {"Aogon;", U"\U00000104"},                              //Ą
+    {"aogon;", U"\U00000105"},                              //ą
+    {"Aopf;", U"\U0001D538"},                               //𝔸
+    {"aopf;", U"\U0001D552"},                               //𝕒
+    {"ap;", U"\U00002248"},                                 //≈
+    {"apacir;", U"\U00002A6F"},                             //⩯
+    {"apE;", U"\U00002A70"},                                //⩰
+    {"ape;", U"\U0000224A"},                                //≊
+    {"apid;", U"\U0000224B"},                               //≋
+    {"apos;", U"\U00000027"},                               //'
+    {"ApplyFunction;", U"\U00002061"},                      //⁡
+    {"approx;", U"\U00002248"},                             //≈
+    {"approxeq;", U"\U0000224A"},                           //≊
+    {"Aring;", U"\U000000C5"},                              //Å
+    {"Aring", U"\U000000C5"},                               //Å
+    {"aring;", U"\U000000E5"},                              //å
+    {"aring", U"\U000000E5"},                               //å
+    {"Ascr;", U"\U0001D49C"},                               //𝒜
+    {"ascr;", U"\U0001D4B6"},                               //𝒶
+    {"Assign;", U"\U00002254"},                             //≔
+    {"ast;", U"\U0000002A"},                                //*
+    {"asymp;", U"\U00002248"},                              //≈
+    {"asympeq;", U"\U0000224D"},                            //≍
+    {"Atilde;", U"\U000000C3"},                             //Ã
+    {"Atilde", U"\U000000C3"},                              //Ã
+    {"atilde;", U"\U000000E3"},                             //ã
+    {"atilde", U"\U000000E3"},                              //ã
+    {"Auml;", U"\U000000C4"},                               //Ä
+    {"Auml", U"\U000000C4"},                                //Ä
+    {"auml;", U"\U000000E4"},                               //ä
+    {"auml", U"\U000000E4"},                                //ä
+    {"awconint;", U"\U00002233"},                           //∳
+    {"awint;", U"\U00002A11"},                              //⨑
+    {"backcong;", U"\U0000224C"},                           //≌
+    {"backepsilon;", U"\U000003F6"},                        //϶
+    {"backprime;", U"\U00002035"},                          //‵
+    {"backsim;", U"\U0000223D"},                            //∽
+    {"backsimeq;", U"\U000022CD"},                          //⋍
+    {"Backslash;", U"\U00002216"},                          //∖
+    {"Barv;", U"\U00002AE7"},                               //⫧
+    {"barvee;", U"\U000022BD"},                             //⊽
+    {"Barwed;", U"\U00002306"},                             //⌆
+    {"barwed;", U"\U00002305"},                             //⌅
+    {"barwedge;", U"\U00002305"},                           //⌅
+    {"bbrk;", U"\U000023B5"},                               //⎵
+    {"bbrktbrk;", U"\U000023B6"},                           //⎶
+    {"bcong;", U"\U0000224C"},                              //≌
+    {"Bcy;", U"\U00000411"},                                //Б
+    {"bcy;", U"\U00000431"},                                //б
+    {"bdquo;", U"\U0000201E"},                              //„
+    {"becaus;", U"\U00002235"},                             //∵
+    {"Because;", U"\U00002235"},                            //∵
+    {"because;", U"\U00002235"},                            //∵
+    {"bemptyv;", U"\U000029B0"},                            //⦰
+    {"bepsi;", U"\U000003F6"},                              //϶
+    {"bernou;", U"\U0000212C"},                             //ℬ
+    {"Bernoullis;", U"\U0000212C"},                         //ℬ
+    {"Beta;", U"\U00000392"},                               //Β
+    {"beta;", U"\U000003B2"},                               //β
+    {"beth;", U"\U00002136"},                               //ℶ
+    {"between;", U"\U0000226C"},                            //≬
+    {"Bfr;", U"\U0001D505"},                                //𝔅
+    {"bfr;", U"\U0001D51F"},                                //𝔟
+    {"bigcap;", U"\U000022C2"},                             //⋂
+    {"bigcirc;", U"\U000025EF"},                            //◯
+    {"bigcup;", U"\U000022C3"},                             //⋃
+    {"bigodot;", U"\U00002A00"},                            //⨀
+    {"bigoplus;", U"\U00002A01"},                           //⨁
+    {"bigotimes;", U"\U00002A02"},                          //⨂
+    {"bigsqcup;", U"\U00002A06"},                           //⨆
+    {"bigstar;", U"\U00002605"},                            //★
+    {"bigtriangledown;", U"\U000025BD"},                    //▽
+    {"bigtriangleup;", U"\U000025B3"},                      //△
+    {"biguplus;", U"\U00002A04"},                           //⨄
+    {"bigvee;", U"\U000022C1"},                             //⋁
+    {"bigwedge;", U"\U000022C0"},                           //⋀
+    {"bkarow;", U"\U0000290D"},                             //⤍
+    {"blacklozenge;", U"\U000029EB"},                       //⧫
+    {"blacksquare;", U"\U000025AA"},                        //▪
+    {"blacktriangle;", U"\U000025B4"},                      //▴
+    {"blacktriangledown;", U"\U000025BE"},                  //▾
+    {"blacktriangleleft;", U"\U000025C2"},                  //◂
+    {"blacktriangleright;", U"\U000025B8"},                 //▸
+    {"blank;", U"\U00002423"},                              //␣
+    {"blk12;", U"\U00002592"},                              //▒
+    {"blk14;", U"\U00002591"},                              //░
+    {"blk34;", U"\U00002593"},                              //▓
+    {"block;", U"\U00002588"},                              //█
+    {"bne;", U"\U0000003D\U000020E5"},                      //bne;
+    {"bnequiv;", U"\U00002261\U000020E5"},                  //bnequiv;
+    {"bNot;", U"\U00002AED"},                               //⫭
+    {"bnot;", U"\U00002310"},                               //⌐
+    {"Bopf;", U"\U0001D539"},                               //𝔹
+    {"bopf;", U"\U0001D553"},                               //𝕓
+    {"bot;", U"\U000022A5"},                                //⊥
+    {"bottom;", U"\U000022A5"},                             //⊥
+    {"bowtie;", U"\U000022C8"},                             //⋈
+    {"boxbox;", U"\U000029C9"},                             //⧉
+    {"boxDL;", U"\U00002557"},                              //╗
+    {"boxDl;", U"\U00002556"},                              //╖
+    {"boxdL;", U"\U00002555"},                              //╕
+    {"boxdl;", U"\U00002510"},                              //┐
+    {"boxDR;", U"\U00002554"},                              //╔
+    {"boxDr;", U"\U00002553"},                              //╓
+    {"boxdR;", U"\U00002552"},                              //╒
+    {"boxdr;", U"\U0000250C"},                              //┌
+    {"boxH;", U"\U00002550"},                               //═
+    {"boxh;", U"\U00002500"},                               //─
+    {"boxHD;", U"\U00002566"},                              //╦
+    {"boxHd;", U"\U00002564"},                              //╤
+    {"boxhD;", U"\U00002565"},                              //╥
+    {"boxhd;", U"\U0000252C"},                              //┬
+    {"boxHU;", U"\U00002569"},                              //╩
+    {"boxHu;", U"\U00002567"},                              //╧
+    {"boxhU;", U"\U00002568"},                              //╨
+    {"boxhu;", U"\U00002534"},                              //┴
+    {"boxminus;", U"\U0000229F"},                           //⊟
+    {"boxplus;", U"\U0000229E"},                            //⊞
+    {"boxtimes;", U"\U000022A0"},                           //⊠
+    {"boxUL;", U"\U0000255D"},                              //╝
+    {"boxUl;", U"\U0000255C"},                              //╜
+    {"boxuL;", U"\U0000255B"},                              //╛
+    {"boxul;", U"\U00002518"},                              //┘
+    {"boxUR;", U"\U0000255A"},                              //╚
+    {"boxUr;", U"\U00002559"},                              //╙
+    {"boxuR;", U"\U00002558"},                              //╘
+    {"boxur;", U"\U00002514"},                              //└
+    {"boxV;", U"\U00002551"},                               //║
+    {"boxv;", U"\U00002502"},                               //│
+    {"boxVH;", U"\U0000256C"},                              //╬
+    {"boxVh;", U"\U0000256B"},                              //╫
+    {"boxvH;", U"\U0000256A"},                              //╪
+    {"boxvh;", U"\U0000253C"},                              //┼
+    {"boxVL;", U"\U00002563"},                              //╣
+    {"boxVl;", U"\U00002562"},                              //╢
+    {"boxvL;", U"\U00002561"},                              //╡
+    {"boxvl;", U"\U00002524"},                              //┤
+    {"boxVR;", U"\U00002560"},                              //╠
+    {"boxVr;", U"\U0000255F"},                              //╟
+    {"boxvR;", U"\U0000255E"},                              //╞
+    {"boxvr;", U"\U0000251C"},                              //├
+    {"bprime;", U"\U00002035"},                             //‵
+    {"Breve;", U"\U000002D8"},                              //˘
+    {"breve;", U"\U000002D8"},                              //˘
+    {"brvbar;", U"\U000000A6"},                             //¦
+    {"brvbar", U"\U000000A6"},                              //¦
+    {"Bscr;", U"\U0000212C"},                               //ℬ
+    {"bscr;", U"\U0001D4B7"},                               //𝒷
+    {"bsemi;", U"\U0000204F"},                              //⁏
+    {"bsim;", U"\U0000223D"},                               //∽
+    {"bsime;", U"\U000022CD"},                              //⋍
+    {"bsol;", U"\U0000005C"},                               //new line
+    {"bsolb;", U"\U000029C5"},                              //⧅
+    {"bsolhsub;", U"\U000027C8"},                           //⟈
+    {"bull;", U"\U00002022"},                               //•
+    {"bullet;", U"\U00002022"},                             //•
+    {"bump;", U"\U0000224E"},                               //≎
+    {"bumpE;", U"\U00002AAE"},                              //⪮
+    {"bumpe;", U"\U0000224F"},                              //≏
+    {"Bumpeq;", U"\U0000224E"},                             //≎
+    {"bumpeq;", U"\U0000224F"},                             //≏
+    {"Cacute;", U"\U00000106"},                             //Ć
+    {"cacute;", U"\U00000107"},                             //ć
+    {"Cap;", U"\U000022D2"},                                //⋒
+    {"cap;", U"\U00002229"},                                //∩
+    {"capand;", U"\U00002A44"},                             //⩄
+    {"capbrcup;", U"\U00002A49"},                           //⩉
+    {"capcap;", U"\U00002A4B"},                             //⩋
+    {"capcup;", U"\U00002A47"},                             //⩇
+    {"capdot;", U"\U00002A40"},                             //⩀
+    {"CapitalDifferentialD;", U"\U00002145"},               //ⅅ
+    {"caps;", U"\U00002229\U0000FE00"},                     //caps;
+    {"caret;", U"\U00002041"},                              //⁁
+    {"caron;", U"\U000002C7"},                              //ˇ
+    {"Cayleys;", U"\U0000212D"},                            //ℭ
+    {"ccaps;", U"\U00002A4D"},                              //⩍
+    {"Ccaron;", U"\U0000010C"},                             //Č
+    {"ccaron;", U"\U0000010D"},                             //č
+    {"Ccedil;", U"\U000000C7"},                             //Ç
+    {"Ccedil", U"\U000000C7"},                              //Ç
+    {"ccedil;", U"\U000000E7"},                             //ç
+    {"ccedil", U"\U000000E7"},                              //ç
+    {"Ccirc;", U"\U00000108"},                              //Ĉ
+    {"ccirc;", U"\U00000109"},                              //ĉ
+    {"Cconint;", U"\U00002230"},                            //∰
+    {"ccups;", U"\U00002A4C"},                              //⩌
+    {"ccupssm;", U"\U00002A50"},                            //⩐
+    {"Cdot;", U"\U0000010A"},                               //Ċ
+    {"cdot;", U"\U0000010B"},                               //ċ
+    {"cedil;", U"\U000000B8"},                              //¸
+    {"cedil", U"\U000000B8"},                               //¸
+    {"Cedilla;", U"\U000000B8"},                            //¸
+    {"cemptyv;", U"\U000029B2"},                            //⦲
+    {"cent;", U"\U000000A2"},                               //¢
+    {"cent", U"\U000000A2"},                                //¢
+    {"CenterDot;", U"\U000000B7"},                          //·
+    {"centerdot;", U"\U000000B7"},                          //·
+    {"Cfr;", U"\U0000212D"},                                //ℭ
+    {"cfr;", U"\U0001D520"},                                //𝔠
+    {"CHcy;", U"\U00000427"},                               //Ч
+    {"chcy;", U"\U00000447"},                               //ч
+    {"check;", U"\U00002713"},                              //✓
+    {"checkmark;", U"\U00002713"},                          //✓
+    {"Chi;", U"\U000003A7"},                                //Χ
+    {"chi;", U"\U000003C7"},                                //χ
+    {"cir;", U"\U000025CB"},                                //○
+    {"circ;", U"\U000002C6"},                               //ˆ
+    {"circeq;", U"\U00002257"},                             //≗
+    {"circlearrowleft;", U"\U000021BA"},                    //↺
+    {"circlearrowright;", U"\U000021BB"},                   //↻
+    {"circledast;", U"\U0000229B"},                         //⊛
+    {"circledcirc;", U"\U0000229A"},                        //⊚
+    {"circleddash;", U"\U0000229D"},                        //⊝
+    {"CircleDot;", U"\U00002299"},                          //⊙
+    {"circledR;", U"\U000000AE"},                           //®
+    {"circledS;", U"\U000024C8"},                           //Ⓢ
+    {"CircleMinus;", U"\U00002296"},                        //⊖
+    {"CirclePlus;", U"\U00002295"},                         //⊕
+    {"CircleTimes;", U"\U00002297"},                        //⊗
+    {"cirE;", U"\U000029C3"},                               //⧃
+    {"cire;", U"\U00002257"},                               //≗
+    {"cirfnint;", U"\U00002A10"},                           //⨐
+    {"cirmid;", U"\U00002AEF"},                             //⫯
+    {"cirscir;", U"\U000029C2"},                            //⧂
+    {"ClockwiseContourIntegral;", U"\U00002232"},           //∲
+    {"CloseCurlyDoubleQuote;", U"\U0000201D"},              //”
+    {"CloseCurlyQuote;", U"\U00002019"},                    //’
+    {"clubs;", U"\U00002663"},                              //♣
+    {"clubsuit;", U"\U00002663"},                           //♣
+    {"Colon;", U"\U00002237"},                              //∷
+    {"colon;", U"\U0000003A"},                              //:
+    {"Colone;", U"\U00002A74"},                             //⩴
+    {"colone;", U"\U00002254"},                             //≔
+    {"coloneq;", U"\U00002254"},                            //≔
+    {"comma;", U"\U0000002C"},                              //,
+    {"commat;", U"\U00000040"},                             //@
+    {"comp;", U"\U00002201"},                               //∁
+    {"compfn;", U"\U00002218"},                             //∘
+    {"complement;", U"\U00002201"},                         //∁
+    {"complexes;", U"\U00002102"},                          //ℂ
+    {"cong;", U"\U00002245"},                               //≅
+    {"congdot;", U"\U00002A6D"},                            //⩭
+    {"Congruent;", U"\U00002261"},                          //≡
+    {"Conint;", U"\U0000222F"},                             //∯
+    {"conint;", U"\U0000222E"},                             //∮
+    {"ContourIntegral;", U"\U0000222E"},                    //∮
+    {"Copf;", U"\U00002102"},                               //ℂ
+    {"copf;", U"\U0001D554"},                               //𝕔
+    {"coprod;", U"\U00002210"},                             //∐
+    {"Coproduct;", U"\U00002210"},                          //∐
+    {"COPY;", U"\U000000A9"},                               //©
+    {"COPY", U"\U000000A9"},                                //©
+    {"copy;", U"\U000000A9"},                               //©
+    {"copy", U"\U000000A9"},                                //©
+    {"copysr;", U"\U00002117"},                             //℗
+    {"CounterClockwiseContourIntegral;", U"\U00002233"},    //∳
+    {"crarr;", U"\U000021B5"},                              //↵
+    {"Cross;", U"\U00002A2F"},                              //⨯
+    {"cross;", U"\U00002717"},                              //✗
+    {"Cscr;", U"\U0001D49E"},                               //𝒞
+    {"cscr;", U"\U0001D4B8"},                               //𝒸
+    {"csub;", U"\U00002ACF"},                               //⫏
+    {"csube;", U"\U00002AD1"},                              //⫑
+    {"csup;", U"\U00002AD0"},                               //⫐
+    {"csupe;", U"\U00002AD2"},                              //⫒
+    {"ctdot;", U"\U000022EF"},                              //⋯
+    {"cudarrl;", U"\U00002938"},                            //⤸
+    {"cudarrr;", U"\U00002935"},                            //⤵
+    {"cuepr;", U"\U000022DE"},                              //⋞
+    {"cuesc;", U"\U000022DF"},                              //⋟
+    {"cularr;", U"\U000021B6"},                             //↶
+    {"cularrp;", U"\U0000293D"},                            //⤽
+    {"Cup;", U"\U000022D3"},                                //⋓
+    {"cup;", U"\U0000222A"},                                //∪
+    {"cupbrcap;", U"\U00002A48"},                           //⩈
+    {"CupCap;", U"\U0000224D"},                             //≍
+    {"cupcap;", U"\U00002A46"},                             //⩆
+    {"cupcup;", U"\U00002A4A"},                             //⩊
+    {"cupdot;", U"\U0000228D"},                             //⊍
+    {"cupor;", U"\U00002A45"},                              //⩅
+    {"cups;", U"\U0000222A\U0000FE00"},                     //cups;
+    {"curarr;", U"\U000021B7"},                             //↷
+    {"curarrm;", U"\U0000293C"},                            //⤼
+    {"curlyeqprec;", U"\U000022DE"},                        //⋞
+    {"curlyeqsucc;", U"\U000022DF"},                        //⋟
+    {"curlyvee;", U"\U000022CE"},                           //⋎
+    {"curlywedge;", U"\U000022CF"},                         //⋏
+    {"curren;", U"\U000000A4"},                             //¤
+    {"curren", U"\U000000A4"},                              //¤
+    {"curvearrowleft;", U"\U000021B6"},                     //↶
+    {"curvearrowright;", U"\U000021B7"},                    //↷
+    {"cuvee;", U"\U000022CE"},                              //⋎
+    {"cuwed;", U"\U000022CF"},                              //⋏
+    {"cwconint;", U"\U00002232"},                           //∲
+    {"cwint;", U"\U00002231"},                              //∱
+    {"cylcty;", U"\U0000232D"},                             //⌭
+    {"Dagger;", U"\U00002021"},                             //‡
+    {"dagger;", U"\U00002020"},                             //†
+    {"daleth;", U"\U00002138"},                             //ℸ
+    {"Darr;", U"\U000021A1"},                               //↡
+    {"dArr;", U"\U000021D3"},                               //⇓
+    {"darr;", U"\U00002193"},                               //↓
+    {"dash;", U"\U00002010"},                               //‐
+    {"Dashv;", U"\U00002AE4"},                              //⫤
+    {"dashv;", U"\U000022A3"},                              //⊣
+    {"dbkarow;", U"\U0000290F"},                            //⤏
+    {"dblac;", U"\U000002DD"},                              //˝
+    {"Dcaron;", U"\U0000010E"},                             //Ď
+    {"dcaron;", U"\U0000010F"},                             //ď
+    {"Dcy;", U"\U00000414"},                                //Д
+    {"dcy;", U"\U00000434"},                                //д
+    {"DD;", U"\U00002145"},                                 //ⅅ
+    {"dd;", U"\U00002146"},                                 //ⅆ
+    {"ddagger;", U"\U00002021"},                            //‡
+    {"ddarr;", U"\U000021CA"},                              //⇊
+    {"DDotrahd;", U"\U00002911"},                           //⤑
+    {"ddotseq;", U"\U00002A77"},                            //⩷
+    {"deg;", U"\U000000B0"},                                //°
+    {"deg", U"\U000000B0"},                                 //°
+    {"Del;", U"\U00002207"},                                //∇
+    {"Delta;", U"\U00000394"},                              //Δ
+    {"delta;", U"\U000003B4"},                              //δ
+    {"demptyv;", U"\U000029B1"},                            //⦱
+    {"dfisht;", U"\U0000297F"},                             //⥿
+    {"Dfr;", U"\U0001D507"},                                //𝔇
+    {"dfr;", U"\U0001D521"},                                //𝔡
+    {"dHar;", U"\U00002965"},                               //⥥
+    {"dharl;", U"\U000021C3"},                              //⇃
+    {"dharr;", U"\U000021C2"},                              //⇂
+    {"DiacriticalAcute;", U"\U000000B4"},                   //´
+    {"DiacriticalDot;", U"\U000002D9"},                     //˙
+    {"DiacriticalDoubleAcute;", U"\U000002DD"},             //˝
+    {"DiacriticalGrave;", U"\U00000060"},                   //`
+    {"DiacriticalTilde;", U"\U000002DC"},                   //˜
+    {"diam;", U"\U000022C4"},                               //⋄
+    {"Diamond;", U"\U000022C4"},                            //⋄
+    {"diamond;", U"\U000022C4"},                            //⋄
+    {"diamondsuit;", U"\U00002666"},                        //♦
+    {"diams;", U"\U00002666"},                              //♦
+    {"die;", U"\U000000A8"},                                //¨
+    {"DifferentialD;", U"\U00002146"},                      //ⅆ
+    {"digamma;", U"\U000003DD"},                            //ϝ
+    {"disin;", U"\U000022F2"},                              //⋲
+    {"div;", U"\U000000F7"},                                //÷
+    {"divide;", U"\U000000F7"},                             //÷
+    {"divide", U"\U000000F7"},                              //÷
+    {"divideontimes;", U"\U000022C7"},                      //⋇
+    {"divonx;", U"\U000022C7"},                             //⋇
+    {"DJcy;", U"\U00000402"},                               //Ђ
+    {"djcy;", U"\U00000452"},                               //ђ
+    {"dlcorn;", U"\U0000231E"},                             //⌞
+    {"dlcrop;", U"\U0000230D"},                             //⌍
+    {"dollar;", U"\U00000024"},                             //$
+    {"Dopf;", U"\U0001D53B"},                               //𝔻
+    {"dopf;", U"\U0001D555"},                               //𝕕
+    {"Dot;", U"\U000000A8"},                                //¨
+    {"dot;", U"\U000002D9"},                                //˙
+    {"DotDot;", U"\U000020DC"},                             //◌⃜
+    {"doteq;", U"\U00002250"},                              //≐
+    {"doteqdot;", U"\U00002251"},                           //≑
+    {"DotEqual;", U"\U00002250"},                           //≐
+    {"dotminus;", U"\U00002238"},                           //∸
+    {"dotplus;", U"\U00002214"},                            //∔
+    {"dotsquare;", U"\U000022A1"},                          //⊡
+    {"doublebarwedge;", U"\U00002306"},                     //⌆
+    {"DoubleContourIntegral;", U"\U0000222F"},              //∯
+    {"DoubleDot;", U"\U000000A8"},                          //¨
+    {"DoubleDownArrow;", U"\U000021D3"},                    //⇓
+    {"DoubleLeftArrow;", U"\U000021D0"},                    //⇐
+    {"DoubleLeftRightArrow;", U"\U000021D4"},               //⇔
+    {"DoubleLeftTee;", U"\U00002AE4"},                      //⫤
+    {"DoubleLongLeftArrow;", U"\U000027F8"},                //⟸
+    {"DoubleLongLeftRightArrow;", U"\U000027FA"},           //⟺
+    {"DoubleLongRightArrow;", U"\U000027F9"},               //⟹
+    {"DoubleRightArrow;", U"\U000021D2"},                   //⇒
+    {"DoubleRightTee;", U"\U000022A8"},                     //⊨
+    {"DoubleUpArrow;", U"\U000021D1"},                      //⇑
+    {"DoubleUpDownArrow;", U"\U000021D5"},                  //⇕
+    {"DoubleVerticalBar;", U"\U00002225"},                  //∥
+    {"DownArrow;", U"\U00002193"},                          //↓
+    {"Downarrow;", U"\U000021D3"},                          //⇓
+    {"downarrow;", U"\U00002193"},                          //↓
+    {"DownArrowBar;", U"\U00002913"},                       //⤓
+    {"DownArrowUpArrow;", U"\U000021F5"},                   //⇵
+    {"DownBreve;", U"\U00000311"},                          //◌̑
+    {"downdownarrows;", U"\U000021CA"},                     //⇊
+    {"downharpoonleft;", U"\U000021C3"},                    //⇃
+    {"downharpoonright;", U"\U000021C2"},                   //⇂
+    {"DownLeftRightVector;", U"\U00002950"},                //⥐
+    {"DownLeftTeeVector;", U"\U0000295E"},                  //⥞
+    {"DownLeftVector;", U"\U000021BD"},                     //↽
+    {"DownLeftVectorBar;", U"\U00002956"},                  //⥖
+    {"DownRightTeeVector;", U"\U0000295F"},                 //⥟
+    {"DownRightVector;", U"\U000021C1"},                    //⇁
+    {"DownRightVectorBar;", U"\U00002957"},                 //⥗
+    {"DownTee;", U"\U000022A4"},                            //⊤
+    {"DownTeeArrow;", U"\U000021A7"},                       //↧
+    {"drbkarow;", U"\U00002910"},                           //⤐
+    {"drcorn;", U"\U0000231F"},                             //⌟
+    {"drcrop;", U"\U0000230C"},                             //⌌
+    {"Dscr;", U"\U0001D49F"},                               //𝒟
+    {"dscr;", U"\U0001D4B9"},                               //𝒹
+    {"DScy;", U"\U00000405"},                               //Ѕ
+    {"dscy;", U"\U00000455"},                               //ѕ
+    {"dsol;", U"\U000029F6"},                               //⧶
+    {"Dstrok;", U"\U00000110"},                             //Đ
+    {"dstrok;", U"\U00000111"},                             //đ
+    {"dtdot;", U"\U000022F1"},                              //⋱
+    {"dtri;", U"\U000025BF"},                               //▿
+    {"dtrif;", U"\U000025BE"},                              //▾
+    {"duarr;", U"\U000021F5"},                              //⇵
+    {"duhar;", U"\U0000296F"},                              //⥯
+    {"dwangle;", U"\U000029A6"},                            //⦦
+    {"DZcy;", U"\U0000040F"},                               //Џ
+    {"dzcy;", U"\U0000045F"},                               //џ
+    {"dzigrarr;", U"\U000027FF"},                           //⟿
+    {"Eacute;", U"\U000000C9"},                             //É
+    {"Eacute", U"\U000000C9"},                              //É
+    {"eacute;", U"\U000000E9"},                             //é
+    {"eacute", U"\U000000E9"},                              //é
+    {"easter;", U"\U00002A6E"},                             //⩮
+    {"Ecaron;", U"\U0000011A"},                             //Ě
+    {"ecaron;", U"\U0000011B"},                             //ě
+    {"ecir;", U"\U00002256"},                               //≖
+    {"Ecirc;", U"\U000000CA"},                              //Ê
+    {"Ecirc", U"\U000000CA"},                               //Ê
+    {"ecirc;", U"\U000000EA"},                              //ê
+    {"ecirc", U"\U000000EA"},                               //ê
+    {"ecolon;", U"\U00002255"},                             //≕
+    {"Ecy;", U"\U0000042D"},                                //Э
+    {"ecy;", U"\U0000044D"},                                //э
+    {"eDDot;", U"\U00002A77"},                              //⩷
+    {"Edot;", U"\U00000116"},                               //Ė
+    {"eDot;", U"\U00002251"},                               //≑
+    {"edot;", U"\U00000117"},                               //ė
+    {"ee;", U"\U00002147"},                                 //ⅇ
+    {"efDot;", U"\U00002252"},                              //≒
+    {"Efr;", U"\U0001D508"},                                //𝔈
+    {"efr;", U"\U0001D522"},                                //𝔢
+    {"eg;", U"\U00002A9A"},                                 //⪚
+    {"Egrave;", U"\U000000C8"},                             //È
+    {"Egrave", U"\U000000C8"},                              //È
+    {"egrave;", U"\U000000E8"},                             //è
+    {"egrave", U"\U000000E8"},                              //è
+    {"egs;", U"\U00002A96"},                                //⪖
+    {"egsdot;", U"\U00002A98"},                             //⪘
+    {"el;", U"\U00002A99"},                                 //⪙
+    {"Element;", U"\U00002208"},                            //∈
+    {"elinters;", U"\U000023E7"},                           //⏧
+    {"ell;", U"\U00002113"},                                //ℓ
+    {"els;", U"\U00002A95"},                                //⪕
+    {"elsdot;", U"\U00002A97"},                             //⪗
+    {"Emacr;", U"\U00000112"},                              //Ē
+    {"emacr;", U"\U00000113"},                              //ē
+    {"empty;", U"\U00002205"},                              //∅
+    {"emptyset;", U"\U00002205"},                           //∅
+    {"EmptySmallSquare;", U"\U000025FB"},                   //◻
+    {"emptyv;", U"\U00002205"},                             //∅
+    {"EmptyVerySmallSquare;", U"\U000025AB"},               //▫
+    {"emsp;", U"\U00002003"},                               //emsp
+    {"emsp13;", U"\U00002004"},                             //emsp13
+    {"emsp14;", U"\U00002005"},                             //emsp14
+    {"ENG;", U"\U0000014A"},                                //Ŋ
+    {"eng;", U"\U0000014B"},                                //ŋ
+    {"ensp;", U"\U00002002"},                               //ensp
+    {"Eogon;", U"\U00000118"},                              //Ę
+    {"eogon;", U"\U00000119"},                              //ę
+    {"Eopf;", U"\U0001D53C"},                               //𝔼
+    {"eopf;", U"\U0001D556"},                               //𝕖
+    {"epar;", U"\U000022D5"},                               //⋕
+    {"eparsl;", U"\U000029E3"},                             //⧣
+    {"eplus;", U"\U00002A71"},                              //⩱
+    {"epsi;", U"\U000003B5"},                               //ε
+    {"Epsilon;", U"\U00000395"},                            //Ε
+    {"epsilon;", U"\U000003B5"},                            //ε
+    {"epsiv;", U"\U000003F5"},                              //ϵ
+    {"eqcirc;", U"\U00002256"},                             //≖
+    {"eqcolon;", U"\U00002255"},                            //≕
+    {"eqsim;", U"\U00002242"},                              //≂
+    {"eqslantgtr;", U"\U00002A96"},                         //⪖
+    {"eqslantless;", U"\U00002A95"},                        //⪕
+    {"Equal;", U"\U00002A75"},                              //⩵
+    {"equals;", U"\U0000003D"},                             //=
+    {"EqualTilde;", U"\U00002242"},                         //≂
+    {"equest;", U"\U0000225F"},                             //≟
+    {"Equilibrium;", U"\U000021CC"},                        //⇌
+    {"equiv;", U"\U00002261"},                              //≡
+    {"equivDD;", U"\U00002A78"},                            //⩸
+    {"eqvparsl;", U"\U000029E5"},                           //⧥
+    {"erarr;", U"\U00002971"},                              //⥱
+    {"erDot;", U"\U00002253"},                              //≓
+    {"Escr;", U"\U00002130"},                               //ℰ
+    {"escr;", U"\U0000212F"},                               //ℯ
+    {"esdot;", U"\U00002250"},                              //≐
+    {"Esim;", U"\U00002A73"},                               //⩳
+    {"esim;", U"\U00002242"},                               //≂
+    {"Eta;", U"\U00000397"},                                //Η
+    {"eta;", U"\U000003B7"},                                //η
+    {"ETH;", U"\U000000D0"},                                //Ð
+    {"ETH", U"\U000000D0"},                                 //Ð
+    {"eth;", U"\U000000F0"},                                //ð
+    {"eth", U"\U000000F0"},                                 //ð
+    {"Euml;", U"\U000000CB"},                               //Ë
+    {"Euml", U"\U000000CB"},                                //Ë
+    {"euml;", U"\U000000EB"},                               //ë
+    {"euml", U"\U000000EB"},                                //ë
+    {"euro;", U"\U000020AC"},                               //€
+    {"excl;", U"\U00000021"},                               //!
+    {"exist;", U"\U00002203"},                              //∃
+    {"Exists;", U"\U00002203"},                             //∃
+    {"expectation;", U"\U00002130"},                        //ℰ
+    {"ExponentialE;", U"\U00002147"},                       //ⅇ
+    {"exponentiale;", U"\U00002147"},                       //ⅇ
+    {"fallingdotseq;", U"\U00002252"},                      //≒
+    {"Fcy;", U"\U00000424"},                                //Ф
+    {"fcy;", U"\U00000444"},                                //ф
+    {"female;", U"\U00002640"},                             //♀
+    {"ffilig;", U"\U0000FB03"},                             //ﬃ
+    {"fflig;", U"\U0000FB00"},                              //ﬀ
+    {"ffllig;", U"\U0000FB04"},                             //ﬄ
+    {"Ffr;", U"\U0001D509"},                                //𝔉
+    {"ffr;", U"\U0001D523"},                                //𝔣
+    {"filig;", U"\U0000FB01"},                              //ﬁ
+    {"FilledSmallSquare;", U"\U000025FC"},                  //◼
+    {"FilledVerySmallSquare;", U"\U000025AA"},              //▪
+    {"fjlig;", U"\U00000066\U0000006A"},                    //fjlig;
+    {"flat;", U"\U0000266D"},                               //♭
+    {"fllig;", U"\U0000FB02"},                              //ﬂ
+    {"fltns;", U"\U000025B1"},                              //▱
+    {"fnof;", U"\U00000192"},                               //ƒ
+    {"Fopf;", U"\U0001D53D"},                               //𝔽
+    {"fopf;", U"\U0001D557"},                               //𝕗
+    {"ForAll;", U"\U00002200"},                             //∀
+    {"forall;", U"\U00002200"},                             //∀
+    {"fork;", U"\U000022D4"},                               //⋔
+    {"forkv;", U"\U00002AD9"},                              //⫙
+    {"Fouriertrf;", U"\U00002131"},                         //ℱ
+    {"fpartint;", U"\U00002A0D"},                           //⨍
+    {"frac12;", U"\U000000BD"},                             //½
+    {"frac12", U"\U000000BD"},                              //½
+    {"frac13;", U"\U00002153"},                             //⅓
+    {"frac14;", U"\U000000BC"},                             //¼
+    {"frac14", U"\U000000BC"},                              //¼
+    {"frac15;", U"\U00002155"},                             //⅕
+    {"frac16;", U"\U00002159"},                             //⅙
+    {"frac18;", U"\U0000215B"},                             //⅛
+    {"frac23;", U"\U00002154"},                             //⅔
+    {"frac25;", U"\U00002156"},                             //⅖
+    {"frac34;", U"\U000000BE"},                             //¾
+    {"frac34", U"\U000000BE"},                              //¾
+    {"frac35;", U"\U00002157"},                             //⅗
+    {"frac38;", U"\U0000215C"},                             //⅜
+    {"frac45;", U"\U00002158"},                             //⅘
+    {"frac56;", U"\U0000215A"},                             //⅚
+    {"frac58;", U"\U0000215D"},                             //⅝
+    {"frac78;", U"\U0000215E"},                             //⅞
+    {"frasl;", U"\U00002044"},                              //⁄
+    {"frown;", U"\U00002322"},                              //⌢
+    {"Fscr;", U"\U00002131"},                               //ℱ
+    {"fscr;", U"\U0001D4BB"},                               //𝒻
+    {"gacute;", U"\U000001F5"},                             //ǵ
+    {"Gamma;", U"\U00000393"},                              //Γ
+    {"gamma;", U"\U000003B3"},                              //γ
+    {"Gammad;", U"\U000003DC"},                             //Ϝ
+    {"gammad;", U"\U000003DD"},                             //ϝ
+    {"gap;", U"\U00002A86"},                                //⪆
+    {"Gbreve;", U"\U0000011E"},                             //Ğ
+    {"gbreve;", U"\U0000011F"},                             //ğ
+    {"Gcedil;", U"\U00000122"},                             //Ģ
+    {"Gcirc;", U"\U0000011C"},                              //Ĝ
+    {"gcirc;", U"\U0000011D"},                              //ĝ
+    {"Gcy;", U"\U00000413"},                                //Г
+    {"gcy;", U"\U00000433"},                                //г
+    {"Gdot;", U"\U00000120"},                               //Ġ
+    {"gdot;", U"\U00000121"},                               //ġ
+    {"gE;", U"\U00002267"},                                 //≧
+    {"ge;", U"\U00002265"},                                 //≥
+    {"gEl;", U"\U00002A8C"},                                //⪌
+    {"gel;", U"\U000022DB"},                                //⋛
+    {"geq;", U"\U00002265"},                                //≥
+    {"geqq;", U"\U00002267"},                               //≧
+    {"geqslant;", U"\U00002A7E"},                           //⩾
+    {"ges;", U"\U00002A7E"},                                //⩾
+    {"gescc;", U"\U00002AA9"},                              //⪩
+    {"gesdot;", U"\U00002A80"},                             //⪀
+    {"gesdoto;", U"\U00002A82"},                            //⪂
+    {"gesdotol;", U"\U00002A84"},                           //⪄
+    {"gesl;", U"\U000022DB\U0000FE00"},                     //gesl;
+    {"gesles;", U"\U00002A94"},                             //⪔
+    {"Gfr;", U"\U0001D50A"},                                //𝔊
+    {"gfr;", U"\U0001D524"},                                //𝔤
+    {"Gg;", U"\U000022D9"},                                 //⋙
+    {"gg;", U"\U0000226B"},                                 //≫
+    {"ggg;", U"\U000022D9"},                                //⋙
+    {"gimel;", U"\U00002137"},                              //ℷ
+    {"GJcy;", U"\U00000403"},                               //Ѓ
+    {"gjcy;", U"\U00000453"},                               //ѓ
+    {"gl;", U"\U00002277"},                                 //≷
+    {"gla;", U"\U00002AA5"},                                //⪥
+    {"glE;", U"\U00002A92"},                                //⪒
+    {"glj;", U"\U00002AA4"},                                //⪤
+    {"gnap;", U"\U00002A8A"},                               //⪊
+    {"gnapprox;", U"\U00002A8A"},                           //⪊
+    {"gnE;", U"\U00002269"},                                //≩
+    {"gne;", U"\U00002A88"},                                //⪈
+    {"gneq;", U"\U00002A88"},                               //⪈
+    {"gneqq;", U"\U00002269"},                              //≩
+    {"gnsim;", U"\U000022E7"},                              //⋧
+    {"Gopf;", U"\U0001D53E"},                               //𝔾
+    {"gopf;", U"\U0001D558"},                               //𝕘
+    {"grave;", U"\U00000060"},                              //`
+    {"GreaterEqual;", U"\U00002265"},                       //≥
+    {"GreaterEqualLess;", U"\U000022DB"},                   //⋛
+    {"GreaterFullEqual;", U"\U00002267"},                   //≧
+    {"GreaterGreater;", U"\U00002AA2"},                     //⪢
+    {"GreaterLess;", U"\U00002277"},                        //≷
+    {"GreaterSlantEqual;", U"\U00002A7E"},                  //⩾
+    {"GreaterTilde;", U"\U00002273"},                       //≳
+    {"Gscr;", U"\U0001D4A2"},                               //𝒢
+    {"gscr;", U"\U0000210A"},                               //ℊ
+    {"gsim;", U"\U00002273"},                               //≳
+    {"gsime;", U"\U00002A8E"},                              //⪎
+    {"gsiml;", U"\U00002A90"},                              //⪐
+    {"GT;", U"\U0000003E"},                                 //>
+    {"GT", U"\U0000003E"},                                  //>
+    {"Gt;", U"\U0000226B"},                                 //≫
+    {"gt;", U"\U0000003E"},                                 //>
+    {"gt", U"\U0000003E"},                                  //>
+    {"gtcc;", U"\U00002AA7"},                               //⪧
+    {"gtcir;", U"\U00002A7A"},                              //⩺
+    {"gtdot;", U"\U000022D7"},                              //⋗
+    {"gtlPar;", U"\U00002995"},                             //⦕
+    {"gtquest;", U"\U00002A7C"},                            //⩼
+    {"gtrapprox;", U"\U00002A86"},                          //⪆
+    {"gtrarr;", U"\U00002978"},                             //⥸
+    {"gtrdot;", U"\U000022D7"},                             //⋗
+    {"gtreqless;", U"\U000022DB"},                          //⋛
+    {"gtreqqless;", U"\U00002A8C"},                         //⪌
+    {"gtrless;", U"\U00002277"},                            //≷
+    {"gtrsim;", U"\U00002273"},                             //≳
+    {"gvertneqq;", U"\U00002269\U0000FE00"},                //gvertneqq;
+    {"gvnE;", U"\U00002269\U0000FE00"},                     //gvnE;
+    {"Hacek;", U"\U000002C7"},                              //ˇ
+    {"hairsp;", U"\U0000200A"},                             //hairsp;
+    {"half;", U"\U000000BD"},                               //½
+    {"hamilt;", U"\U0000210B"},                             //ℋ
+    {"HARDcy;", U"\U0000042A"},                             //Ъ
+    {"hardcy;", U"\U0000044A"},                             //ъ
+    {"hArr;", U"\U000021D4"},                               //⇔
+    {"harr;", U"\U00002194"},                               //↔
+    {"harrcir;", U"\U00002948"},                            //⥈
+    {"harrw;", U"\U000021AD"},                              //↭
+    {"Hat;", U"\U0000005E"},                                //^
+    {"hbar;", U"\U0000210F"},                               //ℏ
+    {"Hcirc;", U"\U00000124"},                              //Ĥ
+    {"hcirc;", U"\U00000125"},                              //ĥ
+    {"hearts;", U"\U00002665"},                             //♥
+    {"heartsuit;", U"\U00002665"},                          //♥
+    {"hellip;", U"\U00002026"},                             //…
+    {"hercon;", U"\U000022B9"},                             //⊹
+    {"Hfr;", U"\U0000210C"},                                //ℌ
+    {"hfr;", U"\U0001D525"},                                //𝔥
+    {"HilbertSpace;", U"\U0000210B"},                       //ℋ
+    {"hksearow;", U"\U00002925"},                           //⤥
+    {"hkswarow;", U"\U00002926"},                           //⤦
+    {"hoarr;", U"\U000021FF"},                              //⇿
+    {"homtht;", U"\U0000223B"},                             //∻
+    {"hookleftarrow;", U"\U000021A9"},                      //↩
+    {"hookrightarrow;", U"\U000021AA"},                     //↪
+    {"Hopf;", U"\U0000210D"},                               //ℍ
+    {"hopf;", U"\U0001D559"},                               //𝕙
+    {"horbar;", U"\U00002015"},                             //―
+    {"HorizontalLine;", U"\U00002500"},                     //─
+    {"Hscr;", U"\U0000210B"},                               //ℋ
+    {"hscr;", U"\U0001D4BD"},                               //𝒽
+    {"hslash;", U"\U0000210F"},                             //ℏ
+    {"Hstrok;", U"\U00000126"},                             //Ħ
+    {"hstrok;", U"\U00000127"},                             //ħ
+    {"HumpDownHump;", U"\U0000224E"},                       //≎
+    {"HumpEqual;", U"\U0000224F"},                          //≏
+    {"hybull;", U"\U00002043"},                             //⁃
+    {"hyphen;", U"\U00002010"},                             //‐
+    {"Iacute;", U"\U000000CD"},                             //Í
+    {"Iacute", U"\U000000CD"},                              //Í
+    {"iacute;", U"\U000000ED"},                             //í
+    {"iacute", U"\U000000ED"},                              //í
+    {"ic;", U"\U00002063"},                                 //⁣
+    {"Icirc;", U"\U000000CE"},                              //Î
+    {"Icirc", U"\U000000CE"},                               //Î
+    {"icirc;", U"\U000000EE"},                              //î
+    {"icirc", U"\U000000EE"},                               //î
+    {"Icy;", U"\U00000418"},                                //И
+    {"icy;", U"\U00000438"},                                //и
+    {"Idot;", U"\U00000130"},                               //İ
+    {"IEcy;", U"\U00000415"},                               //Е
+    {"iecy;", U"\U00000435"},                               //е
+    {"iexcl;", U"\U000000A1"},                              //¡
+    {"iexcl", U"\U000000A1"},                               //¡
+    {"iff;", U"\U000021D4"},                                //⇔
+    {"Ifr;", U"\U00002111"},                                //ℑ
+    {"ifr;", U"\U0001D526"},                                //𝔦
+    {"Igrave;", U"\U000000CC"},                             //Ì
+    {"Igrave", U"\U000000CC"},                              //Ì
+    {"igrave;", U"\U000000EC"},                             //ì
+    {"igrave", U"\U000000EC"},                              //ì
+    {"ii;", U"\U00002148"},                                 //ⅈ
+    {"iiiint;", U"\U00002A0C"},                             //⨌
+    {"iiint;", U"\U0000222D"},                              //∭
+    {"iinfin;", U"\U000029DC"},                             //⧜
+    {"iiota;", U"\U00002129"},                              //℩
+    {"IJlig;", U"\U00000132"},                              //Ĳ
+    {"ijlig;", U"\U00000133"},                              //ĳ
+    {"Im;", U"\U00002111"},                                 //ℑ
+    {"Imacr;", U"\U0000012A"},                              //Ī
+    {"imacr;", U"\U0000012B"},                              //ī
+    {"image;", U"\U00002111"},                              //ℑ
+    {"ImaginaryI;", U"\U00002148"},                         //ⅈ
+    {"imagline;", U"\U00002110"},                           //ℐ
+    {"imagpart;", U"\U00002111"},                           //ℑ
+    {"imath;", U"\U00000131"},                              //ı
+    {"imof;", U"\U000022B7"},                               //⊷
+    {"imped;", U"\U000001B5"},                              //Ƶ
+    {"Implies;", U"\U000021D2"},                            //⇒
+    {"in;", U"\U00002208"},                                 //∈
+    {"incare;", U"\U00002105"},                             //℅
+    {"infin;", U"\U0000221E"},                              //∞
+    {"infintie;", U"\U000029DD"},                           //⧝
+    {"inodot;", U"\U00000131"},                             //ı
+    {"Int;", U"\U0000222C"},                                //∬
+    {"int;", U"\U0000222B"},                                //∫
+    {"intcal;", U"\U000022BA"},                             //⊺
+    {"integers;", U"\U00002124"},                           //ℤ
+    {"Integral;", U"\U0000222B"},                           //∫
+    {"intercal;", U"\U000022BA"},                           //⊺
+    {"Intersection;", U"\U000022C2"},                       //⋂
+    {"intlarhk;", U"\U00002A17"},                           //⨗
+    {"intprod;", U"\U00002A3C"},                            //⨼
+    {"InvisibleComma;", U"\U00002063"},                     //⁣
+    {"InvisibleTimes;", U"\U00002062"},                     //⁢
+    {"IOcy;", U"\U00000401"},                               //Ё
+    {"iocy;", U"\U00000451"},                               //ё
+    {"Iogon;", U"\U0000012E"},                              //Į
+    {"iogon;", U"\U0000012F"},                              //į
+    {"Iopf;", U"\U0001D540"},                               //𝕀
+    {"iopf;", U"\U0001D55A"},                               //𝕚
+    {"Iota;", U"\U00000399"},                               //Ι
+    {"iota;", U"\U000003B9"},                               //ι
+    {"iprod;", U"\U00002A3C"},                              //⨼
+    {"iquest;", U"\U000000BF"},                             //¿
+    {"iquest", U"\U000000BF"},                              //¿
+    {"Iscr;", U"\U00002110"},                               //ℐ
+    {"iscr;", U"\U0001D4BE"},                               //𝒾
+    {"isin;", U"\U00002208"},                               //∈
+    {"isindot;", U"\U000022F5"},                            //⋵
+    {"isinE;", U"\U000022F9"},                              //⋹
+    {"isins;", U"\U000022F4"},                              //⋴
+    {"isinsv;", U"\U000022F3"},                             //⋳
+    {"isinv;", U"\U00002208"},                              //∈
+    {"it;", U"\U00002062"},                                 //⁢
+    {"Itilde;", U"\U00000128"},                             //Ĩ
+    {"itilde;", U"\U00000129"},                             //ĩ
+    {"Iukcy;", U"\U00000406"},                              //І
+    {"iukcy;", U"\U00000456"},                              //і
+    {"Iuml;", U"\U000000CF"},                               //Ï
+    {"Iuml", U"\U000000CF"},                                //Ï
+    {"iuml;", U"\U000000EF"},                               //ï
+    {"iuml", U"\U000000EF"},                                //ï
+    {"Jcirc;", U"\U00000134"},                              //Ĵ
+    {"jcirc;", U"\U00000135"},                              //ĵ
+    {"Jcy;", U"\U00000419"},                                //Й
+    {"jcy;", U"\U00000439"},                                //й
+    {"Jfr;", U"\U0001D50D"},                                //𝔍
+    {"jfr;", U"\U0001D527"},                                //𝔧
+    {"jmath;", U"\U00000237"},                              //ȷ
+    {"Jopf;", U"\U0001D541"},                               //𝕁
+    {"jopf;", U"\U0001D55B"},                               //𝕛
+    {"Jscr;", U"\U0001D4A5"},                               //𝒥
+    {"jscr;", U"\U0001D4BF"},                               //𝒿
+    {"Jsercy;", U"\U00000408"},                             //Ј
+    {"jsercy;", U"\U00000458"},                             //ј
+    {"Jukcy;", U"\U00000404"},                              //Є
+    {"jukcy;", U"\U00000454"},                              //є
+    {"Kappa;", U"\U0000039A"},                              //Κ
+    {"kappa;", U"\U000003BA"},                              //κ
+    {"kappav;", U"\U000003F0"},                             //ϰ
+    {"Kcedil;", U"\U00000136"},                             //Ķ
+    {"kcedil;", U"\U00000137"},                             //ķ
+    {"Kcy;", U"\U0000041A"},                                //К
+    {"kcy;", U"\U0000043A"},                                //к
+    {"Kfr;", U"\U0001D50E"},                                //𝔎
+    {"kfr;", U"\U0001D528"},                                //𝔨
+    {"kgreen;", U"\U00000138"},                             //ĸ
+    {"KHcy;", U"\U00000425"},                               //Х
+    {"khcy;", U"\U00000445"},                               //х
+    {"KJcy;", U"\U0000040C"},                               //Ќ
+    {"kjcy;", U"\U0000045C"},                               //ќ
+    {"Kopf;", U"\U0001D542"},                               //𝕂
+    {"kopf;", U"\U0001D55C"},                               //𝕜
+    {"Kscr;", U"\U0001D4A6"},                               //𝒦
+    {"kscr;", U"\U0001D4C0"},                               //𝓀
+    {"lAarr;", U"\U000021DA"},                              //⇚
+    {"Lacute;", U"\U00000139"},                             //Ĺ
+    {"lacute;", U"\U0000013A"},                             //ĺ
+    {"laemptyv;", U"\U000029B4"},                           //⦴
+    {"lagran;", U"\U00002112"},                             //ℒ
+    {"Lambda;", U"\U0000039B"},                             //Λ
+    {"lambda;", U"\U000003BB"},                             //λ
+    {"Lang;", U"\U000027EA"},                               //⟪
+    {"lang;", U"\U000027E8"},                               //⟨
+    {"langd;", U"\U00002991"},                              //⦑
+    {"langle;", U"\U000027E8"},                             //〈
+    {"lap;", U"\U00002A85"},                                //⪅
+    {"Laplacetrf;", U"\U00002112"},                         //ℒ
+    {"laquo;", U"\U000000AB"},                              //«
+    {"laquo", U"\U000000AB"},                               //«
+    {"Larr;", U"\U0000219E"},                               //↞
+    {"lArr;", U"\U000021D0"},                               //⇐
+    {"larr;", U"\U00002190"},                               //←
+    {"larrb;", U"\U000021E4"},                              //⇤
+    {"larrbfs;", U"\U0000291F"},                            //⤟
+    {"larrfs;", U"\U0000291D"},                             //⤝
+    {"larrhk;", U"\U000021A9"},                             //↩
+    {"larrlp;", U"\U000021AB"},                             //↫
+    {"larrpl;", U"\U00002939"},                             //⤹
+    {"larrsim;", U"\U00002973"},                            //⥳
+    {"larrtl;", U"\U000021A2"},                             //↢
+    {"lat;", U"\U00002AAB"},                                //⪫
+    {"lAtail;", U"\U0000291B"},                             //⤛
+    {"latail;", U"\U00002919"},                             //⤙
+    {"late;", U"\U00002AAD"},                               //⪭
+    {"lates;", U"\U00002AAD\U0000FE00"},                    //lates;
+    {"lBarr;", U"\U0000290E"},                              //⤎
+    {"lbarr;", U"\U0000290C"},                              //⤌
+    {"lbbrk;", U"\U00002772"},                              //❲
+    {"lbrace;", U"\U0000007B"},                             //{
+    {"lbrack;", U"\U0000005B"},                             //[
+    {"lbrke;", U"\U0000298B"},                              //⦋
+    {"lbrksld;", U"\U0000298F"},                            //⦏
+    {"lbrkslu;", U"\U0000298D"},                            //⦍
+    {"Lcaron;", U"\U0000013D"},                             //Ľ
+    {"lcaron;", U"\U0000013E"},                             //ľ
+    {"Lcedil;", U"\U0000013B"},                             //Ļ
+    {"lcedil;", U"\U0000013C"},                             //ļ
+    {"lceil;", U"\U00002308"},                              //⌈
+    {"lcub;", U"\U0000007B"},                               //{
+    {"Lcy;", U"\U0000041B"},                                //Л
+    {"lcy;", U"\U0000043B"},                                //л
+    {"ldca;", U"\U00002936"},                               //⤶
+    {"ldquo;", U"\U0000201C"},                              //“
+    {"ldquor;", U"\U0000201E"},                             //„
+    {"ldrdhar;", U"\U00002967"},                            //⥧
+    {"ldrushar;", U"\U0000294B"},                           //⥋
+    {"ldsh;", U"\U000021B2"},                               //↲
+    {"lE;", U"\U00002266"},                                 //≦
+    {"le;", U"\U00002264"},                                 //≤
+    {"LeftAngleBracket;", U"\U000027E8"},                   //〈
+    {"LeftArrow;", U"\U00002190"},                          //←
+    {"Leftarrow;", U"\U000021D0"},                          //⇐
+    {"leftarrow;", U"\U00002190"},                          //←
+    {"LeftArrowBar;", U"\U000021E4"},                       //⇤
+    {"LeftArrowRightArrow;", U"\U000021C6"},                //⇆
+    {"leftarrowtail;", U"\U000021A2"},                      //↢
+    {"LeftCeiling;", U"\U00002308"},                        //⌈
+    {"LeftDoubleBracket;", U"\U000027E6"},                  //⟦
+    {"LeftDownTeeVector;", U"\U00002961"},                  //⥡
+    {"LeftDownVector;", U"\U000021C3"},                     //⇃
+    {"LeftDownVectorBar;", U"\U00002959"},                  //⥙
+    {"LeftFloor;", U"\U0000230A"},                          //⌊
+    {"leftharpoondown;", U"\U000021BD"},                    //↽
+    {"leftharpoonup;", U"\U000021BC"},                      //↼
+    {"leftleftarrows;", U"\U000021C7"},                     //⇇
+    {"LeftRightArrow;", U"\U00002194"},                     //↔
+    {"Leftrightarrow;", U"\U000021D4"},                     //⇔
+    {"leftrightarrow;", U"\U00002194"},                     //↔
+    {"leftrightarrows;", U"\U000021C6"},                    //⇆
+    {"leftrightharpoons;", U"\U000021CB"},                  //⇋
+    {"leftrightsquigarrow;", U"\U000021AD"},                //↭
+    {"LeftRightVector;", U"\U0000294E"},                    //⥎
+    {"LeftTee;", U"\U000022A3"},                            //⊣
+    {"LeftTeeArrow;", U"\U000021A4"},                       //↤
+    {"LeftTeeVector;", U"\U0000295A"},                      //⥚
+    {"leftthreetimes;", U"\U000022CB"},                     //⋋
+    {"LeftTriangle;", U"\U000022B2"},                       //⊲
+    {"LeftTriangleBar;", U"\U000029CF"},                    //⧏
+    {"LeftTriangleEqual;", U"\U000022B4"},                  //⊴
+    {"LeftUpDownVector;", U"\U00002951"},                   //⥑
+    {"LeftUpTeeVector;", U"\U00002960"},                    //⥠
+    {"LeftUpVector;", U"\U000021BF"},                       //↿
+    {"LeftUpVectorBar;", U"\U00002958"},                    //⥘
+    {"LeftVector;", U"\U000021BC"},                         //↼
+    {"LeftVectorBar;", U"\U00002952"},                      //⥒
+    {"lEg;", U"\U00002A8B"},                                //⪋
+    {"leg;", U"\U000022DA"},                                //⋚
+    {"leq;", U"\U00002264"},                                //≤
+    {"leqq;", U"\U00002266"},                               //≦
+    {"leqslant;", U"\U00002A7D"},                           //⩽
+    {"les;", U"\U00002A7D"},                                //⩽
+    {"lescc;", U"\U00002AA8"},                              //⪨
+    {"lesdot;", U"\U00002A7F"},                             //⩿
+    {"lesdoto;", U"\U00002A81"},                            //⪁
+    {"lesdotor;", U"\U00002A83"},                           //⪃
+    {"lesg;", U"\U000022DA\U0000FE00"},                     //lesg;
+    {"lesges;", U"\U00002A93"},                             //⪓
+    {"lessapprox;", U"\U00002A85"},                         //⪅
+    {"lessdot;", U"\U000022D6"},                            //⋖
+    {"lesseqgtr;", U"\U000022DA"},                          //⋚
+    {"lesseqqgtr;", U"\U00002A8B"},                         //⪋
+    {"LessEqualGreater;", U"\U000022DA"},                   //⋚
+    {"LessFullEqual;", U"\U00002266"},                      //≦
+    {"LessGreater;", U"\U00002276"},                        //≶
+    {"lessgtr;", U"\U00002276"},                            //≶
+    {"LessLess;", U"\U00002AA1"},                           //⪡
+    {"lesssim;", U"\U00002272"},                            //≲
+    {"LessSlantEqual;", U"\U00002A7D"},                     //⩽
+    {"LessTilde;", U"\U00002272"},                          //≲
+    {"lfisht;", U"\U0000297C"},                             //⥼
+    {"lfloor;", U"\U0000230A"},                             //⌊
+    {"Lfr;", U"\U0001D50F"},                                //𝔏
+    {"lfr;", U"\U0001D529"},                                //𝔩
+    {"lg;", U"\U00002276"},                                 //≶
+    {"lgE;", U"\U00002A91"},                                //⪑
+    {"lHar;", U"\U00002962"},                               //⥢
+    {"lhard;", U"\U000021BD"},                              //↽
+    {"lharu;", U"\U000021BC"},                              //↼
+    {"lharul;", U"\U0000296A"},                             //⥪
+    {"lhblk;", U"\U00002584"},                              //▄
+    {"LJcy;", U"\U00000409"},                               //Љ
+    {"ljcy;", U"\U00000459"},                               //љ
+    {"Ll;", U"\U000022D8"},                                 //⋘
+    {"ll;", U"\U0000226A"},                                 //≪
+    {"llarr;", U"\U000021C7"},                              //⇇
+    {"llcorner;", U"\U0000231E"},                           //⌞
+    {"Lleftarrow;", U"\U000021DA"},                         //⇚
+    {"llhard;", U"\U0000296B"},                             //⥫
+    {"lltri;", U"\U000025FA"},                              //◺
+    {"Lmidot;", U"\U0000013F"},                             //Ŀ
+    {"lmidot;", U"\U00000140"},                             //ŀ
+    {"lmoust;", U"\U000023B0"},                             //⎰
+    {"lmoustache;", U"\U000023B0"},                         //⎰
+    {"lnap;", U"\U00002A89"},                               //⪉
+    {"lnapprox;", U"\U00002A89"},                           //⪉
+    {"lnE;", U"\U00002268"},                                //≨
+    {"lne;", U"\U00002A87"},                                //⪇
+    {"lneq;", U"\U00002A87"},                               //⪇
+    {"lneqq;", U"\U00002268"},                              //≨
+    {"lnsim;", U"\U000022E6"},                              //⋦
+    {"loang;", U"\U000027EC"},                              //⟬
+    {"loarr;", U"\U000021FD"},                              //⇽
+    {"lobrk;", U"\U000027E6"},                              //⟦
+    {"LongLeftArrow;", U"\U000027F5"},                      //⟵
+    {"Longleftarrow;", U"\U000027F8"},                      //⟸
+    {"longleftarrow;", U"\U000027F5"},                      //⟵
+    {"LongLeftRightArrow;", U"\U000027F7"},                 //⟷
+    {"Longleftrightarrow;", U"\U000027FA"},                 //⟺
+    {"longleftrightarrow;", U"\U000027F7"},                 //⟷
+    {"longmapsto;", U"\U000027FC"},                         //⟼
+    {"LongRightArrow;", U"\U000027F6"},                     //⟶
+    {"Longrightarrow;", U"\U000027F9"},                     //⟹
+    {"longrightarrow;", U"\U000027F6"},                     //⟶
+    {"looparrowleft;", U"\U000021AB"},                      //↫
+    {"looparrowright;", U"\U000021AC"},                     //↬
+    {"lopar;", U"\U00002985"},                              //⦅
+    {"Lopf;", U"\U0001D543"},                               //𝕃
+    {"lopf;", U"\U0001D55D"},                               //𝕝
+    {"loplus;", U"\U00002A2D"},                             //⨭
+    {"lotimes;", U"\U00002A34"},                            //⨴
+    {"lowast;", U"\U00002217"},                             //∗
+    {"lowbar;", U"\U0000005F"},                             //_
+    {"LowerLeftArrow;", U"\U00002199"},                     //↙
+    {"LowerRightArrow;", U"\U00002198"},                    //↘
+    {"loz;", U"\U000025CA"},                                //◊
+    {"lozenge;", U"\U000025CA"},                            //◊
+    {"lozf;", U"\U000029EB"},                               //⧫
+    {"lpar;", U"\U00000028"},                               //(
+    {"lparlt;", U"\U00002993"},                             //⦓
+    {"lrarr;", U"\U000021C6"},                              //⇆
+    {"lrcorner;", U"\U0000231F"},                           //⌟
+    {"lrhar;", U"\U000021CB"},                              //⇋
+    {"lrhard;", U"\U0000296D"},                             //⥭
+    {"lrm;", U"\U0000200E"},                                //‎
+    {"lrtri;", U"\U000022BF"},                              //⊿
+    {"lsaquo;", U"\U00002039"},                             //‹
+    {"Lscr;", U"\U00002112"},                               //ℒ
+    {"lscr;", U"\U0001D4C1"},                               //𝓁
+    {"Lsh;", U"\U000021B0"},                                //↰
+    {"lsh;", U"\U000021B0"},                                //↰
+    {"lsim;", U"\U00002272"},                               //≲
+    {"lsime;", U"\U00002A8D"},                              //⪍
+    {"lsimg;", U"\U00002A8F"},                              //⪏
+    {"lsqb;", U"\U0000005B"},                               //[
+    {"lsquo;", U"\U00002018"},                              //‘
+    {"lsquor;", U"\U0000201A"},                             //‚
+    {"Lstrok;", U"\U00000141"},                             //Ł
+    {"lstrok;", U"\U00000142"},                             //ł
+    {"LT;", U"\U0000003C"},                                 //<
+    {"LT", U"\U0000003C"},                                  //<
+    {"Lt;", U"\U0000226A"},                                 //≪
+    {"lt;", U"\U0000003C"},                                 //<
+    {"lt", U"\U0000003C"},                                  //<
+    {"ltcc;", U"\U00002AA6"},                               //⪦
+    {"ltcir;", U"\U00002A79"},                              //⩹
+    {"ltdot;", U"\U000022D6"},                              //⋖
+    {"lthree;", U"\U000022CB"},                             //⋋
+    {"ltimes;", U"\U000022C9"},                             //⋉
+    {"ltlarr;", U"\U00002976"},                             //⥶
+    {"ltquest;", U"\U00002A7B"},                            //⩻
+    {"ltri;", U"\U000025C3"},                               //◃
+    {"ltrie;", U"\U000022B4"},                              //⊴
+    {"ltrif;", U"\U000025C2"},                              //◂
+    {"ltrPar;", U"\U00002996"},                             //⦖
+    {"lurdshar;", U"\U0000294A"},                           //⥊
+    {"luruhar;", U"\U00002966"},                            //⥦
+    {"lvertneqq;", U"\U00002268\U0000FE00"},                //lvertneqq;
+    {"lvnE;", U"\U00002268\U0000FE00"},                     //lvnE;
+    {"macr;", U"\U000000AF"},                               //¯
+    {"macr", U"\U000000AF"},                                //¯
+    {"male;", U"\U00002642"},                               //♂
+    {"malt;", U"\U00002720"},                               //✠
+    {"maltese;", U"\U00002720"},                            //✠
+    {"Map;", U"\U00002905"},                                //⤅
+    {"map;", U"\U000021A6"},                                //↦
+    {"mapsto;", U"\U000021A6"},                             //↦
+    {"mapstodown;", U"\U000021A7"},                         //↧
+    {"mapstoleft;", U"\U000021A4"},                         //↤
+    {"mapstoup;", U"\U000021A5"},                           //↥
+    {"marker;", U"\U000025AE"},                             //▮
+    {"mcomma;", U"\U00002A29"},                             //⨩
+    {"Mcy;", U"\U0000041C"},                                //М
+    {"mcy;", U"\U0000043C"},                                //м
+    {"mdash;", U"\U00002014"},                              //—
+    {"mDDot;", U"\U0000223A"},                              //∺
+    {"measuredangle;", U"\U00002221"},                      //∡
+    {"MediumSpace;", U"\U0000205F"},                        //MediumSpace;
+    {"Mellintrf;", U"\U00002133"},                          //ℳ
+    {"Mfr;", U"\U0001D510"},                                //𝔐
+    {"mfr;", U"\U0001D52A"},                                //𝔪
+    {"mho;", U"\U00002127"},                                //℧
+    {"micro;", U"\U000000B5"},                              //µ
+    {"micro", U"\U000000B5"},                               //µ
+    {"mid;", U"\U00002223"},                                //∣
+    {"midast;", U"\U0000002A"},                             //*
+    {"midcir;", U"\U00002AF0"},                             //⫰
+    {"middot;", U"\U000000B7"},                             //·
+    {"middot", U"\U000000B7"},                              //·
+    {"minus;", U"\U00002212"},                              //−
+    {"minusb;", U"\U0000229F"},                             //⊟
+    {"minusd;", U"\U00002238"},                             //∸
+    {"minusdu;", U"\U00002A2A"},                            //⨪
+    {"MinusPlus;", U"\U00002213"},                          //∓
+    {"mlcp;", U"\U00002ADB"},                               //⫛
+    {"mldr;", U"\U00002026"},                               //…
+    {"mnplus;", U"\U00002213"},                             //∓
+    {"models;", U"\U000022A7"},                             //⊧
+    {"Mopf;", U"\U0001D544"},                               //𝕄
+    {"mopf;", U"\U0001D55E"},                               //𝕞
+    {"mp;", U"\U00002213"},                                 //∓
+    {"Mscr;", U"\U00002133"},                               //ℳ
+    {"mscr;", U"\U0001D4C2"},                               //𝓂
+    {"mstpos;", U"\U0000223E"},                             //∾
+    {"Mu;", U"\U0000039C"},                                 //Μ
+    {"mu;", U"\U000003BC"},                                 //μ
+    {"multimap;", U"\U000022B8"},                           //⊸
+    {"mumap;", U"\U000022B8"},                              //⊸
+    {"nabla;", U"\U00002207"},                              //∇
+    {"Nacute;", U"\U00000143"},                             //Ń
+    {"nacute;", U"\U00000144"},                             //ń
+    {"nang;", U"\U00002220\U000020D2"},                     //nang;
+    {"nap;", U"\U00002249"},                                //≉
+    {"napE;", U"\U00002A70\U00000338"},                     //napE;
+    {"napid;", U"\U0000224B\U00000338"},                    //napid;
+    {"napos;", U"\U00000149"},                              //ŉ
+    {"napprox;", U"\U00002249"},                            //≉
+    {"natur;", U"\U0000266E"},                              //♮
+    {"natural;", U"\U0000266E"},                            //♮
+    {"naturals;", U"\U00002115"},                           //ℕ
+    {"nbsp;", U"\U000000A0"},                               //nbsp;
+    {"nbsp", U"\U000000A0"},                                //nbsp
+    {"nbump;", U"\U0000224E\U00000338"},                    //nbump;
+    {"nbumpe;", U"\U0000224F\U00000338"},                   //nbumpe;
+    {"ncap;", U"\U00002A43"},                               //⩃
+    {"Ncaron;", U"\U00000147"},                             //Ň
+    {"ncaron;", U"\U00000148"},                             //ň
+    {"Ncedil;", U"\U00000145"},                             //Ņ
+    {"ncedil;", U"\U00000146"},                             //ņ
+    {"ncong;", U"\U00002247"},                              //≇
+    {"ncongdot;", U"\U00002A6D\U00000338"},                 //ncongdot;
+    {"ncup;", U"\U00002A42"},                               //⩂
+    {"Ncy;", U"\U0000041D"},                                //Н
+    {"ncy;", U"\U0000043D"},                                //н
+    {"ndash;", U"\U00002013"},                              //–
+    {"ne;", U"\U00002260"},                                 //≠
+    {"nearhk;", U"\U00002924"},                             //⤤
+    {"neArr;", U"\U000021D7"},                              //⇗
+    {"nearr;", U"\U00002197"},                              //↗
+    {"nearrow;", U"\U00002197"},                            //↗
+    {"nedot;", U"\U00002250\U00000338"},                    //nedot;
+    {"NegativeMediumSpace;", U"\U0000200B"},                //​
+    {"NegativeThickSpace;", U"\U0000200B"},                 //​
+    {"NegativeThinSpace;", U"\U0000200B"},                  //​
+    {"NegativeVeryThinSpace;", U"\U0000200B"},              //​
+    {"nequiv;", U"\U00002262"},                             //≢
+    {"nesear;", U"\U00002928"},                             //⤨
+    {"nesim;", U"\U00002242\U00000338"},                    //nesim;
+    {"NestedGreaterGreater;", U"\U0000226B"},               //≫
+    {"NestedLessLess;", U"\U0000226A"},                     //≪
+    {"NewLine;", U"\U0000000A"},                            //␊
+    {"nexist;", U"\U00002204"},                             //∄
+    {"nexists;", U"\U00002204"},                            //∄
+    {"Nfr;", U"\U0001D511"},                                //𝔑
+    {"nfr;", U"\U0001D52B"},                                //𝔫
+    {"ngE;", U"\U00002267\U00000338"},                      //ngE;
+    {"nge;", U"\U00002271"},                                //≱
+    {"ngeq;", U"\U00002271"},                               //≱
+    {"ngeqq;", U"\U00002267\U00000338"},                    //ngeqq;
+    {"ngeqslant;", U"\U00002A7E\U00000338"},                //ngeqslant;
+    {"nges;", U"\U00002A7E\U00000338"},                     //nges;
+    {"nGg;", U"\U000022D9\U00000338"},                      //nGg;
+    {"ngsim;", U"\U00002275"},                              //≵
+    {"nGt;", U"\U0000226B\U000020D2"},                      //nGt;
+    {"ngt;", U"\U0000226F"},                                //≯
+    {"ngtr;", U"\U0000226F"},                               //≯
+    {"nGtv;", U"\U0000226B\U00000338"},                     //nGtv;
+    {"nhArr;", U"\U000021CE"},                              //⇎
+    {"nharr;", U"\U000021AE"},                              //↮
+    {"nhpar;", U"\U00002AF2"},                              //⫲
+    {"ni;", U"\U0000220B"},                                 //∋
+    {"nis;", U"\U000022FC"},                                //⋼
+    {"nisd;", U"\U000022FA"},                               //⋺
+    {"niv;", U"\U0000220B"},                                //∋
+    {"NJcy;", U"\U0000040A"},                               //Њ
+    {"njcy;", U"\U0000045A"},                               //њ
+    {"nlArr;", U"\U000021CD"},                              //⇍
+    {"nlarr;", U"\U0000219A"},                              //↚
+    {"nldr;", U"\U00002025"},                               //‥
+    {"nlE;", U"\U00002266\U00000338"},                      //nlE;
+    {"nle;", U"\U00002270"},                                //≰
+    {"nLeftarrow;", U"\U000021CD"},                         //⇍
+    {"nleftarrow;", U"\U0000219A"},                         //↚
+    {"nLeftrightarrow;", U"\U000021CE"},                    //⇎
+    {"nleftrightarrow;", U"\U000021AE"},                    //↮
+    {"nleq;", U"\U00002270"},                               //≰
+    {"nleqq;", U"\U00002266\U00000338"},                    //nleqq;
+    {"nleqslant;", U"\U00002A7D\U00000338"},                //nleqslant;
+    {"nles;", U"\U00002A7D\U00000338"},                     //nles;
+    {"nless;", U"\U0000226E"},                              //≮
+    {"nLl;", U"\U000022D8\U00000338"},                      //nLl;
+    {"nlsim;", U"\U00002274"},                              //≴
+    {"nLt;", U"\U0000226A\U000020D2"},                      //nLt;
+    {"nlt;", U"\U0000226E"},                                //≮
+    {"nltri;", U"\U000022EA"},                              //⋪
+    {"nltrie;", U"\U000022EC"},                             //⋬
+    {"nLtv;", U"\U0000226A\U00000338"},                     //nLtv;
+    {"nmid;", U"\U00002224"},                               //∤
+    {"NoBreak;", U"\U00002060"},                            //⁠
+    {"NonBreakingSpace;", U"\U000000A0"},                   //NonBreakingSpace;
+    {"Nopf;", U"\U00002115"},                               //ℕ
+    {"nopf;", U"\U0001D55F"},                               //𝕟
+    {"Not;", U"\U00002AEC"},                                //⫬
+    {"not;", U"\U000000AC"},                                //¬
+    {"not", U"\U000000AC"},                                 //¬
+    {"NotCongruent;", U"\U00002262"},                       //≢
+    {"NotCupCap;", U"\U0000226D"},                          //≭
+    {"NotDoubleVerticalBar;", U"\U00002226"},               //∦
+    {"NotElement;", U"\U00002209"},                         //∉
+    {"NotEqual;", U"\U00002260"},                           //≠
+    {"NotEqualTilde;", U"\U00002242\U00000338"},            //NotEqualTilde;
+    {"NotExists;", U"\U00002204"},                          //∄
+    {"NotGreater;", U"\U0000226F"},                         //≯
+    {"NotGreaterEqual;", U"\U00002271"},                    //≱
+    {"NotGreaterFullEqual;", U"\U00002267\U00000338"},      //NotGreaterFullEqual;
+    {"NotGreaterGreater;", U"\U0000226B\U00000338"},        //NotGreaterGreater;
+    {"NotGreaterLess;", U"\U00002279"},                     //≹
+    {"NotGreaterSlantEqual;", U"\U00002A7E\U00000338"},     //NotGreaterSlantEqual;
+    {"NotGreaterTilde;", U"\U00002275"},                    //≵
+    {"NotHumpDownHump;", U"\U0000224E\U00000338"},          //NotHumpDownHump;
+    {"NotHumpEqual;", U"\U0000224F\U00000338"},             //NotHumpEqual;
+    {"notin;", U"\U00002209"},                              //∉
+    {"notindot;", U"\U000022F5\U00000338"},                 //notindot;
+    {"notinE;", U"\U000022F9\U00000338"},                   //notinE;
+    {"notinva;", U"\U00002209"},                            //∉
+    {"notinvb;", U"\U000022F7"},                            //⋷
+    {"notinvc;", U"\U000022F6"},                            //⋶
+    {"NotLeftTriangle;", U"\U000022EA"},                    //⋪
+    {"NotLeftTriangleBar;", U"\U000029CF\U00000338"},       //NotLeftTriangleBar;
+    {"NotLeftTriangleEqual;", U"\U000022EC"},               //⋬
+    {"NotLess;", U"\U0000226E"},                            //≮
+    {"NotLessEqual;", U"\U00002270"},                       //≰
+    {"NotLessGreater;", U"\U00002278"},                     //≸
+    {"NotLessLess;", U"\U0000226A\U00000338"},              //NotLessLess;
+    {"NotLessSlantEqual;", U"\U00002A7D\U00000338"},        //NotLessSlantEqual;
+    {"NotLessTilde;", U"\U00002274"},                       //≴
+    {"NotNestedGreaterGreater;", U"\U00002AA2\U00000338"},  //NotNestedGreaterGreater;
+    {"NotNestedLessLess;", U"\U00002AA1\U00000338"},        //NotNestedLessLess;
+    {"notni;", U"\U0000220C"},                              //∌
+    {"notniva;", U"\U0000220C"},                            //∌
+    {"notnivb;", U"\U000022FE"},                            //⋾
+    {"notnivc;", U"\U000022FD"},                            //⋽
+    {"NotPrecedes;", U"\U00002280"},                        //⊀
+    {"NotPrecedesEqual;", U"\U00002AAF\U00000338"},         //NotPrecedesEqual;
+    {"NotPrecedesSlantEqual;", U"\U000022E0"},              //⋠
+    {"NotReverseElement;", U"\U0000220C"},                  //∌
+    {"NotRightTriangle;", U"\U000022EB"},                   //⋫
+    {"NotRightTriangleBar;", U"\U000029D0\U00000338"},      //NotRightTriangleBar;
+    {"NotRightTriangleEqual;", U"\U000022ED"},              //⋭
+    {"NotSquareSubset;", U"\U0000228F\U00000338"},          //NotSquareSubset;
+    {"NotSquareSubsetEqual;", U"\U000022E2"},               //⋢
+    {"NotSquareSuperset;", U"\U00002290\U00000338"},        //NotSquareSuperset;
+    {"NotSquareSupersetEqual;", U"\U000022E3"},             //⋣
+    {"NotSubset;", U"\U00002282\U000020D2"},                //NotSubset;
+    {"NotSubsetEqual;", U"\U00002288"},                     //⊈
+    {"NotSucceeds;", U"\U00002281"},                        //⊁
+    {"NotSucceedsEqual;", U"\U00002AB0\U00000338"},         //NotSucceedsEqual;
+    {"NotSucceedsSlantEqual;", U"\U000022E1"},              //⋡
+    {"NotSucceedsTilde;", U"\U0000227F\U00000338"},         //NotSucceedsTilde;
+    {"NotSuperset;", U"\U00002283\U000020D2"},              //NotSuperset;
+    {"NotSupersetEqual;", U"\U00002289"},                   //⊉
+    {"NotTilde;", U"\U00002241"},                           //≁
+    {"NotTildeEqual;", U"\U00002244"},                      //≄
+    {"NotTildeFullEqual;", U"\U00002247"},                  //≇
+    {"NotTildeTilde;", U"\U00002249"},                      //≉
+    {"NotVerticalBar;", U"\U00002224"},                     //∤
+    {"npar;", U"\U00002226"},                               //∦
+    {"nparallel;", U"\U00002226"},                          //∦
+    {"nparsl;", U"\U00002AFD\U000020E5"},                   //nparsl;
+    {"npart;", U"\U00002202\U00000338"},                    //npart;
+    {"npolint;", U"\U00002A14"},                            //⨔
+    {"npr;", U"\U00002280"},                                //⊀
+    {"nprcue;", U"\U000022E0"},                             //⋠
+    {"npre;", U"\U00002AAF\U00000338"},                     //npre;
+    {"nprec;", U"\U00002280"},                              //⊀
+    {"npreceq;", U"\U00002AAF\U00000338"},                  //npreceq;
+    {"nrArr;", U"\U000021CF"},                              //⇏
+    {"nrarr;", U"\U0000219B"},                              //↛
+    {"nrarrc;", U"\U00002933\U00000338"},                   //nrarrc;
+    {"nrarrw;", U"\U0000219D\U00000338"},                   //nrarrw;
+    {"nRightarrow;", U"\U000021CF"},                        //⇏
+    {"nrightarrow;", U"\U0000219B"},                        //↛
+    {"nrtri;", U"\U000022EB"},                              //⋫
+    {"nrtrie;", U"\U000022ED"},                             //⋭
+    {"nsc;", U"\U00002281"},                                //⊁
+    {"nsccue;", U"\U000022E1"},                             //⋡
+    {"nsce;", U"\U00002AB0\U00000338"},                     //nsce;
+    {"Nscr;", U"\U0001D4A9"},                               //𝒩
+    {"nscr;", U"\U0001D4C3"},                               //𝓃
+    {"nshortmid;", U"\U00002224"},                          //∤
+    {"nshortparallel;", U"\U00002226"},                     //∦
+    {"nsim;", U"\U00002241"},                               //≁
+    {"nsime;", U"\U00002244"},                              //≄
+    {"nsimeq;", U"\U00002244"},                             //≄
+    {"nsmid;", U"\U00002224"},                              //∤
+    {"nspar;", U"\U00002226"},                              //∦
+    {"nsqsube;", U"\U000022E2"},                            //⋢
+    {"nsqsupe;", U"\U000022E3"},                            //⋣
+    {"nsub;", U"\U00002284"},                               //⊄
+    {"nsubE;", U"\U00002AC5\U00000338"},                    //nsubE;
+    {"nsube;", U"\U00002288"},                              //⊈
+    {"nsubset;", U"\U00002282\U000020D2"},                  //nsubset;
+    {"nsubseteq;", U"\U00002288"},                          //⊈
+    {"nsubseteqq;", U"\U00002AC5\U00000338"},               //nsubseteqq;
+    {"nsucc;", U"\U00002281"},                              //⊁
+    {"nsucceq;", U"\U00002AB0\U00000338"},                  //nsucceq;
+    {"nsup;", U"\U00002285"},                               //⊅
+    {"nsupE;", U"\U00002AC6\U00000338"},                    //nsupE;
+    {"nsupe;", U"\U00002289"},                              //⊉
+    {"nsupset;", U"\U00002283\U000020D2"},                  //nsupset;
+    {"nsupseteq;", U"\U00002289"},                          //⊉
+    {"nsupseteqq;", U"\U00002AC6\U00000338"},               //nsupseteqq;
+    {"ntgl;", U"\U00002279"},                               //≹
+    {"Ntilde;", U"\U000000D1"},                             //Ñ
+    {"Ntilde", U"\U000000D1"},                              //Ñ
+    {"ntilde;", U"\U000000F1"},                             //ñ
+    {"ntilde", U"\U000000F1"},                              //ñ
+    {"ntlg;", U"\U00002278"},                               //≸
+    {"ntriangleleft;", U"\U000022EA"},                      //⋪
+    {"ntrianglelefteq;", U"\U000022EC"},                    //⋬
+    {"ntriangleright;", U"\U000022EB"},                     //⋫
+    {"ntrianglerighteq;", U"\U000022ED"},                   //⋭
+    {"Nu;", U"\U0000039D"},                                 //Ν
+    {"nu;", U"\U000003BD"},                                 //ν
+    {"num;", U"\U00000023"},                                //#
+    {"numero;", U"\U00002116"},                             //№
+    {"numsp;", U"\U00002007"},                              //numsp;
+    {"nvap;", U"\U0000224D\U000020D2"},                     //nvap;
+    {"nVDash;", U"\U000022AF"},                             //⊯
+    {"nVdash;", U"\U000022AE"},                             //⊮
+    {"nvDash;", U"\U000022AD"},                             //⊭
+    {"nvdash;", U"\U000022AC"},                             //⊬
+    {"nvge;", U"\U00002265\U000020D2"},                     //nvge;
+    {"nvgt;", U"\U0000003E\U000020D2"},                     //nvgt;
+    {"nvHarr;", U"\U00002904"},                             //⤄
+    {"nvinfin;", U"\U000029DE"},                            //⧞
+    {"nvlArr;", U"\U00002902"},                             //⤂
+    {"nvle;", U"\U00002264\U000020D2"},                     //nvle;
+    {"nvlt;", U"\U0000003C\U000020D2"},                     //nvlt;
+    {"nvltrie;", U"\U000022B4\U000020D2"},                  //nvltrie;
+    {"nvrArr;", U"\U00002903"},                             //⤃
+    {"nvrtrie;", U"\U000022B5\U000020D2"},                  //nvrtrie;
+    {"nvsim;", U"\U0000223C\U000020D2"},                    //nvsim;
+    {"nwarhk;", U"\U00002923"},                             //⤣
+    {"nwArr;", U"\U000021D6"},                              //⇖
+    {"nwarr;", U"\U00002196"},                              //↖
+    {"nwarrow;", U"\U00002196"},                            //↖
+    {"nwnear;", U"\U00002927"},                             //⤧
+    {"Oacute;", U"\U000000D3"},                             //Ó
+    {"Oacute", U"\U000000D3"},                              //Ó
+    {"oacute;", U"\U000000F3"},                             //ó
+    {"oacute", U"\U000000F3"},                              //ó
+    {"oast;", U"\U0000229B"},                               //⊛
+    {"ocir;", U"\U0000229A"},                               //⊚
+    {"Ocirc;", U"\U000000D4"},                              //Ô
+    {"Ocirc", U"\U000000D4"},                               //Ô
+    {"ocirc;", U"\U000000F4"},                              //ô
+    {"ocirc", U"\U000000F4"},                               //ô
+    {"Ocy;", U"\U0000041E"},                                //О
+    {"ocy;", U"\U0000043E"},                                //о
+    {"odash;", U"\U0000229D"},                              //⊝
+    {"Odblac;", U"\U00000150"},                             //Ő
+    {"odblac;", U"\U00000151"},                             //ő
+    {"odiv;", U"\U00002A38"},                               //⨸
+    {"odot;", U"\U00002299"},                               //⊙
+    {"odsold;", U"\U000029BC"},                             //⦼
+    {"OElig;", U"\U00000152"},                              //Œ
+    {"oelig;", U"\U00000153"},                              //œ
+    {"ofcir;", U"\U000029BF"},                              //⦿
+    {"Ofr;", U"\U0001D512"},                                //𝔒
+    {"ofr;", U"\U0001D52C"},                                //𝔬
+    {"ogon;", U"\U000002DB"},                               //˛
+    {"Ograve;", U"\U000000D2"},                             //Ò
+    {"Ograve", U"\U000000D2"},                              //Ò
+    {"ograve;", U"\U000000F2"},                             //ò
+    {"ograve", U"\U000000F2"},                              //ò
+    {"ogt;", U"\U000029C1"},                                //⧁
+    {"ohbar;", U"\U000029B5"},                              //⦵
+    {"ohm;", U"\U000003A9"},                                //Ω
+    {"oint;", U"\U0000222E"},                               //∮
+    {"olarr;", U"\U000021BA"},                              //↺
+    {"olcir;", U"\U000029BE"},                              //⦾
+    {"olcross;", U"\U000029BB"},                            //⦻
+    {"oline;", U"\U0000203E"},                              //‾
+    {"olt;", U"\U000029C0"},                                //⧀
+    {"Omacr;", U"\U0000014C"},                              //Ō
+    {"omacr;", U"\U0000014D"},                              //ō
+    {"Omega;", U"\U000003A9"},                              //Ω
+    {"omega;", U"\U000003C9"},                              //ω
+    {"Omicron;", U"\U0000039F"},                            //Ο
+    {"omicron;", U"\U000003BF"},                            //ο
+    {"omid;", U"\U000029B6"},                               //⦶
+    {"ominus;", U"\U00002296"},                             //⊖
+    {"Oopf;", U"\U0001D546"},                               //𝕆
+    {"oopf;", U"\U0001D560"},                               //𝕠
+    {"opar;", U"\U000029B7"},                               //⦷
+    {"OpenCurlyDoubleQuote;", U"\U0000201C"},               //“
+    {"OpenCurlyQuote;", U"\U00002018"},                     //‘
+    {"operp;", U"\U000029B9"},                              //⦹
+    {"oplus;", U"\U00002295"},                              //⊕
+    {"Or;", U"\U00002A54"},                                 //⩔
+    {"or;", U"\U00002228"},                                 //∨
+    {"orarr;", U"\U000021BB"},                              //↻
+    {"ord;", U"\U00002A5D"},                                //⩝
+    {"order;", U"\U00002134"},                              //ℴ
+    {"orderof;", U"\U00002134"},                            //ℴ
+    {"ordf;", U"\U000000AA"},                               //ª
+    {"ordf", U"\U000000AA"},                                //ª
+    {"ordm;", U"\U000000BA"},                               //º
+    {"ordm", U"\U000000BA"},                                //º
+    {"origof;", U"\U000022B6"},                             //⊶
+    {"oror;", U"\U00002A56"},                               //⩖
+    {"orslope;", U"\U00002A57"},                            //⩗
+    {"orv;", U"\U00002A5B"},                                //⩛
+    {"oS;", U"\U000024C8"},                                 //Ⓢ
+    {"Oscr;", U"\U0001D4AA"},                               //𝒪
+    {"oscr;", U"\U00002134"},                               //ℴ
+    {"Oslash;", U"\U000000D8"},                             //Ø
+    {"Oslash", U"\U000000D8"},                              //Ø
+    {"oslash;", U"\U000000F8"},                             //ø
+    {"oslash", U"\U000000F8"},                              //ø
+    {"osol;", U"\U00002298"},                               //⊘
+    {"Otilde;", U"\U000000D5"},                             //Õ
+    {"Otilde", U"\U000000D5"},                              //Õ
+    {"otilde;", U"\U000000F5"},                             //õ
+    {"otilde", U"\U000000F5"},                              //õ
+    {"Otimes;", U"\U00002A37"},                             //⨷
+    {"otimes;", U"\U00002297"},                             //⊗
+    {"otimesas;", U"\U00002A36"},                           //⨶
+    {"Ouml;", U"\U000000D6"},                               //Ö
+    {"Ouml", U"\U000000D6"},                                //Ö
+    {"ouml;", U"\U000000F6"},                               //ö
+    {"ouml", U"\U000000F6"},                                //ö
+    {"ovbar;", U"\U0000233D"},                              //⌽
+    {"OverBar;", U"\U0000203E"},                            //‾
+    {"OverBrace;", U"\U000023DE"},                          //⏞
+    {"OverBracket;", U"\U000023B4"},                        //⎴
+    {"OverParenthesis;", U"\U000023DC"},                    //⏜
+    {"par;", U"\U00002225"},                                //∥
+    {"para;", U"\U000000B6"},                               //¶
+    {"para", U"\U000000B6"},                                //¶
+    {"parallel;", U"\U00002225"},                           //∥
+    {"parsim;", U"\U00002AF3"},                             //⫳
+    {"parsl;", U"\U00002AFD"},                              //⫽
+    {"part;", U"\U00002202"},                               //∂
+    {"PartialD;", U"\U00002202"},                           //∂
+    {"Pcy;", U"\U0000041F"},                                //П
+    {"pcy;", U"\U0000043F"},                                //п
+    {"percnt;", U"\U00000025"},                             //%
+    {"period;", U"\U0000002E"},                             //.
+    {"permil;", U"\U00002030"},                             //‰
+    {"perp;", U"\U000022A5"},                               //⊥
+    {"pertenk;", U"\U00002031"},                            //‱
+    {"Pfr;", U"\U0001D513"},                                //𝔓
+    {"pfr;", U"\U0001D52D"},                                //𝔭
+    {"Phi;", U"\U000003A6"},                                //Φ
+    {"phi;", U"\U000003C6"},                                //φ
+    {"phiv;", U"\U000003D5"},                               //ϕ
+    {"phmmat;", U"\U00002133"},                             //ℳ
+    {"phone;", U"\U0000260E"},                              //☎
+    {"Pi;", U"\U000003A0"},                                 //Π
+    {"pi;", U"\U000003C0"},                                 //π
+    {"pitchfork;", U"\U000022D4"},                          //⋔
+    {"piv;", U"\U000003D6"},                                //ϖ
+    {"planck;", U"\U0000210F"},                             //ℏ
+    {"planckh;", U"\U0000210E"},                            //ℎ
+    {"plankv;", U"\U0000210F"},                             //ℏ
+    {"plus;", U"\U0000002B"},                               //+
+    {"plusacir;", U"\U00002A23"},                           //⨣
+    {"plusb;", U"\U0000229E"},                              //⊞
+    {"pluscir;", U"\U00002A22"},                            //⨢
+    {"plusdo;", U"\U00002214"},                             //∔
+    {"plusdu;", U"\U00002A25"},                             //⨥
+    {"pluse;", U"\U00002A72"},                              //⩲
+    {"PlusMinus;", U"\U000000B1"},                          //±
+    {"plusmn;", U"\U000000B1"},                             //±
+    {"plusmn", U"\U000000B1"},                              //±
+    {"plussim;", U"\U00002A26"},                            //⨦
+    {"plustwo;", U"\U00002A27"},                            //⨧
+    {"pm;", U"\U000000B1"},                                 //±
+    {"Poincareplane;", U"\U0000210C"},                      //ℌ
+    {"pointint;", U"\U00002A15"},                           //⨕
+    {"Popf;", U"\U00002119"},                               //ℙ
+    {"popf;", U"\U0001D561"},                               //𝕡
+    {"pound;", U"\U000000A3"},                              //£
+    {"pound", U"\U000000A3"},                               //£
+    {"Pr;", U"\U00002ABB"},                                 //⪻
+    {"pr;", U"\U0000227A"},                                 //≺
+    {"prap;", U"\U00002AB7"},                               //⪷
+    {"prcue;", U"\U0000227C"},                              //≼
+    {"prE;", U"\U00002AB3"},                                //⪳
+    {"pre;", U"\U00002AAF"},                                //⪯
+    {"prec;", U"\U0000227A"},                               //≺
+    {"precapprox;", U"\U00002AB7"},                         //⪷
+    {"preccurlyeq;", U"\U0000227C"},                        //≼
+    {"Precedes;", U"\U0000227A"},                           //≺
+    {"PrecedesEqual;", U"\U00002AAF"},                      //⪯
+    {"PrecedesSlantEqual;", U"\U0000227C"},                 //≼
+    {"PrecedesTilde;", U"\U0000227E"},                      //≾
+    {"preceq;", U"\U00002AAF"},                             //⪯
+    {"precnapprox;", U"\U00002AB9"},                        //⪹
+    {"precneqq;", U"\U00002AB5"},                           //⪵
+    {"precnsim;", U"\U000022E8"},                           //⋨
+    {"precsim;", U"\U0000227E"},                            //≾
+    {"Prime;", U"\U00002033"},                              //″
+    {"prime;", U"\U00002032"},                              //′
+    {"primes;", U"\U00002119"},                             //ℙ
+    {"prnap;", U"\U00002AB9"},                              //⪹
+    {"prnE;", U"\U00002AB5"},                               //⪵
+    {"prnsim;", U"\U000022E8"},                             //⋨
+    {"prod;", U"\U0000220F"},                               //∏
+    {"Product;", U"\U0000220F"},                            //∏
+    {"profalar;", U"\U0000232E"},                           //⌮
+    {"profline;", U"\U00002312"},                           //⌒
+    {"profsurf;", U"\U00002313"},                           //⌓
+    {"prop;", U"\U0000221D"},                               //∝
+    {"Proportion;", U"\U00002237"},                         //∷
+    {"Proportional;", U"\U0000221D"},                       //∝
+    {"propto;", U"\U0000221D"},                             //∝
+    {"prsim;", U"\U0000227E"},                              //≾
+    {"prurel;", U"\U000022B0"},                             //⊰
+    {"Pscr;", U"\U0001D4AB"},                               //𝒫
+    {"pscr;", U"\U0001D4C5"},                               //𝓅
+    {"Psi;", U"\U000003A8"},                                //Ψ
+    {"psi;", U"\U000003C8"},                                //ψ
+    {"puncsp;", U"\U00002008"},                             //puncsp;
+    {"Qfr;", U"\U0001D514"},                                //𝔔
+    {"qfr;", U"\U0001D52E"},                                //𝔮
+    {"qint;", U"\U00002A0C"},                               //⨌
+    {"Qopf;", U"\U0000211A"},                               //ℚ
+    {"qopf;", U"\U0001D562"},                               //𝕢
+    {"qprime;", U"\U00002057"},                             //⁗
+    {"Qscr;", U"\U0001D4AC"},                               //𝒬
+    {"qscr;", U"\U0001D4C6"},                               //𝓆
+    {"quaternions;", U"\U0000210D"},                        //ℍ
+    {"quatint;", U"\U00002A16"},                            //⨖
+    {"quest;", U"\U0000003F"},                              //?
+    {"questeq;", U"\U0000225F"},                            //≟
+    {"QUOT;", U"\U00000022"},                               //"
+    {"QUOT", U"\U00000022"},                                //"
+    {"quot;", U"\U00000022"},                               //"
+    {"quot", U"\U00000022"},                                //"
+    {"rAarr;", U"\U000021DB"},                              //⇛
+    {"race;", U"\U0000223D\U00000331"},                     //race;
+    {"Racute;", U"\U00000154"},                             //Ŕ
+    {"racute;", U"\U00000155"},                             //ŕ
+    {"radic;", U"\U0000221A"},                              //√
+    {"raemptyv;", U"\U000029B3"},                           //⦳
+    {"Rang;", U"\U000027EB"},                               //⟫
+    {"rang;", U"\U000027E9"},                               //⟩
+    {"rangd;", U"\U00002992"},                              //⦒
+    {"range;", U"\U000029A5"},                              //⦥
+    {"rangle;", U"\U000027E9"},                             //〉
+    {"raquo;", U"\U000000BB"},                              //»
+    {"raquo", U"\U000000BB"},                               //»
+    {"Rarr;", U"\U000021A0"},                               //↠
+    {"rArr;", U"\U000021D2"},                               //⇒
+    {"rarr;", U"\U00002192"},                               //→
+    {"rarrap;", U"\U00002975"},                             //⥵
+    {"rarrb;", U"\U000021E5"},                              //⇥
+    {"rarrbfs;", U"\U00002920"},                            //⤠
+    {"rarrc;", U"\U00002933"},                              //⤳
+    {"rarrfs;", U"\U0000291E"},                             //⤞
+    {"rarrhk;", U"\U000021AA"},                             //↪
+    {"rarrlp;", U"\U000021AC"},                             //↬
+    {"rarrpl;", U"\U00002945"},                             //⥅
+    {"rarrsim;", U"\U00002974"},                            //⥴
+    {"Rarrtl;", U"\U00002916"},                             //⤖
+    {"rarrtl;", U"\U000021A3"},                             //↣
+    {"rarrw;", U"\U0000219D"},                              //↝
+    {"rAtail;", U"\U0000291C"},                             //⤜
+    {"ratail;", U"\U0000291A"},                             //⤚
+    {"ratio;", U"\U00002236"},                              //∶
+    {"rationals;", U"\U0000211A"},                          //ℚ
+    {"RBarr;", U"\U00002910"},                              //⤐
+    {"rBarr;", U"\U0000290F"},                              //⤏
+    {"rbarr;", U"\U0000290D"},                              //⤍
+    {"rbbrk;", U"\U00002773"},                              //❳
+    {"rbrace;", U"\U0000007D"},                             //}
+    {"rbrack;", U"\U0000005D"},                             //]
+    {"rbrke;", U"\U0000298C"},                              //⦌
+    {"rbrksld;", U"\U0000298E"},                            //⦎
+    {"rbrkslu;", U"\U00002990"},                            //⦐
+    {"Rcaron;", U"\U00000158"},                             //Ř
+    {"rcaron;", U"\U00000159"},                             //ř
+    {"Rcedil;", U"\U00000156"},                             //Ŗ
+    {"rcedil;", U"\U00000157"},                             //ŗ
+    {"rceil;", U"\U00002309"},                              //⌉
+    {"rcub;", U"\U0000007D"},                               //}
+    {"Rcy;", U"\U00000420"},                                //Р
+    {"rcy;", U"\U00000440"},                                //р
+    {"rdca;", U"\U00002937"},                               //⤷
+    {"rdldhar;", U"\U00002969"},                            //⥩
+    {"rdquo;", U"\U0000201D"},                              //”
+    {"rdquor;", U"\U0000201D"},                             //”
+    {"rdsh;", U"\U000021B3"},                               //↳
+    {"Re;", U"\U0000211C"},                                 //ℜ
+    {"real;", U"\U0000211C"},                               //ℜ
+    {"realine;", U"\U0000211B"},                            //ℛ
+    {"realpart;", U"\U0000211C"},                           //ℜ
+    {"reals;", U"\U0000211D"},                              //ℝ
+    {"rect;", U"\U000025AD"},                               //▭
+    {"REG;", U"\U000000AE"},                                //®
+    {"REG", U"\U000000AE"},                                 //®
+    {"reg;", U"\U000000AE"},                                //®
+    {"reg", U"\U000000AE"},                                 //®
+    {"ReverseElement;", U"\U0000220B"},                     //∋
+    {"ReverseEquilibrium;", U"\U000021CB"},                 //⇋
+    {"ReverseUpEquilibrium;", U"\U0000296F"},               //⥯
+    {"rfisht;", U"\U0000297D"},                             //⥽
+    {"rfloor;", U"\U0000230B"},                             //⌋
+    {"Rfr;", U"\U0000211C"},                                //ℜ
+    {"rfr;", U"\U0001D52F"},                                //𝔯
+    {"rHar;", U"\U00002964"},                               //⥤
+    {"rhard;", U"\U000021C1"},                              //⇁
+    {"rharu;", U"\U000021C0"},                              //⇀
+    {"rharul;", U"\U0000296C"},                             //⥬
+    {"Rho;", U"\U000003A1"},                                //Ρ
+    {"rho;", U"\U000003C1"},                                //ρ
+    {"rhov;", U"\U000003F1"},                               //ϱ
+    {"RightAngleBracket;", U"\U000027E9"},                  //〉
+    {"RightArrow;", U"\U00002192"},                         //→
+    {"Rightarrow;", U"\U000021D2"},                         //⇒
+    {"rightarrow;", U"\U00002192"},                         //→
+    {"RightArrowBar;", U"\U000021E5"},                      //⇥
+    {"RightArrowLeftArrow;", U"\U000021C4"},                //⇄
+    {"rightarrowtail;", U"\U000021A3"},                     //↣
+    {"RightCeiling;", U"\U00002309"},                       //⌉
+    {"RightDoubleBracket;", U"\U000027E7"},                 //⟧
+    {"RightDownTeeVector;", U"\U0000295D"},                 //⥝
+    {"RightDownVector;", U"\U000021C2"},                    //⇂
+    {"RightDownVectorBar;", U"\U00002955"},                 //⥕
+    {"RightFloor;", U"\U0000230B"},                         //⌋
+    {"rightharpoondown;", U"\U000021C1"},                   //⇁
+    {"rightharpoonup;", U"\U000021C0"},                     //⇀
+    {"rightleftarrows;", U"\U000021C4"},                    //⇄
+    {"rightleftharpoons;", U"\U000021CC"},                  //⇌
+    {"rightrightarrows;", U"\U000021C9"},                   //⇉
+    {"rightsquigarrow;", U"\U0000219D"},                    //↝
+    {"RightTee;", U"\U000022A2"},                           //⊢
+    {"RightTeeArrow;", U"\U000021A6"},                      //↦
+    {"RightTeeVector;", U"\U0000295B"},                     //⥛
+    {"rightthreetimes;", U"\U000022CC"},                    //⋌
+    {"RightTriangle;", U"\U000022B3"},                      //⊳
+    {"RightTriangleBar;", U"\U000029D0"},                   //⧐
+    {"RightTriangleEqual;", U"\U000022B5"},                 //⊵
+    {"RightUpDownVector;", U"\U0000294F"},                  //⥏
+    {"RightUpTeeVector;", U"\U0000295C"},                   //⥜
+    {"RightUpVector;", U"\U000021BE"},                      //↾
+    {"RightUpVectorBar;", U"\U00002954"},                   //⥔
+    {"RightVector;", U"\U000021C0"},                        //⇀
+    {"RightVectorBar;", U"\U00002953"},                     //⥓
+    {"ring;", U"\U000002DA"},                               //˚
+    {"risingdotseq;", U"\U00002253"},                       //≓
+    {"rlarr;", U"\U000021C4"},                              //⇄
+    {"rlhar;", U"\U000021CC"},                              //⇌
+    {"rlm;", U"\U0000200F"},                                //‏
+    {"rmoust;", U"\U000023B1"},                             //⎱
+    {"rmoustache;", U"\U000023B1"},                         //⎱
+    {"rnmid;", U"\U00002AEE"},                              //⫮
+    {"roang;", U"\U000027ED"},                              //⟭
+    {"roarr;", U"\U000021FE"},                              //⇾
+    {"robrk;", U"\U000027E7"},                              //⟧
+    {"ropar;", U"\U00002986"},                              //⦆
+    {"Ropf;", U"\U0000211D"},                               //ℝ
+    {"ropf;", U"\U0001D563"},                               //𝕣
+    {"roplus;", U"\U00002A2E"},                             //⨮
+    {"rotimes;", U"\U00002A35"},                            //⨵
+    {"RoundImplies;", U"\U00002970"},                       //⥰
+    {"rpar;", U"\U00000029"},                               //)
+    {"rpargt;", U"\U00002994"},                             //⦔
+    {"rppolint;", U"\U00002A12"},                           //⨒
+    {"rrarr;", U"\U000021C9"},                              //⇉
+    {"Rrightarrow;", U"\U000021DB"},                        //⇛
+    {"rsaquo;", U"\U0000203A"},                             //›
+    {"Rscr;", U"\U0000211B"},                               //ℛ
+    {"rscr;", U"\U0001D4C7"},                               //𝓇
+    {"Rsh;", U"\U000021B1"},                                //↱
+    {"rsh;", U"\U000021B1"},                                //↱
+    {"rsqb;", U"\U0000005D"},                               //]
+    {"rsquo;", U"\U00002019"},                              //’
+    {"rsquor;", U"\U00002019"},                             //’
+    {"rthree;", U"\U000022CC"},                             //⋌
+    {"rtimes;", U"\U000022CA"},                             //⋊
+    {"rtri;", U"\U000025B9"},                               //▹
+    {"rtrie;", U"\U000022B5"},                              //⊵
+    {"rtrif;", U"\U000025B8"},                              //▸
+    {"rtriltri;", U"\U000029CE"},                           //⧎
+    {"RuleDelayed;", U"\U000029F4"},                        //⧴
+    {"ruluhar;", U"\U00002968"},                            //⥨
+    {"rx;", U"\U0000211E"},                                 //℞
+    {"Sacute;", U"\U0000015A"},                             //Ś
+    {"sacute;", U"\U0000015B"},                             //ś
+    {"sbquo;", U"\U0000201A"},                              //‚
+    {"Sc;", U"\U00002ABC"},                                 //⪼
+    {"sc;", U"\U0000227B"},                                 //≻
+    {"scap;", U"\U00002AB8"},                               //⪸
+    {"Scaron;", U"\U00000160"},                             //Š
+    {"scaron;", U"\U00000161"},                             //š
+    {"sccue;", U"\U0000227D"},                              //≽
+    {"scE;", U"\U00002AB4"},                                //⪴
+    {"sce;", U"\U00002AB0"},                                //⪰
+    {"Scedil;", U"\U0000015E"},                             //Ş
+    {"scedil;", U"\U0000015F"},                             //ş
+    {"Scirc;", U"\U0000015C"},                              //Ŝ
+    {"scirc;", U"\U0000015D"},                              //ŝ
+    {"scnap;", U"\U00002ABA"},                              //⪺
+    {"scnE;", U"\U00002AB6"},                               //⪶
+    {"scnsim;", U"\U000022E9"},                             //⋩
+    {"scpolint;", U"\U00002A13"},                           //⨓
+    {"scsim;", U"\U0000227F"},                              //≿
+    {"Scy;", U"\U00000421"},                                //С
+    {"scy;", U"\U00000441"},                                //с
+    {"sdot;", U"\U000022C5"},                               //⋅
+    {"sdotb;", U"\U000022A1"},                              //⊡
+    {"sdote;", U"\U00002A66"},                              //⩦
+    {"searhk;", U"\U00002925"},                             //⤥
+    {"seArr;", U"\U000021D8"},                              //⇘
+    {"searr;", U"\U00002198"},                              //↘
+    {"searrow;", U"\U00002198"},                            //↘
+    {"sect;", U"\U000000A7"},                               //§
+    {"sect", U"\U000000A7"},                                //§
+    {"semi;", U"\U0000003B"},                               //;
+    {"seswar;", U"\U00002929"},                             //⤩
+    {"setminus;", U"\U00002216"},                           //∖
+    {"setmn;", U"\U00002216"},                              //∖
+    {"sext;", U"\U00002736"},                               //✶
+    {"Sfr;", U"\U0001D516"},                                //𝔖
+    {"sfr;", U"\U0001D530"},                                //𝔰
+    {"sfrown;", U"\U00002322"},                             //⌢
+    {"sharp;", U"\U0000266F"},                              //♯
+    {"SHCHcy;", U"\U00000429"},                             //Щ
+    {"shchcy;", U"\U00000449"},                             //щ
+    {"SHcy;", U"\U00000428"},                               //Ш
+    {"shcy;", U"\U00000448"},                               //ш
+    {"ShortDownArrow;", U"\U00002193"},                     //↓
+    {"ShortLeftArrow;", U"\U00002190"},                     //←
+    {"shortmid;", U"\U00002223"},                           //∣
+    {"shortparallel;", U"\U00002225"},                      //∥
+    {"ShortRightArrow;", U"\U00002192"},                    //→
+    {"ShortUpArrow;", U"\U00002191"},                       //↑
+    {"shy;", U"\U000000AD"},                                //shy;
+    {"shy", U"\U000000AD"},                                 //shy
+    {"Sigma;", U"\U000003A3"},                              //Σ
+    {"sigma;", U"\U000003C3"},                              //σ
+    {"sigmaf;", U"\U000003C2"},                             //ς
+    {"sigmav;", U"\U000003C2"},                             //ς
+    {"sim;", U"\U0000223C"},                                //∼
+    {"simdot;", U"\U00002A6A"},                             //⩪
+    {"sime;", U"\U00002243"},                               //≃
+    {"simeq;", U"\U00002243"},                              //≃
+    {"simg;", U"\U00002A9E"},                               //⪞
+    {"simgE;", U"\U00002AA0"},                              //⪠
+    {"siml;", U"\U00002A9D"},                               //⪝
+    {"simlE;", U"\U00002A9F"},                              //⪟
+    {"simne;", U"\U00002246"},                              //≆
+    {"simplus;", U"\U00002A24"},                            //⨤
+    {"simrarr;", U"\U00002972"},                            //⥲
+    {"slarr;", U"\U00002190"},                              //←
+    {"SmallCircle;", U"\U00002218"},                        //∘
+    {"smallsetminus;", U"\U00002216"},                      //∖
+    {"smashp;", U"\U00002A33"},                             //⨳
+    {"smeparsl;", U"\U000029E4"},                           //⧤
+    {"smid;", U"\U00002223"},                               //∣
+    {"smile;", U"\U00002323"},                              //⌣
+    {"smt;", U"\U00002AAA"},                                //⪪
+    {"smte;", U"\U00002AAC"},                               //⪬
+    {"smtes;", U"\U00002AAC\U0000FE00"},                    //smtes;
+    {"SOFTcy;", U"\U0000042C"},                             //Ь
+    {"softcy;", U"\U0000044C"},                             //ь
+    {"sol;", U"\U0000002F"},                                ///
+    {"solb;", U"\U000029C4"},                               //⧄
+    {"solbar;", U"\U0000233F"},                             //⌿
+    {"Sopf;", U"\U0001D54A"},                               //𝕊
+    {"sopf;", U"\U0001D564"},                               //𝕤
+    {"spades;", U"\U00002660"},                             //♠
+    {"spadesuit;", U"\U00002660"},                          //♠
+    {"spar;", U"\U00002225"},                               //∥
+    {"sqcap;", U"\U00002293"},                              //⊓
+    {"sqcaps;", U"\U00002293\U0000FE00"},                   //sqcaps;
+    {"sqcup;", U"\U00002294"},                              //⊔
+    {"sqcups;", U"\U00002294\U0000FE00"},                   //sqcups;
+    {"Sqrt;", U"\U0000221A"},                               //√
+    {"sqsub;", U"\U0000228F"},                              //⊏
+    {"sqsube;", U"\U00002291"},                             //⊑
+    {"sqsubset;", U"\U0000228F"},                           //⊏
+    {"sqsubseteq;", U"\U00002291"},                         //⊑
+    {"sqsup;", U"\U00002290"},                              //⊐
+    {"sqsupe;", U"\U00002292"},                             //⊒
+    {"sqsupset;", U"\U00002290"},                           //⊐
+    {"sqsupseteq;", U"\U00002292"},                         //⊒
+    {"squ;", U"\U000025A1"},                                //□
+    {"Square;", U"\U000025A1"},                             //□
+    {"square;", U"\U000025A1"},                             //□
+    {"SquareIntersection;", U"\U00002293"},                 //⊓
+    {"SquareSubset;", U"\U0000228F"},                       //⊏
+    {"SquareSubsetEqual;", U"\U00002291"},                  //⊑
+    {"SquareSuperset;", U"\U00002290"},                     //⊐
+    {"SquareSupersetEqual;", U"\U00002292"},                //⊒
+    {"SquareUnion;", U"\U00002294"},                        //⊔
+    {"squarf;", U"\U000025AA"},                             //▪
+    {"squf;", U"\U000025AA"},                               //▪
+    {"srarr;", U"\U00002192"},                              //→
+    {"Sscr;", U"\U0001D4AE"},                               //𝒮
+    {"sscr;", U"\U0001D4C8"},                               //𝓈
+    {"ssetmn;", U"\U00002216"},                             //∖
+    {"ssmile;", U"\U00002323"},                             //⌣
+    {"sstarf;", U"\U000022C6"},                             //⋆
+    {"Star;", U"\U000022C6"},                               //⋆
+    {"star;", U"\U00002606"},                               //☆
+    {"starf;", U"\U00002605"},                              //★
+    {"straightepsilon;", U"\U000003F5"},                    //ϵ
+    {"straightphi;", U"\U000003D5"},                        //ϕ
+    {"strns;", U"\U000000AF"},                              //¯
+    {"Sub;", U"\U000022D0"},                                //⋐
+    {"sub;", U"\U00002282"},                                //⊂
+    {"subdot;", U"\U00002ABD"},                             //⪽
+    {"subE;", U"\U00002AC5"},                               //⫅
+    {"sube;", U"\U00002286"},                               //⊆
+    {"subedot;", U"\U00002AC3"},                            //⫃
+    {"submult;", U"\U00002AC1"},                            //⫁
+    {"subnE;", U"\U00002ACB"},                              //⫋
+    {"subne;", U"\U0000228A"},                              //⊊
+    {"subplus;", U"\U00002ABF"},                            //⪿
+    {"subrarr;", U"\U00002979"},                            //⥹
+    {"Subset;", U"\U000022D0"},                             //⋐
+    {"subset;", U"\U00002282"},                             //⊂
+    {"subseteq;", U"\U00002286"},                           //⊆
+    {"subseteqq;", U"\U00002AC5"},                          //⫅
+    {"SubsetEqual;", U"\U00002286"},                        //⊆
+    {"subsetneq;", U"\U0000228A"},                          //⊊
+    {"subsetneqq;", U"\U00002ACB"},                         //⫋
+    {"subsim;", U"\U00002AC7"},                             //⫇
+    {"subsub;", U"\U00002AD5"},                             //⫕
+    {"subsup;", U"\U00002AD3"},                             //⫓
+    {"succ;", U"\U0000227B"},                               //≻
+    {"succapprox;", U"\U00002AB8"},                         //⪸
+    {"succcurlyeq;", U"\U0000227D"},                        //≽
+    {"Succeeds;", U"\U0000227B"},                           //≻
+    {"SucceedsEqual;", U"\U00002AB0"},                      //⪰
+    {"SucceedsSlantEqual;", U"\U0000227D"},                 //≽
+    {"SucceedsTilde;", U"\U0000227F"},                      //≿
+    {"succeq;", U"\U00002AB0"},                             //⪰
+    {"succnapprox;", U"\U00002ABA"},                        //⪺
+    {"succneqq;", U"\U00002AB6"},                           //⪶
+    {"succnsim;", U"\U000022E9"},                           //⋩
+    {"succsim;", U"\U0000227F"},                            //≿
+    {"SuchThat;", U"\U0000220B"},                           //∋
+    {"Sum;", U"\U00002211"},                                //∑
+    {"sum;", U"\U00002211"},                                //∑
+    {"sung;", U"\U0000266A"},                               //♪
+    {"Sup;", U"\U000022D1"},                                //⋑
+    {"sup;", U"\U00002283"},                                //⊃
+    {"sup1;", U"\U000000B9"},                               //¹
+    {"sup1", U"\U000000B9"},                                //¹
+    {"sup2;", U"\U000000B2"},                               //²
+    {"sup2", U"\U000000B2"},                                //²
+    {"sup3;", U"\U000000B3"},                               //³
+    {"sup3", U"\U000000B3"},                                //³
+    {"supdot;", U"\U00002ABE"},                             //⪾
+    {"supdsub;", U"\U00002AD8"},                            //⫘
+    {"supE;", U"\U00002AC6"},                               //⫆
+    {"supe;", U"\U00002287"},                               //⊇
+    {"supedot;", U"\U00002AC4"},                            //⫄
+    {"Superset;", U"\U00002283"},                           //⊃
+    {"SupersetEqual;", U"\U00002287"},                      //⊇
+    {"suphsol;", U"\U000027C9"},                            //⟉
+    {"suphsub;", U"\U00002AD7"},                            //⫗
+    {"suplarr;", U"\U0000297B"},                            //⥻
+    {"supmult;", U"\U00002AC2"},                            //⫂
+    {"supnE;", U"\U00002ACC"},                              //⫌
+    {"supne;", U"\U0000228B"},                              //⊋
+    {"supplus;", U"\U00002AC0"},                            //⫀
+    {"Supset;", U"\U000022D1"},                             //⋑
+    {"supset;", U"\U00002283"},                             //⊃
+    {"supseteq;", U"\U00002287"},                           //⊇
+    {"supseteqq;", U"\U00002AC6"},                          //⫆
+    {"supsetneq;", U"\U0000228B"},                          //⊋
+    {"supsetneqq;", U"\U00002ACC"},                         //⫌
+    {"supsim;", U"\U00002AC8"},                             //⫈
+    {"supsub;", U"\U00002AD4"},                             //⫔
+    {"supsup;", U"\U00002AD6"},                             //⫖
+    {"swarhk;", U"\U00002926"},                             //⤦
+    {"swArr;", U"\U000021D9"},                              //⇙
+    {"swarr;", U"\U00002199"},                              //↙
+    {"swarrow;", U"\U00002199"},                            //↙
+    {"swnwar;", U"\U0000292A"},                             //⤪
+    {"szlig;", U"\U000000DF"},                              //ß
+    {"szlig", U"\U000000DF"},                               //ß
+    {"Tab;", U"\U00000009"},                                //␉
+    {"target;", U"\U00002316"},                             //⌖
+    {"Tau;", U"\U000003A4"},                                //Τ
+    {"tau;", U"\U000003C4"},                                //τ
+    {"tbrk;", U"\U000023B4"},                               //⎴
+    {"Tcaron;", U"\U00000164"},                             //Ť
+    {"tcaron;", U"\U00000165"},                             //ť
+    {"Tcedil;", U"\U00000162"},                             //Ţ
+    {"tcedil;", U"\U00000163"},                             //ţ
+    {"Tcy;", U"\U00000422"},                                //Т
+    {"tcy;", U"\U00000442"},                                //т
+    {"tdot;", U"\U000020DB"},                               //◌⃛
+    {"telrec;", U"\U00002315"},                             //⌕
+    {"Tfr;", U"\U0001D517"},                                //𝔗
+    {"tfr;", U"\U0001D531"},                                //𝔱
+    {"there4;", U"\U00002234"},                             //∴
+    {"Therefore;", U"\U00002234"},                          //∴
+    {"therefore;", U"\U00002234"},                          //∴
+    {"Theta;", U"\U00000398"},                              //Θ
+    {"theta;", U"\U000003B8"},                              //θ
+    {"thetasym;", U"\U000003D1"},                           //ϑ
+    {"thetav;", U"\U000003D1"},                             //ϑ
+    {"thickapprox;", U"\U00002248"},                        //≈
+    {"thicksim;", U"\U0000223C"},                           //∼
+    {"ThickSpace;", U"\U0000205F\U0000200A"},               //U+0200A
+    {"thinsp;", U"\U00002009"},                             //thinsp;
+    {"ThinSpace;", U"\U00002009"},                          //ThinSpace;
+    {"thkap;", U"\U00002248"},                              //≈
+    {"thksim;", U"\U0000223C"},                             //∼
+    {"THORN;", U"\U000000DE"},                              //Þ
+    {"THORN", U"\U000000DE"},                               //Þ
+    {"thorn;", U"\U000000FE"},                              //þ
+    {"thorn", U"\U000000FE"},                               //þ
+    {"Tilde;", U"\U0000223C"},                              //∼
+    {"tilde;", U"\U000002DC"},                              //˜
+    {"TildeEqual;", U"\U00002243"},                         //≃
+    {"TildeFullEqual;", U"\U00002245"},                     //≅
+    {"TildeTilde;", U"\U00002248"},                         //≈
+    {"times;", U"\U000000D7"},                              //×
+    {"times", U"\U000000D7"},                               //×
+    {"timesb;", U"\U000022A0"},                             //⊠
+    {"timesbar;", U"\U00002A31"},                           //⨱
+    {"timesd;", U"\U00002A30"},                             //⨰
+    {"tint;", U"\U0000222D"},                               //∭
+    {"toea;", U"\U00002928"},                               //⤨
+    {"top;", U"\U000022A4"},                                //⊤
+    {"topbot;", U"\U00002336"},                             //⌶
+    {"topcir;", U"\U00002AF1"},                             //⫱
+    {"Topf;", U"\U0001D54B"},                               //𝕋
+    {"topf;", U"\U0001D565"},                               //𝕥
+    {"topfork;", U"\U00002ADA"},                            //⫚
+    {"tosa;", U"\U00002929"},                               //⤩
+    {"tprime;", U"\U00002034"},                             //‴
+    {"TRADE;", U"\U00002122"},                              //™
+    {"trade;", U"\U00002122"},                              //™
+    {"triangle;", U"\U000025B5"},                           //▵
+    {"triangledown;", U"\U000025BF"},                       //▿
+    {"triangleleft;", U"\U000025C3"},                       //◃
+    {"trianglelefteq;", U"\U000022B4"},                     //⊴
+    {"triangleq;", U"\U0000225C"},                          //≜
+    {"triangleright;", U"\U000025B9"},                      //▹
+    {"trianglerighteq;", U"\U000022B5"},                    //⊵
+    {"tridot;", U"\U000025EC"},                             //◬
+    {"trie;", U"\U0000225C"},                               //≜
+    {"triminus;", U"\U00002A3A"},                           //⨺
+    {"TripleDot;", U"\U000020DB"},                          //◌⃛
+    {"triplus;", U"\U00002A39"},                            //⨹
+    {"trisb;", U"\U000029CD"},                              //⧍
+    {"tritime;", U"\U00002A3B"},                            //⨻
+    {"trpezium;", U"\U000023E2"},                           //⏢
+    {"Tscr;", U"\U0001D4AF"},                               //𝒯
+    {"tscr;", U"\U0001D4C9"},                               //𝓉
+    {"TScy;", U"\U00000426"},                               //Ц
+    {"tscy;", U"\U00000446"},                               //ц
+    {"TSHcy;", U"\U0000040B"},                              //Ћ
+    {"tshcy;", U"\U0000045B"},                              //ћ
+    {"Tstrok;", U"\U00000166"},                             //Ŧ
+    {"tstrok;", U"\U00000167"},                             //ŧ
+    {"twixt;", U"\U0000226C"},                              //≬
+    {"twoheadleftarrow;", U"\U0000219E"},                   //↞
+    {"twoheadrightarrow;", U"\U000021A0"},                  //↠
+    {"Uacute;", U"\U000000DA"},                             //Ú
+    {"Uacute", U"\U000000DA"},                              //Ú
+    {"uacute;", U"\U000000FA"},                             //ú
+    {"uacute", U"\U000000FA"},                              //ú
+    {"Uarr;", U"\U0000219F"},                               //↟
+    {"uArr;", U"\U000021D1"},                               //⇑
+    {"uarr;", U"\U00002191"},                               //↑
+    {"Uarrocir;", U"\U00002949"},                           //⥉
+    {"Ubrcy;", U"\U0000040E"},                              //Ў
+    {"ubrcy;", U"\U0000045E"},                              //ў
+    {"Ubreve;", U"\U0000016C"},                             //Ŭ
+    {"ubreve;", U"\U0000016D"},                             //ŭ
+    {"Ucirc;", U"\U000000DB"},                              //Û
+    {"Ucirc", U"\U000000DB"},                               //Û
+    {"ucirc;", U"\U000000FB"},                              //û
+    {"ucirc", U"\U000000FB"},                               //û
+    {"Ucy;", U"\U00000423"},                                //У
+    {"ucy;", U"\U00000443"},                                //у
+    {"udarr;", U"\U000021C5"},                              //⇅
+    {"Udblac;", U"\U00000170"},                             //Ű
+    {"udblac;", U"\U00000171"},                             //ű
+    {"udhar;", U"\U0000296E"},                              //⥮
+    {"ufisht;", U"\U0000297E"},                             //⥾
+    {"Ufr;", U"\U0001D518"},                                //𝔘
+    {"ufr;", U"\U0001D532"},                                //𝔲
+    {"Ugrave;", U"\U000000D9"},                             //Ù
+    {"Ugrave", U"\U000000D9"},                              //Ù
+    {"ugrave;", U"\U000000F9"},                             //ù
+    {"ugrave", U"\U000000F9"},                              //ù
+    {"uHar;", U"\U00002963"},                               //⥣
+    {"uharl;", U"\U000021BF"},                              //↿
+    {"uharr;", U"\U000021BE"},                              //↾
+    {"uhblk;", U"\U00002580"},                              //▀
+    {"ulcorn;", U"\U0000231C"},                             //⌜
+    {"ulcorner;", U"\U0000231C"},                           //⌜
+    {"ulcrop;", U"\U0000230F"},                             //⌏
+    {"ultri;", U"\U000025F8"},                              //◸
+    {"Umacr;", U"\U0000016A"},                              //Ū
+    {"umacr;", U"\U0000016B"},                              //ū
+    {"uml;", U"\U000000A8"},                                //¨
+    {"uml", U"\U000000A8"},                                 //¨
+    {"UnderBar;", U"\U0000005F"},                           //_
+    {"UnderBrace;", U"\U000023DF"},                         //⏟
+    {"UnderBracket;", U"\U000023B5"},                       //⎵
+    {"UnderParenthesis;", U"\U000023DD"},                   //⏝
+    {"Union;", U"\U000022C3"},                              //⋃
+    {"UnionPlus;", U"\U0000228E"},                          //⊎
+    {"Uogon;", U"\U00000172"},                              //Ų
+    {"uogon;", U"\U00000173"},                              //ų
+    {"Uopf;", U"\U0001D54C"},                               //𝕌
+    {"uopf;", U"\U0001D566"},                               //𝕦
+    {"UpArrow;", U"\U00002191"},                            //↑
+    {"Uparrow;", U"\U000021D1"},                            //⇑
+    {"uparrow;", U"\U00002191"},                            //↑
+    {"UpArrowBar;", U"\U00002912"},                         //⤒
+    {"UpArrowDownArrow;", U"\U000021C5"},                   //⇅
+    {"UpDownArrow;", U"\U00002195"},                        //↕
+    {"Updownarrow;", U"\U000021D5"},                        //⇕
+    {"updownarrow;", U"\U00002195"},                        //↕
+    {"UpEquilibrium;", U"\U0000296E"},                      //⥮
+    {"upharpoonleft;", U"\U000021BF"},                      //↿
+    {"upharpoonright;", U"\U000021BE"},                     //↾
+    {"uplus;", U"\U0000228E"},                              //⊎
+    {"UpperLeftArrow;", U"\U00002196"},                     //↖
+    {"UpperRightArrow;", U"\U00002197"},                    //↗
+    {"Upsi;", U"\U000003D2"},                               //ϒ
+    {"upsi;", U"\U000003C5"},                               //υ
+    {"upsih;", U"\U000003D2"},                              //ϒ
+    {"Upsilon;", U"\U000003A5"},                            //Υ
+    {"upsilon;", U"\U000003C5"},                            //υ
+    {"UpTee;", U"\U000022A5"},                              //⊥
+    {"UpTeeArrow;", U"\U000021A5"},                         //↥
+    {"upuparrows;", U"\U000021C8"},                         //⇈
+    {"urcorn;", U"\U0000231D"},                             //⌝
+    {"urcorner;", U"\U0000231D"},                           //⌝
+    {"urcrop;", U"\U0000230E"},                             //⌎
+    {"Uring;", U"\U0000016E"},                              //Ů
+    {"uring;", U"\U0000016F"},                              //ů
+    {"urtri;", U"\U000025F9"},                              //◹
+    {"Uscr;", U"\U0001D4B0"},                               //𝒰
+    {"uscr;", U"\U0001D4CA"},                               //𝓊
+    {"utdot;", U"\U000022F0"},                              //⋰
+    {"Utilde;", U"\U00000168"},                             //Ũ
+    {"utilde;", U"\U00000169"},                             //ũ
+    {"utri;", U"\U000025B5"},                               //▵
+    {"utrif;", U"\U000025B4"},                              //▴
+    {"uuarr;", U"\U000021C8"},                              //⇈
+    {"Uuml;", U"\U000000DC"},                               //Ü
+    {"Uuml", U"\U000000DC"},                                //Ü
+    {"uuml;", U"\U000000FC"},                               //ü
+    {"uuml", U"\U000000FC"},                                //ü
+    {"uwangle;", U"\U000029A7"},                            //⦧
+    {"vangrt;", U"\U0000299C"},                             //⦜
+    {"varepsilon;", U"\U000003F5"},                         //ϵ
+    {"varkappa;", U"\U000003F0"},                           //ϰ
+    {"varnothing;", U"\U00002205"},                         //∅
+    {"varphi;", U"\U000003D5"},                             //ϕ
+    {"varpi;", U"\U000003D6"},                              //ϖ
+    {"varpropto;", U"\U0000221D"},                          //∝
+    {"vArr;", U"\U000021D5"},                               //⇕
+    {"varr;", U"\U00002195"},                               //↕
+    {"varrho;", U"\U000003F1"},                             //ϱ
+    {"varsigma;", U"\U000003C2"},                           //ς
+    {"varsubsetneq;", U"\U0000228A\U0000FE00"},             //varsubsetneq;
+    {"varsubsetneqq;", U"\U00002ACB\U0000FE00"},            //varsubsetneqq;
+    {"varsupsetneq;", U"\U0000228B\U0000FE00"},             //varsupsetneq;
+    {"varsupsetneqq;", U"\U00002ACC\U0000FE00"},            //varsupsetneqq;
+    {"vartheta;", U"\U000003D1"},                           //ϑ
+    {"vartriangleleft;", U"\U000022B2"},                    //⊲
+    {"vartriangleright;", U"\U000022B3"},                   //⊳
+    {"Vbar;", U"\U00002AEB"},                               //⫫
+    {"vBar;", U"\U00002AE8"},                               //⫨
+    {"vBarv;", U"\U00002AE9"},                              //⫩
+    {"Vcy;", U"\U00000412"},                                //В
+    {"vcy;", U"\U00000432"},                                //в
+    {"VDash;", U"\U000022AB"},                              //⊫
+    {"Vdash;", U"\U000022A9"},                              //⊩
+    {"vDash;", U"\U000022A8"},                              //⊨
+    {"vdash;", U"\U000022A2"},                              //⊢
+    {"Vdashl;", U"\U00002AE6"},                             //⫦
+    {"Vee;", U"\U000022C1"},                                //⋁
+    {"vee;", U"\U00002228"},                                //∨
+    {"veebar;", U"\U000022BB"},                             //⊻
+    {"veeeq;", U"\U0000225A"},                              //≚
+    {"vellip;", U"\U000022EE"},                             //⋮
+    {"Verbar;", U"\U00002016"},                             //‖
+    {"verbar;", U"\U0000007C"},                             //|
+    {"Vert;", U"\U00002016"},                               //‖
+    {"vert;", U"\U0000007C"},                               //|
+    {"VerticalBar;", U"\U00002223"},                        //∣
+    {"VerticalLine;", U"\U0000007C"},                       //|
+    {"VerticalSeparator;", U"\U00002758"},                  //❘
+    {"VerticalTilde;", U"\U00002240"},                      //≀
+    {"VeryThinSpace;", U"\U0000200A"},                      //VeryThinSpace;
+    {"Vfr;", U"\U0001D519"},                                //𝔙
+    {"vfr;", U"\U0001D533"},                                //𝔳
+    {"vltri;", U"\U000022B2"},                              //⊲
+    {"vnsub;", U"\U00002282\U000020D2"},                    //vnsub;
+    {"vnsup;", U"\U00002283\U000020D2"},                    //vnsup;
+    {"Vopf;", U"\U0001D54D"},                               //𝕍
+    {"vopf;", U"\U0001D567"},                               //𝕧
+    {"vprop;", U"\U0000221D"},                              //∝
+    {"vrtri;", U"\U000022B3"},                              //⊳
+    {"Vscr;", U"\U0001D4B1"},                               //𝒱
+    {"vscr;", U"\U0001D4CB"},                               //𝓋
+    {"vsubnE;", U"\U00002ACB\U0000FE00"},                   //vsubnE;
+    {"vsubne;", U"\U0000228A\U0000FE00"},                   //vsubne;
+    {"vsupnE;", U"\U00002ACC\U0000FE00"},                   //vsupnE;
+    {"vsupne;", U"\U0000228B\U0000FE00"},                   //vsupne;
+    {"Vvdash;", U"\U000022AA"},                             //⊪
+    {"vzigzag;", U"\U0000299A"},                            //⦚
+    {"Wcirc;", U"\U00000174"},                              //Ŵ
+    {"wcirc;", U"\U00000175"},                              //ŵ
+    {"wedbar;", U"\U00002A5F"},                             //⩟
+    {"Wedge;", U"\U000022C0"},                              //⋀
+    {"wedge;", U"\U00002227"},                              //∧
+    {"wedgeq;", U"\U00002259"},                             //≙
+    {"weierp;", U"\U00002118"},                             //℘
+    {"Wfr;", U"\U0001D51A"},                                //𝔚
+    {"wfr;", U"\U0001D534"},                                //𝔴
+    {"Wopf;", U"\U0001D54E"},                               //𝕎
+    {"wopf;", U"\U0001D568"},                               //𝕨
+    {"wp;", U"\U00002118"},                                 //℘
+    {"wr;", U"\U00002240"},                                 //≀
+    {"wreath;", U"\U00002240"},                             //≀
+    {"Wscr;", U"\U0001D4B2"},                               //𝒲
+    {"wscr;", U"\U0001D4CC"},                               //𝓌
+    {"xcap;", U"\U000022C2"},                               //⋂
+    {"xcirc;", U"\U000025EF"},                              //◯
+    {"xcup;", U"\U000022C3"},                               //⋃
+    {"xdtri;", U"\U000025BD"},                              //▽
+    {"Xfr;", U"\U0001D51B"},                                //𝔛
+    {"xfr;", U"\U0001D535"},                                //𝔵
+    {"xhArr;", U"\U000027FA"},                              //⟺
+    {"xharr;", U"\U000027F7"},                              //⟷
+    {"Xi;", U"\U0000039E"},                                 //Ξ
+    {"xi;", U"\U000003BE"},                                 //ξ
+    {"xlArr;", U"\U000027F8"},                              //⟸
+    {"xlarr;", U"\U000027F5"},                              //⟵
+    {"xmap;", U"\U000027FC"},                               //⟼
+    {"xnis;", U"\U000022FB"},                               //⋻
+    {"xodot;", U"\U00002A00"},                              //⨀
+    {"Xopf;", U"\U0001D54F"},                               //𝕏
+    {"xopf;", U"\U0001D569"},                               //𝕩
+    {"xoplus;", U"\U00002A01"},                             //⨁
+    {"xotime;", U"\U00002A02"},                             //⨂
+    {"xrArr;", U"\U000027F9"},                              //⟹
+    {"xrarr;", U"\U000027F6"},                              //⟶
+    {"Xscr;", U"\U0001D4B3"},                               //𝒳
+    {"xscr;", U"\U0001D4CD"},                               //𝓍
+    {"xsqcup;", U"\U00002A06"},                             //⨆
+    {"xuplus;", U"\U00002A04"},                             //⨄
+    {"xutri;", U"\U000025B3"},                              //△
+    {"xvee;", U"\U000022C1"},                               //⋁
+    {"xwedge;", U"\U000022C0"},                             //⋀
+    {"Yacute;", U"\U000000DD"},                             //Ý
+    {"Yacute", U"\U000000DD"},                              //Ý
+    {"yacute;", U"\U000000FD"},                             //ý
+    {"yacute", U"\U000000FD"},                              //ý
+    {"YAcy;", U"\U0000042F"},                               //Я
+    {"yacy;", U"\U0000044F"},                               //я
+    {"Ycirc;", U"\U00000176"},                              //Ŷ
+    {"ycirc;", U"\U00000177"},                              //ŷ
+    {"Ycy;", U"\U0000042B"},                                //Ы
+    {"ycy;", U"\U0000044B"},                                //ы
+    {"yen;", U"\U000000A5"},                                //¥
+    {"yen", U"\U000000A5"},                                 //¥
+    {"Yfr;", U"\U0001D51C"},                                //𝔜
+    {"yfr;", U"\U0001D536"},                                //𝔶
+    {"YIcy;", U"\U00000407"},                               //Ї
+    {"yicy;", U"\U00000457"},                               //ї
+    {"Yopf;", U"\U0001D550"},                               //𝕐
+    {"yopf;", U"\U0001D56A"},                               //𝕪
+    {"Yscr;", U"\U0001D4B4"},                               //𝒴
+    {"yscr;", U"\U0001D4CE"},                               //𝓎
+    {"YUcy;", U"\U0000042E"},                               //Ю
+    {"yucy;", U"\U0000044E"},                               //ю
+    {"Yuml;", U"\U00000178"},                               //Ÿ
+    {"yuml;", U"\U000000FF"},                               //ÿ
+    {"yuml", U"\U000000FF"},                                //ÿ
+    {"Zacute;", U"\U00000179"},                             //Ź
+    {"zacute;", U"\U0000017A"},                             //ź
+    {"Zcaron;", U"\U0000017D"},                             //Ž
+    {"zcaron;", U"\U0000017E"},                             //ž
+    {"Zcy;", U"\U00000417"},                                //З
+    {"zcy;", U"\U00000437"},                                //з
+    {"Zdot;", U"\U0000017B"},                               //Ż
+    {"zdot;", U"\U0000017C"},                               //ż
+    {"zeetrf;", U"\U00002128"},                             //ℨ
+    {"ZeroWidthSpace;", U"\U0000200B"},                     //​
+    {"Zeta;", U"\U00000396"},                               //Ζ
+    {"zeta;", U"\U000003B6"},                               //ζ
+    {"Zfr;", U"\U00002128"},                                //ℨ
+    {"zfr;", U"\U0001D537"},                                //𝔷
+    {"ZHcy;", U"\U00000416"},                               //Ж
+    {"zhcy;", U"\U00000436"},                               //ж
+    {"zigrarr;", U"\U000021DD"},                            //⇝
+    {"Zopf;", U"\U00002124"},                               //ℤ
+    {"zopf;", U"\U0001D56B"},                               //𝕫
+    {"Zscr;", U"\U0001D4B5"},                               //𝒵
+    {"zscr;", U"\U0001D4CF"},                               //𝓏
+    {"zwj;", U"\U0000200D"},                                //‍
+    {"zwnj;", U"\U0000200C"},                               //‌
+};
+
+constexpr size_t REFERENCE_NUMBER = std::size(NAMED_REFERENCES);
+
+/**
+ * Node of trie, children of every node are next to each other and sorted by character
+ */
+struct TrieNode {
+  char character = 0;
+  uint8_t childNumber = 0;
+  uint16_t firstChild = 0;
+  //Index of reference whose name ends in node, or NO_REFERENCE
+  uint16_t reference = NO_REFERENCE;
+
+  constexpr static uint16_t NO_REFERENCE = UINT16_MAX;
+};
+
+static_assert(REFERENCE_NUMBER < TrieNode::NO_REFERENCE);
+
+/**
+ * Build trie nodes in breadth first order, root is first node.
+ * Node of every prefix covers range of references sorted by name that start with that prefix.
+ */
+constexpr std::vector<TrieNode> buildNodes() {
+  std::array<uint16_t, REFERENCE_NUMBER> order{};
+  for (size_t index = 0; index < REFERENCE_NUMBER; index++)
+    order[index] = index;
+  std::sort(order.begin(), order.end(), [](uint16_t first, uint16_t second) {
+    return NAMED_REFERENCES[first].name < NAMED_REFERENCES[second].name;
+  });
+  auto name = [&order](size_t sortedIndex) { return NAMED_REFERENCES[order[sortedIndex]].name; };
+
+  struct Prefix {
+    size_t node;
+    size_t begin;
+    size_t end;
+    size_t length;
+  };
+  std::vector<TrieNode> nodes(1);
+  std::vector<Prefix> prefixes{{0, 0, REFERENCE_NUMBER, 0}};
+
+  for (size_t next = 0; next < prefixes.size(); next++) {
+    Prefix prefix = prefixes[next];
+    size_t begin = prefix.begin;
+
+    //Name equal to prefix is sorted before all longer names
+    if (name(begin).size() == prefix.length)
+      nodes[prefix.node].reference = order[begin++];
+
+    nodes[prefix.node].firstChild = nodes.size();
+    while (begin < prefix.end) {
+      char character = name(begin)[prefix.length];
+      size_t end = begin;
+      while (end < prefix.end && name(end)[prefix.length] == character)
+        end++;
+
+      prefixes.push_back({nodes.size(), begin, end, prefix.length + 1});
+      nodes.push_back({character});
+      begin = end;
+    }
+    nodes[prefix.node].childNumber = nodes.size() - nodes[prefix.node].firstChild;
+  }
+  return nodes;
+}
+
+constexpr size_t NODE_NUMBER = buildNodes().size();
+static_assert(NODE_NUMBER <= UINT16_MAX);
+
+constexpr std::array<TrieNode, NODE_NUMBER> makeTrie() {
+  std::array<TrieNode, NODE_NUMBER> trie{};
+  std::vector<TrieNode> nodes = buildNodes();
+  std::copy(nodes.begin(), nodes.end(), trie.begin());
+  return trie;
+}
+
+constexpr std::array<TrieNode, NODE_NUMBER> TRIE = makeTrie();
+}
+
+NamedReferenceTrie::Match NamedReferenceTrie::longestMatch(std::u32string_view input) {
+  Match match;
+  const TrieNode *node = TRIE.data();
+
+  for (size_t length = 1; length <= input.size(); length++) {
+    char32_t character = input[length - 1];
+    //All names are ASCII
+    if (character >= 0x80)
+      break;
+
+    auto childrenBegin = TRIE.begin() + node->firstChild;
+    auto childrenEnd = childrenBegin + node->childNumber;
+    auto child = std::lower_bound(childrenBegin, childrenEnd, character,
+                                  [](const TrieNode &child, char32_t character) {
+                                    return static_cast<unsigned char>(child.character) < character;
+                                  });
+    if (child == childrenEnd || static_cast<unsigned char>(child->character) != character)
+      break;
+
+    node = &*child;
+    if (node->reference != TrieNode::NO_REFERENCE)
+      match = {length, NAMED_REFERENCES[node->reference].value};
+  }
+  return match;
+}
+
+} // namespace webvtt
@@ -6,9 +6,6 @@
 #include "exceptions/parser_util/IteratorsNotPointToGivenString.hpp"
 #include "exceptions/cue_parsing/CueParsingError.hpp"
 #include "exceptions/cue_parsing/CueParsingTimingException.hpp"
-#include "exceptions/parser_util/ParsingFloatPointNumber.hpp"
-#include "exceptions/parser_util/ParsingTimeStampException.hpp"
-#include "exceptions/parser_util/PercentageFormatNotValid.hpp"
 #include <stack>
 
 namespace webvtt {
@@ -39,8 +36,12 @@ CueParser::parseAndSetTiming(std::u32string_view input, std::u32string_view::ite
     if (position == input.end())
       throw CueParsingTimingException();
 
-    double timePoint1 = ParserUtil::parseTimeStamp(input.substr(position - input.begin()), position);
-    currentObject->setStartTime(timePoint1);
+    auto timePoint1 = ParserUtil::tryParseTimeStamp(input.substr(position - input.begin()), position);
+    if (!timePoint1) {
+      DILOGE(getParseErrorMessage(timePoint1.error()));
+      throw CueParsingTimingException();
+    }
+    currentObject->setStartTime(*timePoint1);
 
     ParserUtil::skipWhiteSpaces(input, position);
     if (position == input.end())
@@ -53,14 +54,14 @@ CueParser::parseAndSetTiming(std::u32string_view input, std::u32string_view::ite
 
     ParserUtil::skipWhiteSpaces(input, position);
 
-    double timePoint2 = ParserUtil::parseTimeStamp(input.substr(position - input.begin()), position);
-    currentObject->setEndTime(timePoint2);
+    auto timePoint2 = ParserUtil::tryParseTimeStamp(input.substr(position - input.begin()), position);
+    if (!timePoint2) {
+      DILOGE(getParseErrorMessage(timePoint2.error()));
+      throw CueParsingTimingException();
+    }
+    currentObject->setEndTime(*timePoint2);
     return;
   }
-  catch (const ParsingTimeStampException &error) {
-    DILOGE(error.what());
-    throw CueParsingTimingException();
-  }
   catch (const IteratorsNotPointToGivenString &error) {
     DILOGE(error.what());
     throw CueParsingTimingException();
@@ -69,11 +70,10 @@ CueParser::parseAndSetTiming(std::u32string_view input, std::u32string_view::ite
 
 void CueParser::parseAndSetSetting(std::u32string_view input, std::u32string_view::iterator &position) {
   std::u32string_view setting;
-  std::u32string characters = {ParserUtil::SPACE_C, ParserUtil::TAB_C};
   try {
     while (position != input.end()) {
 
-      setting = ParserUtil::parseUntilAnyOfGivenCharacters(input, characters, position);
+      setting = ParserUtil::parseUntilCondition(input, position, ParserUtil::IS_SPACE_OR_TAB);
       if (position != input.end())
         position++;
 
@@ -176,7 +176,11 @@ void CueParser::parseAndSetPositionSetting(std::u32string_view value) {
       }
     }
 
-    double number = ParserUtil::parsePercentage(colPos);
+    auto number = ParserUtil::tryParsePercentage(colPos);
+    if (!number) {
+      DILOGE(getParseErrorMessage(number.error()));
+      return;
+    }
 
     if (ParserUtil::compareU32Strings(colAlign, LINE_LEFT)) {
       currentObject->setPositionAlignment(Cue::Alignment::LEFT);
@@ -187,10 +191,7 @@ void CueParser::parseAndSetPositionSetting(std::u32string_view value) {
     } else if (!colAlign.empty())
       return;
 
-    currentObject->setPosition(number);
-  }
-  catch (const PercentageFormatNotValid &error) {
-    DILOGE(error.what());
+    currentObject->setPosition(*number);
   }
   catch (const CueParsingError &error) {
     DILOGE(error.what());
@@ -200,8 +201,7 @@ void CueParser::parseAndSetPositionSetting(std::u32string_view value) {
 void CueParser::parseAndSetLineSetting(std::u32string_view value) {
   try {
     std::u32string_view linePos = value, lineAlign;
-    std::optional<double> optionalNumber;
-    double number;
+    ParseResult<double> number = ParseError::EMPTY_INPUT;
 
     auto splitStrings = ParserUtil::splitStringAroundCharacter(value, ParserUtil::COMMA_C);
     if (splitStrings.has_value()) {
@@ -222,9 +222,13 @@ void CueParser::parseAndSetLineSetting(std::u32string_view value) {
       return;
 
     if (percentageOnLastPosition) {
-      number = ParserUtil::parsePercentage(linePos);
+      number = ParserUtil::tryParsePercentage(linePos);
     } else {
-      number = ParserUtil::parseFloatPointingNumber(linePos);
+      number = ParserUtil::tryParseFloatPointingNumber(linePos);
+    }
+    if (!number) {
+      DILOGE(getParseErrorMessage(number.error()));
+      return;
     }
 
     if (ParserUtil::compareU32Strings(lineAlign, START_ALIGNMENT)) {
@@ -236,7 +240,7 @@ void CueParser::parseAndSetLineSetting(std::u32string_view value) {
     } else if (!lineAlign.empty())
       return;
 
-    currentObject->setLineNumber(number);
+    currentObject->setLineNumber(*number);
 
     bool newSnapToLines = true;
     if (percentageOnLastPosition) {
@@ -247,51 +251,53 @@ void CueParser::parseAndSetLineSetting(std::u32string_view value) {
   catch (const CueParsingError &error) {
     DILOGE(error.what());
   }
-  catch (const ParsingFloatPointNumber &error) {
-    DILOGE(error.what());
-  }
-  catch (const PercentageFormatNotValid &error) {
-    DILOGE(error.what());
-  }
 }
 
 void CueParser::parseAndSetSizeSetting(std::u32string_view value) {
-  try {
-    double percentage = ParserUtil::parsePercentage(value);
-    if (percentage < 0 || percentage > 100)
-      return;
-    currentObject->setSize(percentage);
-  }
-  catch (const PercentageFormatNotValid &error) {
-    DILOGE(error.what());
+  auto percentage = ParserUtil::tryParsePercentage(value);
+  if (!percentage) {
+    DILOGE(getParseErrorMessage(percentage.error()));
+    return;
   }
+  if (*percentage < 0 || *percentage > 100)
+    return;
+  currentObject->setSize(*percentage);
 }
 
 void CueParser::setTextToObject(std::u32string text) {
   currentObject->setText(std::move(text));
 }
 
+void CueParser::setTextToObject(std::u8string_view text) {
+  currentObject->setText(text);
+}
+
 void CueParser::parseTextStyleAndMakeStyleTree(std::u32string_view defaultLangage) {
-  if (currentObject->getText().empty()) {
-    currentObject->setTextTreeRoot(nullptr);
-    return;
+  std::u32string_view text;
+  if (currentObject->getSourceText().empty()) {
+    text = currentObject->getText();
+  } else {
+    decodedText = ParserUtil::utf8to32(currentObject->getSourceText());
+    text = decodedText;
   }
-  cueTextTokenizer->setText(this->currentObject->getText());
-  std::shared_ptr<Token> token = nullptr;
 
-  std::stack<std::u32string> languages;
+  NodeArena &arena = currentObject->clearTextTree();
+  if (text.empty())
+    return;
+
+  cueTextTokenizer->setText(text);
+  std::stack<Atom> languages;
 
-  std::shared_ptr<NodeObject> root = std::make_shared<RootObject>();
+  NodeObject *root = arena.make<RootObject>();
 
-  std::shared_ptr<NodeObject> currentNode = root;
+  NodeObject *currentNode = root;
 
   if (!defaultLangage.empty())
-    languages.push(std::u32string(defaultLangage));
+    languages.push(Atom::intern(defaultLangage));
 
   while (cueTextTokenizer->getCurrentPosition() != cueTextTokenizer->getInput().end()) {
 
-    token = cueTextTokenizer->getNextToken();
-    token->process(currentNode, languages);
+    cueTextTokenizer->getNextToken().process(currentNode, languages, arena);
   }
   currentObject->setTextTreeRoot(root);
 };
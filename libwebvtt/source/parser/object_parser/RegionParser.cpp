@@ -1,22 +1,17 @@
 #include "exceptions/parser_util/IteratorsNotPointToGivenString.hpp"
-#include "exceptions/parser_util/PercentageFormatNotValid.hpp"
 #include "parser/object_parser/RegionParser.hpp"
 #include "parser/ParserUtil.hpp"
 #include "logger/LoggingUtility.hpp"
-#include "exceptions/parser_util/ParsingCoordinatesError.hpp"
-#include "exceptions/parser_util/ParsingFloatPointNumber.hpp"
-#include "exceptions/parser_util/ParsingLongNumberError.hpp"
 
 namespace webvtt {
 
 void RegionParser::buildObjectFromString(std::u32string_view input) {
   std::u32string_view setting;
   auto position = input.begin();
-  std::u32string characters = {ParserUtil::SPACE_C, ParserUtil::TAB_C, ParserUtil::LF_C, ParserUtil::CR_C};
 
   try {
     while (position != input.end()) {
-      setting = ParserUtil::parseUntilAnyOfGivenCharacters(input, characters, position);
+      setting = ParserUtil::parseUntilCondition(input, position, ParserUtil::IS_WHITE_SPACE);
       if (position != input.end())
         position++;
       auto settingInfoOptional = ParserUtil::splitStringAroundCharacter(setting, ParserUtil::COLON_C);
@@ -65,46 +60,41 @@ void RegionParser::parseAndSetIdSetting(std::u32string_view settingValue) {
 }
 
 void RegionParser::parseAndSetWidthSetting(std::u32string_view settingValue) {
-  try {
-    double value = ParserUtil::parsePercentage(settingValue);
-
-    currentObject->setWidth(value);
-  }
-  catch (const PercentageFormatNotValid &error) {
-    DILOGE(error.what());
+  auto value = ParserUtil::tryParsePercentage(settingValue);
+  if (!value) {
+    DILOGE(getParseErrorMessage(value.error()));
+    return;
   }
+  currentObject->setWidth(*value);
 }
 
 void RegionParser::parseAndSetLinesSetting(std::u32string_view settingValue) {
-  try {
-    double value = ParserUtil::parseLongNumber(settingValue, 10);
-
-    currentObject->setLines(value);
-  }
-  catch (const ParsingLongNumberError &error) {
-    DILOGE(error.what());
+  auto value = ParserUtil::tryParseLongNumber(settingValue, 10);
+  if (!value) {
+    DILOGE(getParseErrorMessage(value.error()));
+    return;
   }
+  currentObject->setLines(*value);
 }
 
 void RegionParser::parseAndSetAnchorSetting(std::u32string_view settingValue) {
-  try {
-    auto[xCoord, yCoord] = ParserUtil::parseCoordinates(settingValue, ParserUtil::COMMA_C);
-
-    currentObject->setAnchor({xCoord, yCoord});
-  }
-  catch (const ParsingCoordinatesError &error) {
-    DILOGE(error.what());
+  auto coordinates = ParserUtil::tryParseCoordinates(settingValue, ParserUtil::COMMA_C);
+  if (!coordinates) {
+    DILOGE(getParseErrorMessage(coordinates.error()));
+    return;
   }
+  auto[xCoord, yCoord] = *coordinates;
+  currentObject->setAnchor({xCoord, yCoord});
 }
 
 void RegionParser::parseAndSetViewPortAnchorSetting(std::u32string_view settingValue) {
-  try {
-    auto[xCoord, yCoord] = ParserUtil::parseCoordinates(settingValue, ParserUtil::COMMA_C);
-    currentObject->setViewAnchorPort({xCoord, yCoord});
-  }
-  catch (const ParsingCoordinatesError &error) {
-    DILOGE(error.what());
+  auto coordinates = ParserUtil::tryParseCoordinates(settingValue, ParserUtil::COMMA_C);
+  if (!coordinates) {
+    DILOGE(getParseErrorMessage(coordinates.error()));
+    return;
   }
+  auto[xCoord, yCoord] = *coordinates;
+  currentObject->setViewAnchorPort({xCoord, yCoord});
 }
 
 void RegionParser::parseAndSetScrollSetting(std::u32string_view settingValue) {
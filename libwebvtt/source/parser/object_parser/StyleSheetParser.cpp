@@ -8,10 +8,10 @@
 
 namespace webvtt {
 
-void StyleSheetParser::addCSSRule(std::string_view name, std::string_view value) {
+void StyleSheetParser::addCSSRule(CSSProperty property, std::string_view value) {
   for (auto &one : styleSheets) {
 
-    one->addCSSRule(name, value);
+    one->addCSSRule(property, value);
   }
 }
 
@@ -65,6 +65,12 @@ StyleSheetParser::setCombinatorToMostRecentSelector(StyleSelector::StyleSelector
   combinatorSelectorList.back()->setStyleSelectorCombinator(styleSelectorCombinator);
 }
 
+StyleSelector::StyleSelectorCombinator StyleSheetParser::getCombinatorOfMostRecentSelector() const {
+  if (combinatorSelectorList.empty())
+    return StyleSelector::StyleSelectorCombinator::UNDEFINED;
+  return combinatorSelectorList.back()->getStyleSelectorCombinator();
+}
+
 void StyleSheetParser::addCurrentObjectToStyleSheetList() {
   styleSheets.push_back(std::move(currentObject));
 }
@@ -96,6 +102,7 @@ void StyleSheetParser::reset() {
 
   buffer.clear();
   additionalBuffer.clear();
+  escapedSequence = EscapedSequence();
 
   endParsing = false;
 }